@@ -43,15 +43,21 @@
 
 #define FREQ_1MHz               (1000000UL)
 #define FLEXSPI_DLLCR_DEFAULT   (0x100UL)
-#define FLEXSPI_WATERMARK_BITS  (8U)
-#define FLEXSPI_AHB_BUFFER_SIZE (0x800U)
 
 #define FLEXSPI_MAX_RETRY       (1000U)             /* 最大リトライ回数 */
+#define FLEXSPI_DMA_TIMEOUT     (1000)              /* DMA転送完了待ちタイムアウト(ms) */
+#define FLEXSPI_FIFO_TIMEOUT    (1000)              /* FIFOウォーターマーク待ちタイムアウト(ms) */
+#define FLEXSPI_DMA_TX_MIN_SIZE (64U)               /* DMA送信を行う最小サイズ(未満はCPU転送) */
+#define FLEXSPI_CMD_TIMEOUT     (1000)              /* IPコマンド完了待ちタイムアウト(ms) */
+#define FLEXSPI_RX_POLL_SPIN    (256U)              /* RX FIFO端数待ちで休止せずに確認する回数 */
+#define FLEXSPI_ABORT_SPIN      (1000U)             /* コマンド中断時のリセット完了確認回数 */
 
 /* イベントフラグビット */
 #define FLEXSPI_EVFBIT_DONE     (0x00000001U)       /* コマンド実行完了 */
-#define FLEXSPI_EVFBIT_RX       (0x00000002U)       /* RX FIFO待ち */
-#define FLEXSPI_EVFBIT_TX       (0x00000004U)       /* TX FIFO待ち */
+#define FLEXSPI_EVFBIT_RX       (0x00000002U)       /* RX FIFOウォーターマーク到達 */
+#define FLEXSPI_EVFBIT_TX       (0x00000004U)       /* TX FIFOウォーターマーク空き */
+#define FLEXSPI_EVFBIT_DMA_RX   (0x00000008U)       /* RX DMA転送完了 */
+#define FLEXSPI_EVFBIT_DMA_TX   (0x00000010U)       /* TX DMA転送完了 */
 #define FLEXSPI_EVFBIT_WAIT     (0x80000000U)       /* 汎用時間待ち */
 
 /* DLLレジスタ設定値最小・最大 */
@@ -80,6 +86,20 @@ typedef struct FlexSPI_DrvInfo_tag {
     FlexSPI_Type    *tpBase;    /* FlexSPIコントローラーレジスタベースアドレス */
     ID              tIsrID;     /* 割り込みサービスルーチンID */
     ID              tFlgID;     /* イベントフラグID */
+    const FlexSPI_DmaOps *ptDmaOps;     /* DMA制御関数テーブル */
+    uint32_t        ulRxMode;           /* RX FIFO転送モード */
+    uint32_t        ulTxMode;           /* TX FIFO転送モード */
+    uint32_t        ulRxWatermark;      /* RX FIFOウォーターマーク(バイト) */
+    uint32_t        ulTxWatermark;      /* TX FIFOウォーターマーク(バイト) */
+    int             iDmaResult[2];      /* DMA転送結果[FLEXSPI_DMA_DIR_RX/TX] */
+    FlexSPI_CmdDesc *ptCmdHead;         /* IPコマンドキュー先頭(実行中のコマンド) */
+    FlexSPI_CmdDesc *ptCmdTail;         /* IPコマンドキュー末尾 */
+    uint32_t        ulRxClkSrc;         /* RXサンプルクロックソース(MCR0.RXCLKSRC) */
+    FlexSPI_SetRootClockFunc pfnSetRootClock;   /* ルートクロック設定関数 */
+    uint32_t        ulOpenMask;         /* オープン済みチップセレクト(bit n = CS n) */
+    uint32_t        ulParallel;         /* パラレルモード(FLEXSPI_PARALLEL_*) */
+    uint32_t        ulB1Size;           /* パラレルモード中に退避したFLSHCR0[B1] */
+    FlexSPI_AhbBufConfig tAhbBuf[FLEXSPI_AHB_BUFFER_NUM];   /* AHB RXバッファ構成 */
 } FlexSPI_DrvInfo;
 
 /****************************************************************************/
@@ -96,6 +116,9 @@ DLOCAL FlexSPI_DrvInfo  l_tDrvInfo = { 0 };
 /* ソフトリセット */
 LOCAL int _FlexSPI_SoftwareReset(FlexSPI_Type *base);
 
+/* AHB RXバッファ破棄 */
+LOCAL int _FlexSPI_ClearAHBBuffer(FlexSPI_Type *base);
+
 /* レジスタ設定 */
 LOCAL void _FlexSPI_SetConfig(FlexSPI_Type *base);
 
@@ -105,8 +128,47 @@ LOCAL int _FlexSPI_SetCS(FlexSPI_Type *base, int chip_select, const flexspi_devi
 /* DLLレジスタ値取得 */
 LOCAL int _FlexSPI_GetDLLValue(FlexSPI_Type *base, int chip_select, const flexspi_device_config_t *config);
 
+/* アイドル待ち */
+LOCAL int _FlexSPI_WaitIdle(FlexSPI_Type *base);
+
+/* DLLロック待ち */
+LOCAL void _FlexSPI_WaitDLLLock(FlexSPI_Type *base, uint8_t index, uint32_t dllValue);
+
+/* チップセレクト追加 */
+LOCAL int _FlexSPI_OpenCS(FlexSPI_Type *base, int chip_select, const flexspi_device_config_t *config);
+LOCAL void _FlexSPI_SetAHBReadSeq(FlexSPI_Type *base, int chip_select, const flexspi_device_config_t *config);
+
 /* AHB設定 */
 LOCAL void _FlexSPI_SetAHBConfig(FlexSPI_Type *base);
+LOCAL void _FlexSPI_SetAHBBuffer(FlexSPI_Type *base);
+
+/* FIFOウォーターマーク待ち */
+LOCAL int _FlexSPI_WaitFifo(FlexSPI_Type *base, uint32_t ulIntrMask, uint32_t ulIntenMask, FLGPTN tEvfBit);
+
+/* RX FIFO読み出し(DMA) */
+LOCAL int _FlexSPI_ReadRxFifoDma(FlexSPI_Type *base, unsigned char *buf, uint32_t size);
+
+/* RX FIFO読み出し(CPU) */
+LOCAL int _FlexSPI_DrainRxFifo(FlexSPI_Type *base, unsigned char *buf, uint32_t size);
+LOCAL int _FlexSPI_WaitRxBlock(FlexSPI_Type *base, uint32_t ulBlock);
+
+/* IPコマンドキュー */
+LOCAL int _FlexSPI_ExecSync(FlexSPI_Type *base, FlexSPI_CmdDesc *desc);
+LOCAL int _FlexSPI_WaitCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc);
+LOCAL int _FlexSPI_EnqueueCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc);
+LOCAL int _FlexSPI_ReserveCommand(FlexSPI_CmdDesc *desc);
+LOCAL void _FlexSPI_CancelCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc);
+LOCAL void _FlexSPI_AbortCommand(FlexSPI_Type *base);
+LOCAL void _FlexSPI_StartCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc);
+LOCAL void _FlexSPI_CompleteCommand(FlexSPI_Type *base, uint32_t ulStatus);
+
+/* TX FIFO書き込み開始(DMA) */
+LOCAL int _FlexSPI_StartTxFifoDma(FlexSPI_Type *base, unsigned char *txbuf, uint32_t size);
+
+/* データキャッシュ保守 */
+LOCAL void _FlexSPI_CleanDCache(const void *addr, uint32_t size);
+LOCAL void _FlexSPI_CleanInvalidateDCache(const void *addr, uint32_t size);
+LOCAL void _FlexSPI_InvalidateDCache(const void *addr, uint32_t size);
 
 /* 割り込みサービスルーチン */
 LOCAL void _FlexSPI_ISR(VP_INT exinf);
@@ -139,6 +201,14 @@ T_CFLG tCFLG = { 0 };
     /* FlexSPIコントローラーのレジスタベースアドレス設定 */
     l_tDrvInfo.tpBase = (FlexSPI_Type*)FLEXSPI_BASE;
 
+    /* FIFOウォーターマーク初期値 */
+    l_tDrvInfo.ulRxWatermark = FLEXSPI_WATERMARK_DEFAULT;
+    l_tDrvInfo.ulTxWatermark = FLEXSPI_WATERMARK_DEFAULT;
+
+    /* AHB RXバッファ初期値(全マスター共用で1つのバッファに全容量を割り当てる) */
+    l_tDrvInfo.tAhbBuf[FLEXSPI_AHB_BUFFER_DEFAULT].ulSize     = FLEXSPI_AHB_BUFFER_SIZE;
+    l_tDrvInfo.tAhbBuf[FLEXSPI_AHB_BUFFER_DEFAULT].ulPrefetch = 1U;
+
     /* 割り込みハンドラ設定 */
     tCISR.isratr = TA_HLNG;
     tCISR.intno  = INTNO_QSPI;
@@ -184,7 +254,7 @@ err_end:
 /* DESCRIPTION: オープン                                                                        */
 /*----------------------------------------------------------------------------------------------*/
 /* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
-/*            : chip_select                     論理QSPIデバイス番号(0 only)                    */
+/*            : chip_select                     論理QSPIデバイス番号(FLEXSPI_CS_*)              */
 /*            : config                          デバイスコンフィギュレーション情報              */
 /*                                                                                              */
 /* OUTPUT     : none                                                                            */
@@ -197,11 +267,14 @@ err_end:
 int FlexSPI_Open(FlexSPI_Type *base, int chip_select, const flexspi_device_config_t *config)
 {
 int iRet = FLEXSPI_E_ERROR;
+int i    = 0;
 
     /* パラメータチェック */
-    if ((base        == NULL) ||    /* レジスタベースアドレス未設定 */
-        (chip_select != 0)    ||    /* 論理デバイス番号がゼロでない */
-        (config      == NULL)) {    /* デバイスコンフィギュレーション情報未設定 */
+    if ((base        == NULL)           ||  /* レジスタベースアドレス未設定 */
+        (chip_select <  0)              ||  /* 論理デバイス番号範囲外 */
+        (chip_select >= FLEXSPI_CS_NUM) ||
+        (config      == NULL)           ||  /* デバイスコンフィギュレーション情報未設定 */
+        ((l_tDrvInfo.ulOpenMask & (1UL << chip_select)) != 0)) {    /* オープン済み */
         iRet = FLEXSPI_E_PARAM;     
         goto err_end;
     }
@@ -209,6 +282,48 @@ int iRet = FLEXSPI_E_ERROR;
         ;   /* do nothing */
     }
 
+    /* パラレルモード中はアドレスマップを変更できない */
+    if (l_tDrvInfo.ulParallel != FLEXSPI_PARALLEL_OFF) {
+        iRet = FLEXSPI_E_ERROR;
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* Octalデバイスはポートの信号線(DATA[7:4])をポートBと共用するためポートAのみ使用可能 */
+    if ((FlexSPI_GetDeviceType() != FLEXSPI_DEVICE_QUAD) &&
+        (chip_select >= FLEXSPI_CS_B1)) {
+        iRet = FLEXSPI_E_PARAM;
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 他のデバイスがオープン済みの場合はチップセレクトの追加のみ */
+    if (l_tDrvInfo.ulOpenMask != 0) {
+        iRet = _FlexSPI_OpenCS(base, chip_select, config);
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* ルートクロック設定(関数登録時のみ、未登録時はブート時の設定のまま) */
+    if (l_tDrvInfo.pfnSetRootClock != NULL) {
+        if (l_tDrvInfo.pfnSetRootClock(config->flexspiRootClk) != 0) {
+            iRet = FLEXSPI_E_ERROR;     /* ルートクロック設定エラー */
+            goto err_end;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+
     /* FlexSPIコントローラーレジスタ設定 */
 
     /* 1)ソフトウェアリセット */
@@ -224,8 +339,14 @@ int iRet = FLEXSPI_E_ERROR;
     /* レジスタ設定(MCR0 - 2) */
     _FlexSPI_SetConfig(base);
 
+    /* 未接続のデバイスはサイズ0としてアドレス空間から外す(リセット値は有効サイズ) */
+    for (i = 0; i < FLEXSPI_CS_NUM; i++) {
+        base->FLSHCR0[i] = 0;
+    }
+
     /* コンフィギュレーション指定 */
     _FlexSPI_SetCS(base, chip_select, config);
+    _FlexSPI_SetAHBReadSeq(base, chip_select, config);  /* AHB読み出しシーケンス */
 
     /* AHB制御レジスタの構成 */
     _FlexSPI_SetAHBConfig(base);
@@ -233,6 +354,20 @@ int iRet = FLEXSPI_E_ERROR;
     /* 19)MCR0(モジュールイネーブル) */
     base->MCR0 &= ~FlexSPI_MCR0_MDIS_MASK;
 
+    /* IPコマンドキュー初期化 */
+    l_tDrvInfo.ptCmdHead = NULL;
+    l_tDrvInfo.ptCmdTail = NULL;
+
+    /* 割り込み許可(以降は割り込み要因をINTENで制御する) */
+    if (ena_int(INTNO_QSPI) != E_OK) {
+        iRet = FLEXSPI_E_ERROR;     /* 割り込み許可エラー */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    l_tDrvInfo.ulOpenMask = (1UL << chip_select);
     iRet = FLEXSPI_E_SUCCESS;
 
 err_end:
@@ -265,14 +400,105 @@ int iRet = FLEXSPI_E_ERROR;
         ;   /* do nothing */
     }
 
+    /* 未完了のIPコマンドあり */
+    if (l_tDrvInfo.ptCmdHead != NULL) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 割り込み禁止 */
+    dis_int(INTNO_QSPI);
+    base->INTEN = 0;
+
     /* FlexSPIコントローラーレジスタ設定 */
 
     /* ソフトウェアリセット */
     iRet = _FlexSPI_SoftwareReset(base);
 
+    l_tDrvInfo.ulOpenMask = 0;
+    l_tDrvInfo.ulParallel = FLEXSPI_PARALLEL_OFF;
+
     return iRet;
 }
 
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_CloseCS                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: チップセレクト単位のクローズ                                                    */
+/*              最後にオープンしていたデバイスの場合はFlexSPI_Closeと同じ                       */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : chip_select                     論理QSPIデバイス番号(FLEXSPI_CS_*)              */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 実行中のコマンドがある、またはタイムアウト      */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_CloseCS(FlexSPI_Type *base, int chip_select)
+{
+    /* パラメータチェック */
+    if ((base        == NULL) ||            /* レジスタベースアドレス未設定 */
+        (chip_select <  0)    ||            /* 論理デバイス番号範囲外 */
+        (chip_select >= FLEXSPI_CS_NUM)) {
+        return FLEXSPI_E_PARAM;             /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 未オープン */
+    if ((l_tDrvInfo.ulOpenMask & (1UL << chip_select)) == 0) {
+        return FLEXSPI_E_SUCCESS;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 最後のデバイス */
+    if (l_tDrvInfo.ulOpenMask == (1UL << chip_select)) {
+        return FlexSPI_Close(base);
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* パラレルモード中はアドレスマップを変更できない */
+    if (l_tDrvInfo.ulParallel != FLEXSPI_PARALLEL_OFF) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 未完了のIPコマンドあり */
+    if (l_tDrvInfo.ptCmdHead != NULL) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* STS0(アイドル待ち) */
+    if (_FlexSPI_WaitIdle(base) != FLEXSPI_E_SUCCESS) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* FLSHCR0[n](アドレス空間から外す、後続デバイスの先頭アドレスが変わる) */
+    base->FLSHCR0[chip_select] = 0;
+    l_tDrvInfo.ulOpenMask &= ~(1UL << chip_select);
+
+    /* アドレスマップ変更後のAHBバッファを破棄 */
+    return _FlexSPI_SoftwareReset(base);
+}
+
 /************************************************************************************************/
 /* FUNCTION   : FlexSPI_ReadRxFifo                                                              */
 /*                                                                                              */
@@ -290,10 +516,8 @@ int iRet = FLEXSPI_E_ERROR;
 /************************************************************************************************/
 int FlexSPI_ReadRxFifo(FlexSPI_Type *base, unsigned char *buf, uint32_t size)
 {
-uint32_t ulReadByte = 0;
-uint32_t ulReadData = 0;
-uint32_t ulRetry    = 0;
-FLGPTN tFlgPtn      = 0;
+uint32_t ulDmaSize  = 0;
+int iRet            = FLEXSPI_E_ERROR;
 
     /* パラメータチェック */
     if ((base == NULL) ||           /* レジスタベースアドレス未設定 */ 
@@ -305,40 +529,36 @@ FLGPTN tFlgPtn      = 0;
         ;   /* do nothing */
     }
 
-    /* FlexSPIコントローラーレジスタアクセス */
+    /* DMA転送(キャッシュライン境界のバッファのみ、端数はCPUで読み出す) */
+    ulDmaSize = FlexSPI_GetRxDmaSize(buf, size, l_tDrvInfo.ulRxMode, l_tDrvInfo.ulRxWatermark);
+    if (ulDmaSize != 0U) {
+        iRet = _FlexSPI_ReadRxFifoDma(base, buf, ulDmaSize);
+        if (iRet != FLEXSPI_E_SUCCESS) {
+            return iRet;
+        }
+        else {
+            buf  += ulDmaSize;
+            size -= ulDmaSize;
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
 
-    /* 指定されたサイズまでデータ取得 */
-    while (size--) {
-        if ((ulReadByte % 4) == 0) {
-            /* RX FIFOデータ待ち */
-            for (ulRetry = 0; ulRetry < FLEXSPI_MAX_RETRY; ulRetry++) {
-                if ((base->INTR & FlexSPI_INTR_IPRXWA_MASK) != 0U) {
-                    break;
-                }
-                else {
-                    twai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_RX, TWF_ORW, &tFlgPtn, 1U);
-                }
-            }
-            if (ulRetry == FLEXSPI_MAX_RETRY) {
-                return FLEXSPI_E_ERROR; /* リトライアウト */
-            }
-            else {
-                ;   /* do nothing */
-            }
+    /* FlexSPIコントローラーレジスタアクセス */
 
-            /* RX FIFOよりデータ取得 */
-            ulReadData = base->RFDR[ulReadByte / 4];
+    /* 1)RX FIFOよりデータ取得(ウォーターマーク単位) */
+    if (size != 0U) {
+        iRet = _FlexSPI_DrainRxFifo(base, buf, size);
+        if (iRet != FLEXSPI_E_SUCCESS) {
+            return FLEXSPI_E_ERROR; /* タイムアウト */
         }
         else {
             ;   /* do nothing */
         }
-
-        /* データを格納 */
-        *buf = ulReadData & 0xFF;
-
-        ulReadData >>= 8;
-        buf++;
-        ulReadByte++;
+    }
+    else {
+        ;   /* do nothing */
     }
 
     /* 2)INTR(RX FIFOデータクリア) */
@@ -372,23 +592,85 @@ FLGPTN tFlgPtn      = 0;
 /************************************************************************************************/
 int FlexSPI_WriteTxFifo(FlexSPI_Type *base, unsigned char *txbuf, unsigned int address, uint32_t byteLength)
 {
-uint32_t ulCount  = 0;
-uint32_t ulRemain = 0;
-uint32_t ulRetry  = 0;
-FLGPTN tFlgPtn    = 0;
-ER tRet           = E_SYS;
-int iRet          = FLEXSPI_E_ERROR;
+    return FlexSPI_WriteSequence(base, FLEXSPI_SEQ_SCRATCH, txbuf, address, byteLength);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_WriteSequence                                                           */
+/*                                                                                              */
+/* DESCRIPTION: TX FIFO書き込み＆コマンド実行(LUTシーケンス指定)                                */
+/*              FIFOに収まるCPU転送はIPコマンドキュー経由で実行する。                           */
+/*              それ以外(DMA転送・FLEXSPI_CMD_DATA_MAX超)はキューを予約し、                     */
+/*              TX FIFOへ書き込んでからコマンドを開始する                                       */
+/*              (実行中・実行待ちのコマンドがある場合はエラーとする)                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : seqId                           LUTシーケンス番号                               */
+/*            : txbuf                           送信データ格納バッファ                          */
+/*            : address                         SPI転送デバイスアドレス                         */
+/*            : byteLength                      書き込み長                                      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 FlexSPIコントローラーへのアクセス時にエラー     */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_WriteSequence(FlexSPI_Type *base, uint32_t seqId, unsigned char *txbuf, unsigned int address, uint32_t byteLength)
+{
+FlexSPI_CmdDesc tDesc = { 0 };
+uint32_t ulRemain     = 0;
+uint32_t ulSize       = 0;
+uint32_t ulUseDma     = 0;
+FLGPTN tFlgPtn        = 0;
+ER tRet               = E_SYS;
+int iRet              = FLEXSPI_E_ERROR;
 
     /* パラメータチェック */
-    if ((base       == NULL) ||     /* レジスタベースアドレス未設定 */ 
-        (txbuf      == NULL) ||     /* 送信データ格納バッファ未設定 */
-        (byteLength == 0)) {        /* 書き込み長がゼロ */
+    if ((base       == NULL) ||             /* レジスタベースアドレス未設定 */ 
+        (seqId      >= FLEXSPI_SEQ_MAX) ||  /* LUTシーケンス番号範囲外 */
+        (txbuf      == NULL) ||             /* 送信データ格納バッファ未設定 */
+        (byteLength == 0)) {                /* 書き込み長がゼロ */
         return FLEXSPI_E_PARAM;     /* パラメータエラー */
     }
     else {
         ;   /* do nothing */
     }
 
+    /* IPコマンド記述子設定 */
+    tDesc.ulSeqId   = seqId;
+    tDesc.ulAddress = address;
+    tDesc.ulLength  = byteLength;
+    tDesc.pucBuf    = txbuf;
+
+    /* 小さい転送・ウォーターマーク単位でない転送はCPU転送とする */
+    if ((l_tDrvInfo.ulTxMode == FLEXSPI_XFER_MODE_DMA) &&
+        (FLEXSPI_DMA_TX_MIN_SIZE <= byteLength) &&
+        ((byteLength % l_tDrvInfo.ulTxWatermark) == 0U)) {
+        ulUseDma = 1U;
+    }
+    else {
+        ulUseDma = 0;
+    }
+
+    /* FIFOに収まるCPU転送はキュー経由で実行する(TX FIFOはコマンド開始時に書き込まれる) */
+    if ((ulUseDma == 0U) && (byteLength <= FLEXSPI_CMD_DATA_MAX)) {
+        tDesc.ulDir = FLEXSPI_CMD_DIR_WRITE;
+        return _FlexSPI_ExecSync(base, &tDesc);
+    }
+    else {
+        tDesc.ulDir = FLEXSPI_CMD_DIR_NONE;     /* TX FIFOは本関数で書き込む */
+    }
+
+    /* キュー予約(以降に登録されたコマンドは本コマンドの完了後に開始される) */
+    if (_FlexSPI_ReserveCommand(&tDesc) != FLEXSPI_E_SUCCESS) {
+        return FLEXSPI_E_ERROR;     /* 実行中・実行待ちのコマンドあり */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
     /* FlexSPIコントローラーレジスタアクセス */
 
     /* 1)INTR(TX FIFO空きフラグクリア) */
@@ -397,118 +679,90 @@ int iRet          = FLEXSPI_E_ERROR;
     /* 2)IPTXFCR(TX FIFOクリア) */
     base->IPTXFCR |= FlexSPI_IPTXFCR_CLRIPTXF(1);
 
-    /* 3)IPCR0(QSPIデバイスアドレス設定) */
-    base->IPCR0 = address;
+    /* CPU転送の残りサイズ */
+    ulRemain = (ulUseDma != 0U) ? 0U : byteLength;
 
-    /* TX FIFOへの書き込み単位は64bit(=8Bytes) */
-    ulCount  = byteLength / 8;
-    ulRemain = byteLength % 8;
-
-    /* TX FIFO書き込み */
-
-    while (ulCount--) {
-        /* 4)INTR(TX FIFO空きフラグチェック) */
-        for (ulRetry = 0; ulRetry < FLEXSPI_MAX_RETRY; ulRetry++) {
-            if ((base->INTR & FlexSPI_INTR_IPTXWE_MASK) != 0) {
-                break;
-            }
-            else {
-                twai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_TX, TWF_ORW, &tFlgPtn, 1);
-            }
-        }
-        if (ulRetry == FLEXSPI_MAX_RETRY) {
-            return FLEXSPI_E_ERROR; /* リトライアウト */
+    /* TX FIFO書き込み(DMA) */
+    if (ulUseDma != 0U) {
+        if (_FlexSPI_StartTxFifoDma(base, txbuf, byteLength) != FLEXSPI_E_SUCCESS) {
+            goto err_end;   /* DMA開始エラー */
         }
         else {
             ;   /* do nothing */
         }
-
-        /* 5)TFDR(TX FIFO書き込み) */
-        memcpy((void*)&base->TFDR, txbuf, 8);
-        txbuf += 8;
-
-        /* 6)INTR(TX FIFO空きフラグクリア) */
-        base->INTR |= FlexSPI_INTR_IPTXWE_MASK;
+    }
+    else {
+        ;   /* do nothing */
     }
 
-    if (ulRemain != 0) {
-        /* 4)INTR(TX FIFO空きフラグチェック) */
-        for (ulRetry = 0; ulRetry < FLEXSPI_MAX_RETRY; ulRetry++) {
-            if ((base->INTR & FlexSPI_INTR_IPTXWE_MASK) != 0) {
-                break;
-            }
-            else {
-                twai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_TX, TWF_ORW, &tFlgPtn, 1);
-            }
-        }
-        if (ulRetry == FLEXSPI_MAX_RETRY) {
-            return FLEXSPI_E_ERROR; /* リトライアウト */
+    /* TX FIFO書き込み(CPU、ウォーターマーク単位) */
+    while (ulRemain != 0U) {
+        /* 3)INTR(TX FIFO空きフラグチェック) */
+        if (_FlexSPI_WaitFifo(base, FlexSPI_INTR_IPTXWE_MASK, FlexSPI_INTEN_IPTXWEEN_MASK, FLEXSPI_EVFBIT_TX) != FLEXSPI_E_SUCCESS) {
+            goto err_end;   /* タイムアウト */
         }
         else {
             ;   /* do nothing */
         }
 
-        /* 5)TFDR(TX FIFO書き込み) */
-        memcpy((void*)&base->TFDR, txbuf, ulRemain);
+        /* 4)TFDR(TX FIFO書き込み) */
+        ulSize = (l_tDrvInfo.ulTxWatermark < ulRemain) ? l_tDrvInfo.ulTxWatermark : ulRemain;
+        memcpy((void*)&base->TFDR, txbuf, ulSize);
+        txbuf    += ulSize;
+        ulRemain -= ulSize;
 
-        /* 6)INTR(TX FIFO空きフラグクリア) */
+        /* 5)INTR(TX FIFO空きフラグクリア) */
         base->INTR |= FlexSPI_INTR_IPTXWE_MASK;
     }
-    else {
-        ;   /* do nothing */
-    }
-
-    /* 7)IPCR1(SPI転送サイズ設定) */
-    base->IPCR1 &= ~(uint32_t)FlexSPI_IPCR1_IDATSZ_MASK;
-    base->IPCR1 |= FlexSPI_IPCR1_IDATSZ(byteLength);
-
-    /* イベントフラグクリア */
-    clr_flg(l_tDrvInfo.tFlgID, ~FLEXSPI_EVFBIT_DONE);
-
-    /* 割り込みステータスクリア */
-    base->INTR |= FlexSPI_INTR_IPCMDDONE(1);
-
-    /* 割り込みイネーブル */
-    base->INTEN |= FlexSPI_INTEN_IPCMDDONEEN(1);
 
-    /* 割り込み許可 */
-    tRet = ena_int(INTNO_QSPI);
-    if (tRet != E_OK) {
-        goto err_end;   /* 割り込み許可エラー */
-    }
-    else {
-        ;   /* do nothing */
-    }
+    /* 6)コマンド開始(予約済みのためキュー先頭) */
+    loc_cpu();
+    _FlexSPI_StartCommand(base, &tDesc);
+    unl_cpu();
 
-    /* 8)IPCMD(コマンド実行) */
-    base->IPCMD |= FlexSPI_IPCMD_TRG(1);
+    /* 7)完了待ち(タイムアウト時はキューから取り消す) */
+    iRet = _FlexSPI_WaitCommand(base, &tDesc);
 
-    /* 9)INTR(SPI転送完了チェック) */
-    if ((base->INTR & FlexSPI_INTR_IPCMDDONE_MASK) == 0U) {
-        wai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_DONE, TWF_ORW, &tFlgPtn);
+    /* DMA転送完了待ち */
+    if (ulUseDma != 0U) {
+        tRet = twai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_DMA_TX, TWF_ORW, &tFlgPtn, FLEXSPI_DMA_TIMEOUT);
+        if (tRet != E_OK) {
+            l_tDrvInfo.ptDmaOps->pfnAbort(FLEXSPI_DMA_DIR_TX);
+            l_tDrvInfo.iDmaResult[FLEXSPI_DMA_DIR_TX] = FLEXSPI_E_ERROR;  /* タイムアウト */
+        }
+        else {
+            ;   /* do nothing */
+        }
+        base->IPTXFCR &= ~FlexSPI_IPTXFCR_TXDMAEN_MASK;
+        if (iRet == FLEXSPI_E_SUCCESS) {
+            iRet = l_tDrvInfo.iDmaResult[FLEXSPI_DMA_DIR_TX];
+        }
+        else {
+            ;   /* do nothing */
+        }
     }
     else {
         ;   /* do nothing */
     }
 
-    /* 10)IPTXFCR(TX FIFOクリア) */
+    /* 8)IPTXFCR(TX FIFOクリア) */
     base->IPTXFCR |= FlexSPI_IPTXFCR_CLRIPTXF(1);
 
-    /* 11)INTR(TX FIFO空きフラグクリア) */
-    base->INTR |= FlexSPI_INTR_IPRXWA(1);
+    /* 9)INTR(TX FIFO空きフラグクリア) */
+    base->INTR |= FlexSPI_INTR_IPTXWE(1);
 
-    /* 割り込み禁止 */
-    tRet = dis_int(INTNO_QSPI);
-    if (tRet != E_OK) {
-        goto err_end;   /* 割り込み禁止エラー */
+    return iRet;
+
+err_end:
+    /* 予約を取り消す(後続のコマンドがあれば開始する) */
+    _FlexSPI_CancelCommand(base, &tDesc);
+    if (ulUseDma != 0U) {
+        base->IPTXFCR &= ~FlexSPI_IPTXFCR_TXDMAEN_MASK;
     }
     else {
         ;   /* do nothing */
     }
-
-    iRet = FLEXSPI_E_SUCCESS;
-err_end:
-    return iRet;
+    return FLEXSPI_E_ERROR;
 }
 
 /************************************************************************************************/
@@ -529,214 +783,2012 @@ err_end:
 /************************************************************************************************/
 int FlexSPI_ExecCommand(FlexSPI_Type *base, uint32_t address, uint32_t byteLength)
 {
-FLGPTN tFlgPtn = 0;
-ER tRet        = E_SYS;
-int iRet       = FLEXSPI_E_ERROR;
+    return FlexSPI_ExecSequence(base, FLEXSPI_SEQ_SCRATCH, address, byteLength);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_ExecSequence                                                            */
+/*                                                                                              */
+/* DESCRIPTION: コマンド実行(LUTシーケンス指定)                                                 */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : seqId                           LUTシーケンス番号                               */
+/*            : address                         SPI転送デバイスアドレス                         */
+/*            : byteLength                      書き込み長                                      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 FlexSPIコントローラーへのアクセス時にエラー     */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_ExecSequence(FlexSPI_Type *base, uint32_t seqId, uint32_t address, uint32_t byteLength)
+{
+FlexSPI_CmdDesc tDesc = { 0 };
 
     /* パラメータチェック */
-    if (base == NULL) {         /* レジスタベースアドレス未設定 */ 
-        return FLEXSPI_E_PARAM; /* パラメータエラー */
+    if ((base  == NULL) ||              /* レジスタベースアドレス未設定 */ 
+        (seqId >= FLEXSPI_SEQ_MAX)) {   /* LUTシーケンス番号範囲外 */
+        return FLEXSPI_E_PARAM;         /* パラメータエラー */
     }
     else {
         ;   /* do nothing */
     }
 
-    /* FlexSPIコントローラーレジスタアクセス */
+    /* IPコマンド記述子設定(RX FIFOのデータは呼び出し元が取得する) */
+    tDesc.ulSeqId   = seqId;
+    tDesc.ulAddress = address;
+    tDesc.ulLength  = byteLength;
+    tDesc.ulDir     = FLEXSPI_CMD_DIR_NONE;
 
-    /* 1)IPCR0(SPI転送アドレス設定) */
-    base->IPCR0 = address;
+    /* キュー経由で実行し完了を待つ */
+    return _FlexSPI_ExecSync(base, &tDesc);
+}
 
-    /* 2)IPCR1(SPI転送サイズ設定) */
-    base->IPCR1 &= ~(uint32_t)FlexSPI_IPCR1_IDATSZ_MASK;
-    base->IPCR1 |= FlexSPI_IPCR1_IDATSZ(byteLength);
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_ReadStream                                                              */
+/*                                                                                              */
+/* DESCRIPTION: ストリーミング読み出し(LUTシーケンス指定)                                       */
+/*              1コマンドで最大FLEXSPI_STREAM_DATA_MAXを読み出し、コマンド実行中にRX FIFOを     */
+/*              ウォーターマーク単位(またはDMA)で取り出す                                       */
+/*              (FIFO満杯の間はコントローラーがSCLKを止めるため、取り出しに合わせて転送が進む)  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : seqId                           LUTシーケンス番号                               */
+/*            : address                         SPI転送デバイスアドレス                         */
+/*            : size                            読み出し長                                      */
+/*                                                                                              */
+/* OUTPUT     : buf                             データ格納バッファ                              */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 FlexSPIコントローラーへのアクセス時にエラー     */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_ReadStream(FlexSPI_Type *base, uint32_t seqId, uint32_t address, unsigned char *buf, uint32_t size)
+{
+FlexSPI_CmdDesc tDesc = { 0 };
+uint32_t ulSize       = 0;
+int iRet              = FLEXSPI_E_ERROR;
+int iRet2             = FLEXSPI_E_ERROR;
 
-    /* 3)IPRXFCR(RX FIFOクリア) */
-    base->IPRXFCR |= FlexSPI_IPRXFCR_CLRIPRXF(1);
+    /* パラメータチェック */
+    if ((base  == NULL) ||              /* レジスタベースアドレス未設定 */
+        (seqId >= FLEXSPI_SEQ_MAX) ||   /* LUTシーケンス番号範囲外 */
+        (buf   == NULL) ||              /* 読み出しバッファ未設定 */
+        (size  == 0U)) {                /* 読み出し長がゼロ */
+        return FLEXSPI_E_PARAM;         /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
 
-    /* 4)INTR(RX FIFOフルフラグクリア) */
-    base->INTR |= FlexSPI_INTR_IPRXWA(1);
+    while (0U < size) {
+        ulSize = (FLEXSPI_STREAM_DATA_MAX < size) ? FLEXSPI_STREAM_DATA_MAX : size;
 
-    /* イベントフラグクリア */
-    clr_flg(l_tDrvInfo.tFlgID, ~FLEXSPI_EVFBIT_DONE);
+        /* IPコマンド記述子設定(完了は待ちタスクの起床で通知させる) */
+        tDesc.ulSeqId     = seqId;
+        tDesc.ulAddress   = address;
+        tDesc.ulLength    = ulSize;
+        tDesc.ulDir       = FLEXSPI_CMD_DIR_NONE;
+        tDesc.pfnCallback = NULL;
+
+        /* 1)コマンド開始 */
+        iRet = FlexSPI_SubmitCommand(base, &tDesc);
+        if (iRet != FLEXSPI_E_SUCCESS) {
+            return iRet;
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        /* 2)コマンド実行中にRX FIFOより取得 */
+        iRet = FlexSPI_ReadRxFifo(base, buf, ulSize);
+
+        /* 3)完了待ち(取り出しに失敗した場合もタイムアウトでキューから外す) */
+        iRet2 = _FlexSPI_WaitCommand(base, &tDesc);
+        if ((iRet != FLEXSPI_E_SUCCESS) || (iRet2 != FLEXSPI_E_SUCCESS)) {
+            return FLEXSPI_E_ERROR;
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        buf     += ulSize;
+        address += ulSize;
+        size    -= ulSize;
+    }
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_ExecCommandAndRead                                                      */
+/*                                                                                              */
+/* DESCRIPTION: コマンド実行&読み出し                                                           */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : address                         SPI転送デバイスアドレス                         */
+/*            : byteLength                      書き込み長                                      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 0xFF以外                        正常終了(戻り値は読み出しデータ)                */
+/*              0xFF                            エラー                                          */
+/*                                                                                              */
+/************************************************************************************************/
+unsigned char FlexSPI_ExecCommandAndRead(FlexSPI_Type *base, uint32_t address, uint32_t byteLength)
+{
+    return FlexSPI_ExecSequenceAndRead(base, FLEXSPI_SEQ_SCRATCH, address, byteLength);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_ExecSequenceAndRead                                                     */
+/*                                                                                              */
+/* DESCRIPTION: コマンド実行&読み出し(LUTシーケンス指定)                                        */
+/*              1つのIPコマンド(FLEXSPI_CMD_DIR_READ)で実行し、完了時に読み出しデータを取得する */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : seqId                           LUTシーケンス番号                               */
+/*            : address                         SPI転送デバイスアドレス                         */
+/*            : byteLength                      読み出し長(FLEXSPI_CMD_DATA_MAX以下)            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 0xFF以外                          正常終了(戻り値は読み出しデータの先頭)        */
+/*              0xFF                            エラー                                          */
+/*                                                                                              */
+/************************************************************************************************/
+unsigned char FlexSPI_ExecSequenceAndRead(FlexSPI_Type *base, uint32_t seqId, uint32_t address, uint32_t byteLength)
+{
+FlexSPI_CmdDesc tDesc                      = { 0 };
+unsigned char ucData[FLEXSPI_CMD_DATA_MAX] = { 0 };
+int iRet                                   = FLEXSPI_E_ERROR;
+
+    /* パラメータチェック */
+    if ((base == NULL) ||                       /* レジスタベースアドレス未設定 */
+        (seqId >= FLEXSPI_SEQ_MAX) ||           /* LUTシーケンス番号範囲外 */
+        (byteLength == 0U) ||                   /* 読み出し長がゼロ */
+        (byteLength > FLEXSPI_CMD_DATA_MAX)) {  /* FIFOに収まらない */
+        return 0xFF;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* IPコマンド記述子設定(RX FIFOのデータは完了時に取得される) */
+    tDesc.ulSeqId   = seqId;
+    tDesc.ulAddress = address;
+    tDesc.ulLength  = byteLength;
+    tDesc.ulDir     = FLEXSPI_CMD_DIR_READ;
+    tDesc.pucBuf    = ucData;
+
+    /* キュー経由で実行し完了を待つ */
+    iRet = _FlexSPI_ExecSync(base, &tDesc);
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        return 0xFF;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return ucData[0];
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SubmitCommand                                                           */
+/*                                                                                              */
+/* DESCRIPTION: IPコマンド登録(非同期実行)                                                      */
+/*              コントローラーが空いていれば即時に開始し、実行中であればキューに追加する。      */
+/*              完了はIPCMDDONE割り込みで判定し、次のコマンドを割り込み内で続けて開始する。     */
+/*              FIFOを直接操作するAPI(FlexSPI_ReadRxFifo等)との排他は呼び出し元で行うこと       */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : desc                            IPコマンド記述子                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 記述子が登録済み                                */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SubmitCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc)
+{
+int iRet = FLEXSPI_E_ERROR;
+
+    loc_cpu();
+    iRet = _FlexSPI_EnqueueCommand(base, desc);
+    unl_cpu();
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_iSubmitCommand                                                          */
+/*                                                                                              */
+/* DESCRIPTION: IPコマンド登録(非同期実行、非タスクコンテキスト用)                              */
+/*              完了通知(pfnCallback)から続けてコマンドを登録する場合に使用する                 */
+/*              (FlexSPI割り込み内で呼び出されるため、キュー操作はCPUロックなしで排他される)    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : desc                            IPコマンド記述子                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 記述子が登録済み                                */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_iSubmitCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc)
+{
+    return _FlexSPI_EnqueueCommand(base, desc);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_CancelCommand                                                           */
+/*                                                                                              */
+/* DESCRIPTION: IPコマンド取り消し                                                              */
+/*              完了通知を待たずに記述子をキューから外す(完了待ちのタイムアウト時に使用する)    */
+/*              実行中のコマンドであればコントローラーを停止し、後続のコマンドを開始する        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : desc                            IPコマンド記述子                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了(未登録の記述子も含む)                  */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_CancelCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc)
+{
+    /* パラメータチェック */
+    if ((base == NULL) ||           /* レジスタベースアドレス未設定 */
+        (desc == NULL)) {           /* 記述子未設定 */
+        return FLEXSPI_E_PARAM;     /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    _FlexSPI_CancelCommand(base, desc);
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/* DMA */
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SetDmaOps                                                               */
+/*                                                                                              */
+/* DESCRIPTION: DMA制御関数登録                                                                 */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ops                             DMA制御関数テーブル(NULLで登録解除)             */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SetDmaOps(const FlexSPI_DmaOps *ops)
+{
+    /* パラメータチェック */
+    if ((ops != NULL) &&
+        ((ops->pfnStart == NULL) ||     /* 転送開始関数未設定 */
+         (ops->pfnAbort == NULL))) {    /* 転送中断関数未設定 */
+        return FLEXSPI_E_PARAM;         /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    l_tDrvInfo.ptDmaOps = ops;
+
+    /* 登録解除時はCPU転送に戻す */
+    if (ops == NULL) {
+        l_tDrvInfo.ulRxMode = FLEXSPI_XFER_MODE_PIO;
+        l_tDrvInfo.ulTxMode = FLEXSPI_XFER_MODE_PIO;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SetRxMode                                                               */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFO転送モード設定                                                           */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : mode                            FLEXSPI_XFER_MODE_PIO / FLEXSPI_XFER_MODE_DMA   */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SetRxMode(FlexSPI_Type *base, uint32_t mode)
+{
+    /* パラメータチェック */
+    if ((base == NULL) ||                                       /* レジスタベースアドレス未設定 */
+        ((mode != FLEXSPI_XFER_MODE_PIO) &&
+         (mode != FLEXSPI_XFER_MODE_DMA)) ||                    /* モード範囲外 */
+        ((mode == FLEXSPI_XFER_MODE_DMA) &&
+         (l_tDrvInfo.ptDmaOps == NULL))) {                      /* DMA制御関数未登録 */
+        return FLEXSPI_E_PARAM;                                 /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* RXDMAENは転送毎に設定するため、ここではクリアのみ */
+    base->IPRXFCR &= ~FlexSPI_IPRXFCR_RXDMAEN_MASK;
+
+    l_tDrvInfo.ulRxMode = mode;
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SetTxMode                                                               */
+/*                                                                                              */
+/* DESCRIPTION: TX FIFO転送モード設定                                                           */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : mode                            FLEXSPI_XFER_MODE_PIO / FLEXSPI_XFER_MODE_DMA   */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SetTxMode(FlexSPI_Type *base, uint32_t mode)
+{
+    /* パラメータチェック */
+    if ((base == NULL) ||                                       /* レジスタベースアドレス未設定 */
+        ((mode != FLEXSPI_XFER_MODE_PIO) &&
+         (mode != FLEXSPI_XFER_MODE_DMA)) ||                    /* モード範囲外 */
+        ((mode == FLEXSPI_XFER_MODE_DMA) &&
+         (l_tDrvInfo.ptDmaOps == NULL))) {                      /* DMA制御関数未登録 */
+        return FLEXSPI_E_PARAM;                                 /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* TXDMAENは転送毎に設定するため、ここではクリアのみ */
+    base->IPTXFCR &= ~FlexSPI_IPTXFCR_TXDMAEN_MASK;
+
+    l_tDrvInfo.ulTxMode = mode;
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/* FIFO */
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SetWatermark                                                            */
+/*                                                                                              */
+/* DESCRIPTION: FIFOウォーターマーク設定                                                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : rxBytes                         RX FIFOウォーターマーク(8 - 128の2のべき乗)     */
+/*            : txBytes                         TX FIFOウォーターマーク(8 - 128の2のべき乗)     */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SetWatermark(FlexSPI_Type *base, uint32_t rxBytes, uint32_t txBytes)
+{
+    /* パラメータチェック */
+    if ((base    == NULL)                   ||  /* レジスタベースアドレス未設定 */
+        (rxBytes <  FLEXSPI_WATERMARK_MIN)  ||  /* RXウォーターマーク範囲外 */
+        (rxBytes >  FLEXSPI_WATERMARK_MAX)  ||
+        ((rxBytes & (rxBytes - 1U)) != 0U)  ||  /* RXウォーターマークが2のべき乗でない */
+        (txBytes <  FLEXSPI_WATERMARK_MIN)  ||  /* TXウォーターマーク範囲外 */
+        (txBytes >  FLEXSPI_WATERMARK_MAX)  ||
+        ((txBytes & (txBytes - 1U)) != 0U)) {   /* TXウォーターマークが2のべき乗でない */
+        return FLEXSPI_E_PARAM;                 /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    l_tDrvInfo.ulRxWatermark = rxBytes;
+    l_tDrvInfo.ulTxWatermark = txBytes;
+
+    /* IPRXFCR(RX FIFO設定) */
+    base->IPRXFCR &= ~FlexSPI_IPRXFCR_RXWMRK_MASK;
+    base->IPRXFCR |= FlexSPI_IPRXFCR_RXWMRK(rxBytes / 8U - 1U);
+
+    /* IPTXFCR(TX FIFO設定) */
+    base->IPTXFCR &= ~FlexSPI_IPTXFCR_TXWMRK_MASK;
+    base->IPTXFCR |= FlexSPI_IPTXFCR_TXWMRK(txBytes / 8U - 1U);
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_DmaCompleteHandler                                                      */
+/*                                                                                              */
+/* DESCRIPTION: DMA転送完了通知(非タスクコンテキストから呼び出すこと)                           */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : dir                             FLEXSPI_DMA_DIR_RX / FLEXSPI_DMA_DIR_TX         */
+/*            : result                          FLEXSPI_E_SUCCESS / FLEXSPI_E_ERROR             */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+void FlexSPI_DmaCompleteHandler(uint32_t dir, int result)
+{
+    if (dir == FLEXSPI_DMA_DIR_RX) {
+        l_tDrvInfo.iDmaResult[FLEXSPI_DMA_DIR_RX] = result;
+        iset_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_DMA_RX);
+    }
+    else if (dir == FLEXSPI_DMA_DIR_TX) {
+        l_tDrvInfo.iDmaResult[FLEXSPI_DMA_DIR_TX] = result;
+        iset_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_DMA_TX);
+    }
+    else {
+        ;   /* do nothing */
+    }
+}
+
+/* クロック */
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SetClockHook                                                            */
+/*                                                                                              */
+/* DESCRIPTION: ルートクロック設定関数登録                                                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pfnSetRootClock                 ルートクロック設定関数(NULLで登録解除)          */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SetClockHook(FlexSPI_SetRootClockFunc pfnSetRootClock)
+{
+    l_tDrvInfo.pfnSetRootClock = pfnSetRootClock;
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SetRxClockSource                                                        */
+/*                                                                                              */
+/* DESCRIPTION: RXサンプルクロックソース設定(次回のオープン・クロック変更時に反映)              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : src                             FLEXSPI_RXCLKSRC_*                              */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SetRxClockSource(FlexSPI_Type *base, uint32_t src)
+{
+    /* パラメータチェック */
+    if ((base == NULL) ||                           /* レジスタベースアドレス未設定 */
+        (src  >  FLEXSPI_RXCLKSRC_EXTERNAL_DQS)) {  /* クロックソース範囲外 */
+        return FLEXSPI_E_PARAM;                     /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    l_tDrvInfo.ulRxClkSrc = src;
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_ChangeClock                                                             */
+/*                                                                                              */
+/* DESCRIPTION: SCLK周波数変更(オープン中に呼び出すこと)                                        */
+/*              ルートクロックは全デバイス共通のため、オープン中の全ポートのDLLを再設定する     */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : config                          デバイスコンフィギュレーション情報              */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 実行中のコマンドがある、またはクロック設定エラー*/
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_ChangeClock(FlexSPI_Type *base, const flexspi_device_config_t *config)
+{
+int iRet                            = FLEXSPI_E_ERROR;
+uint32_t dllValue[FLEXSPI_PORT_NUM] = { 0 };
+uint8_t index                       = 0;
+int cs                              = 0;
+
+    /* パラメータチェック */
+    if ((base   == NULL) ||         /* レジスタベースアドレス未設定 */
+        (config == NULL)) {         /* デバイスコンフィギュレーション情報未設定 */
+        return FLEXSPI_E_PARAM;     /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 未完了のIPコマンドあり */
+    if (l_tDrvInfo.ptCmdHead != NULL) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 1)STS0(アイドル待ち) */
+    iRet = _FlexSPI_WaitIdle(base);
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        return iRet;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 2)MCR0(モジュールディスエーブル) */
+    base->MCR0 |= FlexSPI_MCR0_MDIS_MASK;
+
+    /* 3)ルートクロック変更 */
+    if (l_tDrvInfo.pfnSetRootClock != NULL) {
+        if (l_tDrvInfo.pfnSetRootClock(config->flexspiRootClk) != 0) {
+            iRet = FLEXSPI_E_ERROR;     /* ルートクロック設定エラー(設定は変更しない) */
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        /* 4)MCR0(RXサンプルクロックソース設定) */
+        base->MCR0 = (base->MCR0 & ~FlexSPI_MCR0_RXCLKSRC_MASK) |
+                     FlexSPI_MCR0_RXCLKSRC(l_tDrvInfo.ulRxClkSrc);
+
+        /* 5)FLSHCR2[n](AHB読み出しシーケンス、SDR/DDRはプロファイル毎に異なる) */
+        for (cs = 0; cs < FLEXSPI_CS_NUM; cs++) {
+            if ((l_tDrvInfo.ulOpenMask & (1UL << cs)) != 0) {
+                _FlexSPI_SetAHBReadSeq(base, cs, config);
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+
+        /* 6)DLLCR[n/2](オープン中のデバイスがあるポートのみ設定) */
+        for (index = 0; index < FLEXSPI_PORT_NUM; index++) {
+            if ((l_tDrvInfo.ulOpenMask & (3UL << (index * 2U))) != 0) {
+                dllValue[index]    = (uint32_t)_FlexSPI_GetDLLValue(base, (int)index * 2, config);
+                base->DLLCR[index] = dllValue[index];
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 7)MCR0(モジュールイネーブル) */
+    base->MCR0 &= ~FlexSPI_MCR0_MDIS_MASK;
+
+    /* 8)STS2(DLLロック待ち) */
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        for (index = 0; index < FLEXSPI_PORT_NUM; index++) {
+            _FlexSPI_WaitDLLLock(base, index, dllValue[index]);
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SetSampleDelay                                                          */
+/*                                                                                              */
+/* DESCRIPTION: サンプリング点設定(オープン中に呼び出すこと)                                    */
+/*              DLLを遅延セル数固定とし、次回のクロック変更まで有効                             */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : chip_select                     論理QSPIデバイス番号(FLEXSPI_CS_*)              */
+/*            : rxClkSrc                        FLEXSPI_RXCLKSRC_*                              */
+/*            : ovrdVal                         DLL遅延セル数(0 - FLEXSPI_DLL_OVRDVAL_MAX)      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 実行中のコマンドがある、またはタイムアウト      */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SetSampleDelay(FlexSPI_Type *base, int chip_select, uint32_t rxClkSrc, uint32_t ovrdVal)
+{
+uint8_t index = (uint8_t)chip_select >> 1U;
+
+    /* パラメータチェック */
+    if ((base        == NULL)                           ||  /* レジスタベースアドレス未設定 */
+        (chip_select <  0)                              ||  /* 論理デバイス番号範囲外 */
+        (chip_select >= FLEXSPI_CS_NUM)                 ||
+        (rxClkSrc    >  FLEXSPI_RXCLKSRC_EXTERNAL_DQS)  ||  /* クロックソース範囲外 */
+        (ovrdVal     >  FLEXSPI_DLL_OVRDVAL_MAX)) {         /* 遅延セル数範囲外 */
+        return FLEXSPI_E_PARAM;                             /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 未完了のIPコマンドあり */
+    if (l_tDrvInfo.ptCmdHead != NULL) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 1)STS0(アイドル待ち) */
+    if (_FlexSPI_WaitIdle(base) != FLEXSPI_E_SUCCESS) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 2)MCR0(モジュールディスエーブル) */
+    base->MCR0 |= FlexSPI_MCR0_MDIS_MASK;
+
+    /* 3)MCR0(RXサンプルクロックソース設定、全デバイス共通) */
+    base->MCR0 = (base->MCR0 & ~FlexSPI_MCR0_RXCLKSRC_MASK) | FlexSPI_MCR0_RXCLKSRC(rxClkSrc);
+    l_tDrvInfo.ulRxClkSrc = rxClkSrc;
+
+    /* 4)DLLCR[n/2](遅延セル数上書き、DLLは使用しないためロック待ち不要) */
+    base->DLLCR[index] = FlexSPI_DLLCR_OVRDEN(1) | FlexSPI_DLLCR_OVRDVAL(ovrdVal);
+
+    /* 5)MCR0(モジュールイネーブル) */
+    base->MCR0 &= ~FlexSPI_MCR0_MDIS_MASK;
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_GetDeviceBase                                                           */
+/*                                                                                              */
+/* DESCRIPTION: デバイス先頭アドレス取得                                                        */
+/*              FLSHCR0に設定されたサイズをA1,A2,B1,B2の順に連結したアドレス空間での            */
+/*              先頭位置を返す                                                                  */
+/*              IPコマンドのアドレスおよびAHB窓(FLEXSPI_AMBA_BASE)からのオフセットとして使用する*/
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : chip_select                     論理QSPIデバイス番号(FLEXSPI_CS_*)              */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 先頭アドレス                          範囲外の場合は0                           */
+/*                                                                                              */
+/************************************************************************************************/
+uint32_t FlexSPI_GetDeviceBase(FlexSPI_Type *base, int chip_select)
+{
+uint32_t ulBase = 0;
+int i           = 0;
+
+    /* パラメータチェック */
+    if ((base        == NULL) ||
+        (chip_select <  0)    ||
+        (chip_select >= FLEXSPI_CS_NUM)) {
+        return 0;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* FLSHCR0はKB単位 */
+    for (i = 0; i < chip_select; i++) {
+        ulBase += (base->FLSHCR0[i] & FlexSPI_FLSHCR0_FLSHSZ_MASK) * 1024U;
+    }
+
+    return ulBase;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SetParallelMode                                                         */
+/*                                                                                              */
+/* DESCRIPTION: パラレルモード設定                                                              */
+/*              A1とB1を1つのデバイスとして同時にアクセスする(IP・AHBコマンド共通)              */
+/*              アドレス空間はA1+B1のサイズで、各デバイスにはアドレスの1/2を送る                */
+/*              データは偶数バイトがA1、奇数バイトがB1に格納される                              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : mode                            FLEXSPI_PARALLEL_ON / OFF                       */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 A1・B1以外がオープン中、実行中のコマンドがある  */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SetParallelMode(FlexSPI_Type *base, uint32_t mode)
+{
+const uint32_t ulPair = (1UL << FLEXSPI_CS_A1) | (1UL << FLEXSPI_CS_B1);
+
+    /* パラメータチェック */
+    if ((base == NULL) ||               /* レジスタベースアドレス未設定 */
+        ((mode != FLEXSPI_PARALLEL_OFF) && (mode != FLEXSPI_PARALLEL_ON))) {
+        return FLEXSPI_E_PARAM;         /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 設定済み */
+    if (l_tDrvInfo.ulParallel == mode) {
+        return FLEXSPI_E_SUCCESS;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* A1・B1の両方のみがオープン中であること */
+    if (l_tDrvInfo.ulOpenMask != ulPair) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 未完了のIPコマンドあり */
+    if (l_tDrvInfo.ptCmdHead != NULL) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* STS0(アイドル待ち) */
+    if (_FlexSPI_WaitIdle(base) != FLEXSPI_E_SUCCESS) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (mode == FLEXSPI_PARALLEL_ON) {
+        /* FLSHCR0[n](A1の領域をA1+B1に広げ、B1はアドレス空間から外す) */
+        l_tDrvInfo.ulB1Size         =  base->FLSHCR0[FLEXSPI_CS_B1];
+        base->FLSHCR0[FLEXSPI_CS_A1] += l_tDrvInfo.ulB1Size;
+        base->FLSHCR0[FLEXSPI_CS_B1] =  0;
+
+        /* AHBCR(AHBコマンドのパラレルモード) */
+        base->AHBCR |= FlexSPI_AHBCR_APAREN_MASK;
+    }
+    else {
+        /* FLSHCR0[n](個別アクセス時のサイズに戻す) */
+        base->FLSHCR0[FLEXSPI_CS_A1] -= l_tDrvInfo.ulB1Size;
+        base->FLSHCR0[FLEXSPI_CS_B1] =  l_tDrvInfo.ulB1Size;
+
+        /* AHBCR(AHBコマンドのパラレルモード解除) */
+        base->AHBCR &= ~FlexSPI_AHBCR_APAREN_MASK;
+    }
+
+    /* IPコマンドはIPCR1.IPARENで発行毎に設定する */
+    l_tDrvInfo.ulParallel = mode;
+
+    /* アドレスマップ変更後のAHBバッファを破棄 */
+    return _FlexSPI_SoftwareReset(base);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SetAHBBufferConfig                                                      */
+/*                                                                                              */
+/* DESCRIPTION: AHB RXバッファ分割設定                                                          */
+/*              AHBマスター毎にバッファを割り当て、マスター間でプリフェッチ済みデータを         */
+/*              追い出し合わないようにする                                                      */
+/*              FLEXSPI_AHB_BUFFER_DEFAULTは割り当てのない全マスターが使用する                  */
+/*              オープン前は保持のみ行い、オープン中は実行中のコマンド完了後に即時反映する      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : config                          AHB RXバッファ構成[FLEXSPI_AHB_BUFFER_NUM]      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*              FLEXSPI_E_ERROR                 実行中のコマンドがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SetAHBBufferConfig(FlexSPI_Type *base, const FlexSPI_AhbBufConfig *config)
+{
+    /* パラメータチェック */
+    if ((base == NULL) ||                   /* レジスタベースアドレス未設定 */
+        (FlexSPI_CheckAHBBufferConfig(config) != FLEXSPI_E_SUCCESS)) {
+        return FLEXSPI_E_PARAM;             /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    memcpy(l_tDrvInfo.tAhbBuf, config, sizeof(l_tDrvInfo.tAhbBuf));
+
+    /* 未オープン時はFlexSPI_Openで反映する */
+    if (l_tDrvInfo.ulOpenMask == 0U) {
+        return FLEXSPI_E_SUCCESS;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 未完了のIPコマンドあり */
+    if (l_tDrvInfo.ptCmdHead != NULL) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* STS0(アイドル待ち) */
+    if (_FlexSPI_WaitIdle(base) != FLEXSPI_E_SUCCESS) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* AHBRXBUFCR0[0]-[7](バッファ設定) */
+    _FlexSPI_SetAHBBuffer(base);
+
+    /* 分割変更前のAHBバッファを破棄 */
+    return _FlexSPI_SoftwareReset(base);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_GetAHBBufferConfig                                                      */
+/*                                                                                              */
+/* DESCRIPTION: AHB RXバッファ分割取得                                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : config                          AHB RXバッファ構成[FLEXSPI_AHB_BUFFER_NUM]      */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+void FlexSPI_GetAHBBufferConfig(FlexSPI_AhbBufConfig *config)
+{
+    if (config != NULL) {
+        memcpy(config, l_tDrvInfo.tAhbBuf, sizeof(l_tDrvInfo.tAhbBuf));
+    }
+    else {
+        ;   /* do nothing */
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_ReadAHB                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: AHB窓からの読み出し(メモリマップド読み出し)                                     */
+/*              AHB読み出しシーケンス(FLSHCR2.ARDSEQID)でデバイスを読み出し、バッファへ複写する */
+/*              複写後はプリフェッチの完了を待ち、続くIPコマンドと重ならないようにする          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : address                         読み出しアドレス(AHB窓の先頭からのオフセット)   */
+/*            : size                            読み出しデータ長                                */
+/*                                                                                              */
+/* OUTPUT     : buf                             読み出しデータ格納バッファ                      */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*              FLEXSPI_E_ERROR                 コントローラーがアイドルにならない              */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_ReadAHB(FlexSPI_Type *base, uint32_t address, unsigned char *buf, uint32_t size)
+{
+uint32_t ulEnd = 0;
+int i          = 0;
+
+    /* パラメータチェック */
+    if ((base == NULL) ||               /* レジスタベースアドレス未設定 */
+        (buf  == NULL) ||               /* バッファ未設定 */
+        (l_tDrvInfo.ulOpenMask == 0U)) {    /* 未オープン */
+        return FLEXSPI_E_PARAM;         /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* AHB窓の終端(FLSHCR0に設定された全デバイスのサイズの和、KB単位) */
+    for (i = 0; i < FLEXSPI_CS_NUM; i++) {
+        ulEnd += (base->FLSHCR0[i] & FlexSPI_FLSHCR0_FLSHSZ_MASK) * 1024U;
+    }
+    if ((ulEnd <= address) ||           /* 開始アドレスがAHB窓の範囲外 */
+        ((ulEnd - address) < size)) {   /* 終端がAHB窓の範囲外 */
+        return FLEXSPI_E_PARAM;         /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* AHB窓から複写 */
+    memcpy(buf, (const void*)(FLEXSPI_AMBA_BASE + address), size);
+
+    /* STS0(プリフェッチ完了待ち) */
+    return _FlexSPI_WaitIdle(base);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_InvalidateAHB                                                           */
+/*                                                                                              */
+/* DESCRIPTION: AHB読み出しデータ破棄                                                           */
+/*              書き込み・消去した範囲のデータキャッシュを無効化し、AHB RXバッファを破棄する    */
+/*              (AHBCR.CLRAHBRXBUFでAHB RXバッファのみを破棄し、ソフトウェアリセットはしない)   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : address                         書き込み・消去したアドレス                      */
+/*                                               (AHB窓の先頭からのオフセット)                  */
+/*            : size                            書き込み・消去したデータ長                      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*              FLEXSPI_E_ERROR                 実行中のコマンドがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_InvalidateAHB(FlexSPI_Type *base, uint32_t address, uint32_t size)
+{
+    /* パラメータチェック */
+    if (base == NULL) {                 /* レジスタベースアドレス未設定 */
+        return FLEXSPI_E_PARAM;         /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 未完了のIPコマンドあり */
+    if (l_tDrvInfo.ptCmdHead != NULL) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* STS0(アイドル待ち) */
+    if (_FlexSPI_WaitIdle(base) != FLEXSPI_E_SUCCESS) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* データキャッシュ無効化(AHB窓がキャッシュ可能領域の場合) */
+    _FlexSPI_InvalidateDCache((const void*)(FLEXSPI_AMBA_BASE + address), size);
+
+    /* AHB RXバッファ破棄 */
+    return _FlexSPI_ClearAHBBuffer(base);
+}
+
+/****************************************************************************/
+/*  ローカル関数                                                            */
+/****************************************************************************/
+/************************************************************************************************/
+/* FUNCTION   : __FlexSPI_SoftwareReset                                                         */
+/*                                                                                              */
+/* DESCRIPTION: ソフトウェアリセット                                                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 エラー                                          */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_SoftwareReset(FlexSPI_Type *base)
+{
+FLGPTN tFlgPtn = 0;
+uint32_t i     = 0;
+
+    /* ソフトウェアリセット */
+    base->MCR0 |= FlexSPI_MCR0_SWRESET_MASK;
+
+    for (i = 0; i < FLEXSPI_MAX_RETRY; i++) {
+        /* フラグチェック */
+        if ((base->MCR0 & FlexSPI_MCR0_SWRESET_MASK) == 0) {
+            return FLEXSPI_E_SUCCESS;
+        }
+        else {
+            twai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, 1);
+        }
+    }
+
+    return FLEXSPI_E_ERROR;     /* FlexSPIコントローラー異常 */
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_ClearAHBBuffer                                                         */
+/*                                                                                              */
+/* DESCRIPTION: AHB RXバッファ破棄                                                              */
+/*              AHB RXバッファの状態・ポインタのみをクリアする(IP側のFIFO・設定は保持)          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 エラー                                          */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_ClearAHBBuffer(FlexSPI_Type *base)
+{
+FLGPTN tFlgPtn = 0;
+uint32_t i     = 0;
+
+    /* AHBCR(AHB RXバッファクリア、完了で自動的に0に戻る) */
+    base->AHBCR |= FlexSPI_AHBCR_CLRAHBRXBUF_MASK;
+
+    for (i = 0; i < FLEXSPI_MAX_RETRY; i++) {
+        /* フラグチェック */
+        if ((base->AHBCR & FlexSPI_AHBCR_CLRAHBRXBUF_MASK) == 0) {
+            return FLEXSPI_E_SUCCESS;
+        }
+        else {
+            twai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, 1);
+        }
+    }
+
+    return FLEXSPI_E_ERROR;     /* FlexSPIコントローラー異常 */
+}
+
+/************************************************************************************************/
+/* FUNCTION   : __FlexSPI_SetConfig                                                             */
+/*                                                                                              */
+/* DESCRIPTION: レジスタ設定(MCR0 - 2)                                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_SetConfig(FlexSPI_Type *base)
+{
+uint32_t ulReg     = 0;
+uint32_t ulCombine = 0;
+
+    /* Octalデバイスはコンビネーションモード(ポートAとポートBのデータ線を結合) */
+    if (FlexSPI_GetDeviceType() != FLEXSPI_DEVICE_QUAD) {
+        ulCombine = 1;
+    }
+    else {
+        ulCombine = 0;
+    }
+
+    /* 2)MCR0(レジスタ設定) */
+    ulReg =  base->MCR0;
+    ulReg &= ~(FlexSPI_MCR0_LEARNEN_MASK       |
+               FlexSPI_MCR0_SCKFREERUNEN_MASK  |
+               FlexSPI_MCR0_COMBINATIONEN_MASK |
+               FlexSPI_MCR0_RXCLKSRC_MASK      |
+               FlexSPI_MCR0_RESERVED_MASK      |
+               FlexSPI_MCR0_MDIS_MASK          |
+               FlexSPI_MCR0_SWRESET_MASK);
+    ulReg |= (FlexSPI_MCR0_AHBGRANTWAIT_MASK        |   /* NOTE: Debug only Please default value */
+              FlexSPI_MCR0_IPGRANTWAIT_MASK         |   /* NOTE: Debug only Please default value */
+              FlexSPI_MCR0_SCKFREERUNEN(0)          |
+              FlexSPI_MCR0_COMBINATIONEN(ulCombine) |
+              FlexSPI_MCR0_DOZEEN(0)                |
+              FlexSPI_MCR0_HSEN(1)                  |
+              FlexSPI_MCR0_ATDFEN(0)                |
+              FlexSPI_MCR0_ARDFEN(0)                |
+              FlexSPI_MCR0_RXCLKSRC(l_tDrvInfo.ulRxClkSrc));
+    base->MCR0 = ulReg;
+
+    /* 3)MCR1(レジスタ設定e) */
+    ulReg =  base->MCR1;
+    ulReg &= ~(FlexSPI_MCR1_SEQWAIT_MASK | FlexSPI_MCR1_AHBBUSWAIT_MASK);
+    ulReg |= (FlexSPI_MCR1_SEQWAIT(0x00FFU) |
+              FlexSPI_MCR1_AHBBUSWAIT(0xFFFFU));
+    base->MCR1 = ulReg;
+
+    /* 4)MCR2(レジスタ設定) */
+    ulReg =  base->MCR2;
+    ulReg &= ~(FlexSPI_MCR2_RESUMEWAIT_MASK   |
+               FlexSPI_MCR2_SCKBDIFFOPT_MASK  |
+               FlexSPI_MCR2_SAMEDEVICEEN_MASK |
+               FlexSPI_MCR2_CLRAHBBUFOPT_MASK);
+    ulReg |= (FlexSPI_MCR2_RESUMEWAIT(0x20U) |
+              FlexSPI_MCR2_SCKBDIFFOPT(0)    |
+              FlexSPI_MCR2_SAMEDEVICEEN(0)   |
+              FlexSPI_MCR2_CLRAHBBUFOPT(0));
+    base->MCR2 = ulReg;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : __FlexSPI_SetCS                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: レジスタ設定(MCR0 - 2)                                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*            : FLEXSPI_E_ERROR                 エラー                                          */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_SetCS(FlexSPI_Type *base, int chip_select, const flexspi_device_config_t *config)
+{
+uint32_t configValue = 0;
+uint8_t index        = (uint8_t)chip_select >> 1U; /* PortA with index 0, PortB with index 1. */
+
+    /* 5)STS0(アイドル待ち) */
+    if (_FlexSPI_WaitIdle(base) != FLEXSPI_E_SUCCESS) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 6)FLSHCR0[n](コンフィギュレーション情報設定) */
+    base->FLSHCR0[chip_select] = config->flashSize;
+
+    /* 7)FLSHCR1[n](コンフィギュレーション情報設定) */
+    base->FLSHCR1[chip_select] = (FlexSPI_FLSHCR1_CSINTERVAL(config->CSInterval)         |
+                                  FlexSPI_FLSHCR1_CSINTERVALUNIT(config->CSIntervalUnit) |
+                                  FlexSPI_FLSHCR1_CAS(config->columnspace)               |
+                                  FlexSPI_FLSHCR1_WA(config->enableWordAddress)          |
+                                  FlexSPI_FLSHCR1_TCSH(config->CSHoldTime)               |
+                                  FlexSPI_FLSHCR1_TCSS(config->CSSetupTime));
+	
+    /* 8)FLSHCR2[n](コンフィギュレーション情報設定) */
+    configValue = base->FLSHCR2[chip_select];
+
+    configValue &= ~(FlexSPI_FLSHCR2_AWRWAITUNIT_MASK |
+                     FlexSPI_FLSHCR2_AWRWAIT_MASK     |
+                     FlexSPI_FLSHCR2_AWRSEQNUM_MASK   |
+                     FlexSPI_FLSHCR2_AWRSEQID_MASK    |
+                     FlexSPI_FLSHCR2_ARDSEQNUM_MASK   |
+                     FlexSPI_FLSHCR2_ARDSEQID_MASK);
+
+    configValue |= (FlexSPI_FLSHCR2_AWRWAITUNIT(config->AHBWriteWaitUnit) |
+                    FlexSPI_FLSHCR2_AWRWAIT(config->AHBWriteWaitInterval));
+
+    if (0 < config->AWRSeqNumber) {
+        configValue |= (FlexSPI_FLSHCR2_AWRSEQID((uint32_t)config->AWRSeqIndex) |
+                        FlexSPI_FLSHCR2_AWRSEQNUM((uint32_t)config->AWRSeqNumber - 1U));
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (0 < config->ARDSeqNumber) {
+        configValue |= (FlexSPI_FLSHCR2_ARDSEQID((uint32_t)config->ARDSeqIndex) |
+                        FlexSPI_FLSHCR2_ARDSEQNUM((uint32_t)config->ARDSeqNumber - 1U));
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    base->FLSHCR2[chip_select] = configValue;
+
+    /* 9)DLLCR[n/2](レジスタ設定) */
+    configValue        = _FlexSPI_GetDLLValue(base, chip_select, config);
+    base->DLLCR[index] = configValue;
+
+    /* 10)FLSHCR4(コンフィギュレーション情報設定) */
+    if (config->enableWriteMask) {
+        base->FLSHCR4 &= ~FlexSPI_FLSHCR4_WMOPT1_MASK;
+    }
+    else {
+        base->FLSHCR4 |= FlexSPI_FLSHCR4_WMOPT1_MASK;
+    }
+
+    if (index == 0U) {
+         /*PortA*/
+        base->FLSHCR4 &= ~FlexSPI_FLSHCR4_WMENA_MASK;
+        base->FLSHCR4 |= FlexSPI_FLSHCR4_WMENA(config->enableWriteMask);
+    }
+    else {
+        base->FLSHCR4 &= ~FlexSPI_FLSHCR4_WMENB_MASK;
+        base->FLSHCR4 |= FlexSPI_FLSHCR4_WMENB(config->enableWriteMask);
+    }
+
+    /* 11)MCR0(モジュールイネーブル) */
+    base->MCR0 &= ~FlexSPI_MCR0_MDIS_MASK;
+
+    /* DLLロック待ち */
+    _FlexSPI_WaitDLLLock(base, index, configValue);
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : __FlexSPI_GetDLLValue                                                           */
+/*                                                                                              */
+/* DESCRIPTION: DLLレジスタ値取得                                                               */
+/*              内部ループバック時は固定遅延、それ以外はSCLK周波数に応じてDLLを設定する         */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : DLL設定値                                                                       */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_GetDLLValue(FlexSPI_Type *base, int chip_select, const flexspi_device_config_t *config)
+{
+uint32_t isUnifiedConfig = 0;
+uint32_t flexspiDllValue = 0;
+uint32_t dllValue        = 0;
+uint32_t temp            = 0;
+
+    /* 内部ループバックはサンプリング点を調整できないため固定遅延とする */
+    if ((base->MCR0 & FlexSPI_MCR0_RXCLKSRC_MASK) ==
+        FlexSPI_MCR0_RXCLKSRC(FLEXSPI_RXCLKSRC_LOOPBACK_INTERNAL)) {
+        isUnifiedConfig = 1;
+    }
+    else {
+        isUnifiedConfig = 0;
+    }
+
+    if (isUnifiedConfig != 0) {
+        flexspiDllValue = FLEXSPI_DLLCR_DEFAULT; /* 1 fixed delay cells in DLL delay chain) */
+    }
+    else {
+        if ((100U * FREQ_1MHz) <= config->flexspiRootClk) {
+            /* DLLEN = 1, SLVDLYTARGET = 0xF, */
+            flexspiDllValue = FlexSPI_DLLCR_DLLEN(1) | FlexSPI_DLLCR_SLVDLYTARGET(0x0F);
+        }
+        else {
+            temp     = (uint32_t)config->dataValidTime * 1000U; /* Convert data valid time in ns to ps. */
+            dllValue = temp / (uint32_t)kFLEXSPI_DelayCellUnitMin;
+            if (dllValue * (uint32_t)kFLEXSPI_DelayCellUnitMin < temp) {
+                dllValue++;
+            }
+            else {
+                ;   /* do nothing */
+            }
+            flexspiDllValue = FlexSPI_DLLCR_OVRDEN(1) | FlexSPI_DLLCR_OVRDVAL(dllValue);
+        }
+    }
+    return flexspiDllValue;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_WaitIdle                                                               */
+/*                                                                                              */
+/* DESCRIPTION: アイドル待ち(アービタ・シーケンサ)                                              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 タイムアウト                                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_WaitIdle(FlexSPI_Type *base)
+{
+FLGPTN tFlgPtn = 0;
+uint32_t i     = 0;
+
+    for (i = 0; i < FLEXSPI_MAX_RETRY; i++) {
+        if (((base->STS0 & FlexSPI_STS0_ARBIDLE_MASK) != 0) &&
+            ((base->STS0 & FlexSPI_STS0_SEQIDLE_MASK) != 0)) {
+            return FLEXSPI_E_SUCCESS;
+        }
+        else {
+            twai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, 1);
+        }
+    }
+
+    return FLEXSPI_E_ERROR;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_WaitDLLLock                                                            */
+/*                                                                                              */
+/* DESCRIPTION: DLLロック待ち(DLL有効時のみ)                                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : index                           ポート番号(0:PortA, 1:PortB)                    */
+/*            : dllValue                        DLLCR設定値                                     */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_WaitDLLLock(FlexSPI_Type *base, uint8_t index, uint32_t dllValue)
+{
+uint32_t statusValue = 0;
+uint8_t delay        = 0;
+
+    /* According to ERR011377, need to delay at least 100 NOPs to ensure the DLL is locked. */
+    statusValue = (index == 0U) ?
+                   ((uint32_t)kFlexSPI_FlashASampleClockSlaveDelayLocked |
+                    (uint32_t)kFlexSPI_FlashASampleClockRefDelayLocked) :
+                   ((uint32_t)kFlexSPI_FlashBSampleClockSlaveDelayLocked |
+                    (uint32_t)kFlexSPI_FlashBSampleClockRefDelayLocked);
+
+    if ((dllValue & FlexSPI_DLLCR_DLLEN_MASK) != 0U) {
+        /* Wait slave delay line locked and slave reference delay line locked. */
+        while ((base->STS2 & statusValue) != statusValue) {
+            //PRINT("SLAVE WAIT\r\n");
+        }
+
+        /* Wait at least 100 NOPs*/
+        for (delay = 100U; delay > 0U; delay--) {
+            __NOP();
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_OpenCS                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: チップセレクト追加(コントローラーは動作中のまま、対象デバイスのみ設定する)      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : chip_select                     論理QSPIデバイス番号(FLEXSPI_CS_*)              */
+/*            : config                          デバイスコンフィギュレーション情報              */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 実行中のコマンドがある、またはタイムアウト      */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_OpenCS(FlexSPI_Type *base, int chip_select, const flexspi_device_config_t *config)
+{
+int iRet = FLEXSPI_E_ERROR;
+
+    /* 未完了のIPコマンドあり */
+    if (l_tDrvInfo.ptCmdHead != NULL) {
+        return FLEXSPI_E_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 6)-11)FLSHCR0-2[n]・DLLCR[n/2]・FLSHCR4(コンフィギュレーション指定) */
+    iRet = _FlexSPI_SetCS(base, chip_select, config);
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        return iRet;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 16)FLSHCR2[n](AHB読み出しシーケンス) */
+    _FlexSPI_SetAHBReadSeq(base, chip_select, config);
+
+    /* アドレスマップ変更後のAHBバッファを破棄 */
+    iRet = _FlexSPI_SoftwareReset(base);
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        return iRet;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    l_tDrvInfo.ulOpenMask |= (1UL << chip_select);
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SetAHBReadSeq                                                          */
+/*                                                                                              */
+/* DESCRIPTION: AHB読み出しシーケンス設定(FLSHCR2[n].ARDSEQID/ARDSEQNUM)                        */
+/*              コンフィギュレーション情報で指定がなければFLEXSPI_SEQ_AHB_READとする            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : chip_select                     論理QSPIデバイス番号(FLEXSPI_CS_*)              */
+/*            : config                          デバイスコンフィギュレーション情報              */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_SetAHBReadSeq(FlexSPI_Type *base, int chip_select, const flexspi_device_config_t *config)
+{
+uint32_t configValue = base->FLSHCR2[chip_select];
+
+    configValue &= ~(FlexSPI_FLSHCR2_ARDSEQNUM_MASK | FlexSPI_FLSHCR2_ARDSEQID_MASK);
+
+    if (0 < config->ARDSeqNumber) {
+        configValue |= (FlexSPI_FLSHCR2_ARDSEQID((uint32_t)config->ARDSeqIndex) |
+                        FlexSPI_FLSHCR2_ARDSEQNUM((uint32_t)config->ARDSeqNumber - 1U));
+    }
+    else {
+        configValue |= FlexSPI_FLSHCR2_ARDSEQID(FLEXSPI_SEQ_AHB_READ);
+    }
+
+    base->FLSHCR2[chip_select] = configValue;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : __FlexSPI_SetAHBConfig                                                          */
+/*                                                                                              */
+/* DESCRIPTION: AHB設定                                                                         */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_SetAHBConfig(FlexSPI_Type *base)
+{
+	/* 12)LUT(全シーケンスを一括設定、AHB読み出しはFLEXSPI_SEQ_AHB_READ) */
+	FlexSPI_LoadLUTTable(base);
+
+    /* 13)-14)AHBRXBUFCR0[0]-[7](バッファ設定) */
+    _FlexSPI_SetAHBBuffer(base);
+
+	/* 15)AHBCR(プリフェッチ設定) */
+	base->AHBCR = FlexSPI_AHBCR_PREFETCHEN_MASK;
+
+    /* 16)FLSHCR2[n](LUTシーケンス設定はFlexSPI_Openでチップセレクト毎に行う) */
+
+    /* 17)IPRXFCR(RX FIFO設定) */
+    base->IPRXFCR &= ~FlexSPI_IPRXFCR_RXDMAEN_MASK;
+    base->IPRXFCR &= ~FlexSPI_IPRXFCR_RXWMRK_MASK;
+    base->IPRXFCR |= FlexSPI_IPRXFCR_RXWMRK(l_tDrvInfo.ulRxWatermark / 8U - 1U);
 
-    /* 割り込みステータスクリア */
-    base->INTR |= FlexSPI_INTR_IPCMDDONE(1);
+    /* 18)IPTXFCR(TX FIFO設定) */
+    base->IPTXFCR &= ~FlexSPI_IPTXFCR_TXDMAEN_MASK;
+    base->IPTXFCR &= ~FlexSPI_IPTXFCR_TXWMRK_MASK;
+    base->IPTXFCR |= FlexSPI_IPTXFCR_TXWMRK(l_tDrvInfo.ulTxWatermark / 8U - 1U);
+}
 
-    /* 割り込みイネーブル */
-    base->INTEN |= FlexSPI_INTEN_IPCMDDONEEN(1);
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SetAHBBuffer                                                           */
+/*                                                                                              */
+/* DESCRIPTION: AHB RXバッファ設定(AHBRXBUFCR0[0]-[7])                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_SetAHBBuffer(FlexSPI_Type *base)
+{
+const FlexSPI_AhbBufConfig *ptBuf = NULL;
+uint32_t i                        = 0;
+uint32_t ulReg                    = 0;
+
+    for (i = 0; i < FLEXSPI_AHB_BUFFER_NUM; i++) {
+        ptBuf = &l_tDrvInfo.tAhbBuf[i];
+        ulReg = FlexSPI_AHBRXBUFCR0_BUFSZ(ptBuf->ulSize / 8U)   |
+                FlexSPI_AHBRXBUFCR0_MSTRID(ptBuf->ulMasterId)   |
+                FlexSPI_AHBRXBUFCR0_PRIORITY(ptBuf->ulPriority);
+        if (ptBuf->ulPrefetch != 0U) {
+            ulReg |= FlexSPI_AHBRXBUFCR0_PREFETCHEN_MASK;
+        }
+        else {
+            ;   /* do nothing */
+        }
+        base->AHBRXBUFCR0[i] = ulReg;
+    }
+}
 
-    /* 割り込み許可 */
-    tRet = ena_int(INTNO_QSPI);
-    if (tRet != E_OK) {
-        goto err_end;   /* 割り込み許可エラー */
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_WaitFifo                                                               */
+/*                                                                                              */
+/* DESCRIPTION: FIFOウォーターマーク待ち                                                        */
+/*              既に条件成立していれば即時復帰し、未成立時のみ割り込みで起床を待つ              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : ulIntrMask                      待ち対象のINTRビット(IPRXWA / IPTXWE)           */
+/*            : ulIntenMask                     対応するINTENビット(IPRXWAEN / IPTXWEEN)        */
+/*            : tEvfBit                         対応するイベントフラグビット                    */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 タイムアウト                                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_WaitFifo(FlexSPI_Type *base, uint32_t ulIntrMask, uint32_t ulIntenMask, FLGPTN tEvfBit)
+{
+FLGPTN tFlgPtn = 0;
+int iRet       = FLEXSPI_E_ERROR;
+
+    /* 条件成立済み */
+    if ((base->INTR & ulIntrMask) != 0U) {
+        return FLEXSPI_E_SUCCESS;
     }
     else {
         ;   /* do nothing */
     }
 
-    /* 5)IPCMD(コマンド実行) */
-    base->IPCMD |= FlexSPI_IPCMD_TRG(1);
+    /* イベントフラグクリア */
+    clr_flg(l_tDrvInfo.tFlgID, ~tEvfBit);
+
+    /* 割り込みイネーブル(ISRでマスクされる) */
+    base->INTEN |= ulIntenMask;
 
-    /* 6)INTR(SPI転送完了チェック) */
-    if ((base->INTR & FlexSPI_INTR_IPCMDDONE_MASK) == 0U) {
-        wai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_DONE, TWF_ORW, &tFlgPtn);
+    /* 割り込みイネーブルとの競合を考慮して再チェック */
+    if ((base->INTR & ulIntrMask) == 0U) {
+        twai_flg(l_tDrvInfo.tFlgID, tEvfBit, TWF_ORW, &tFlgPtn, FLEXSPI_FIFO_TIMEOUT);
     }
     else {
         ;   /* do nothing */
     }
 
-    /* 割り込み禁止 */
-    tRet = dis_int(INTNO_QSPI);
-    if (tRet != E_OK) {
-        goto err_end;   /* 割り込み禁止エラー */
+    /* 割り込みマスク */
+    base->INTEN &= ~ulIntenMask;
+
+    if ((base->INTR & ulIntrMask) != 0U) {
+        iRet = FLEXSPI_E_SUCCESS;
     }
     else {
-        ;   /* do nothing */
+        iRet = FLEXSPI_E_ERROR;     /* タイムアウト */
     }
 
-    iRet = FLEXSPI_E_SUCCESS;
+    return iRet;
+}
 
-err_end:
-	return iRet;
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_DrainRxFifo                                                            */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFOより読み出し(CPU)                                                        */
+/*              IPRXWA1回につきウォーターマーク分のRFDRをまとめて読み出し、INTR.IPRXWAで        */
+/*              次のブロックへ進める(ウォーターマーク未満の端数はIPRXFSTS.FILLで待つ)           */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : size                            読み出し長                                      */
+/*                                                                                              */
+/* OUTPUT     : buf                             データ格納バッファ                              */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 タイムアウト                                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_DrainRxFifo(FlexSPI_Type *base, unsigned char *buf, uint32_t size)
+{
+uint32_t ulBlock = 0;
+int iRet         = FLEXSPI_E_ERROR;
+
+    while (0U < size) {
+        /* 1回の読み出しサイズ(ウォーターマーク単位) */
+        ulBlock = (l_tDrvInfo.ulRxWatermark < size) ? l_tDrvInfo.ulRxWatermark : size;
+
+        /* RX FIFOデータ待ち */
+        iRet = _FlexSPI_WaitRxBlock(base, ulBlock);
+        if (iRet != FLEXSPI_E_SUCCESS) {
+            return FLEXSPI_E_ERROR; /* タイムアウト */
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        /* RFDRより取得 */
+        FlexSPI_CopyRxBlock(base, buf, ulBlock);
+
+        /* INTR(読み出し済みブロックを解放し次のブロックへ) */
+        base->INTR |= FlexSPI_INTR_IPRXWA(1);
+
+        buf  += ulBlock;
+        size -= ulBlock;
+    }
+
+    return FLEXSPI_E_SUCCESS;
 }
 
 /************************************************************************************************/
-/* FUNCTION   : FlexSPI_ExecCommandAndRead                                                      */
+/* FUNCTION   : _FlexSPI_WaitRxBlock                                                            */
 /*                                                                                              */
-/* DESCRIPTION: コマンド実行&読み出し                                                           */
+/* DESCRIPTION: RX FIFOデータ待ち(1ブロック)                                                    */
+/*              ウォーターマーク分はIPRXWA割り込みで待つ。ウォーターマーク未満の端数では        */
+/*              IPRXWAが立たないため、IPRXFSTS.FILLが端数に達するまで確認する                   */
+/*              (端数は転送の最後のため、短時間は休止せずに確認し、以降は1tick毎に確認する)     */
 /*----------------------------------------------------------------------------------------------*/
 /* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
-/*            : address                         SPI転送デバイスアドレス                         */
-/*            : byteLength                      書き込み長                                      */
+/*            : ulBlock                         読み出すブロック長(ウォーターマーク以下)        */
 /*                                                                                              */
 /* OUTPUT     : none                                                                            */
 /*                                                                                              */
-/* RESULTS    : 0xFF以外                        正常終了(戻り値は読み出しデータ)                */
-/*              0xFF                            エラー                                          */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 タイムアウト                                    */
 /*                                                                                              */
 /************************************************************************************************/
-unsigned char FlexSPI_ExecCommandAndRead(FlexSPI_Type *base, uint32_t address, uint32_t byteLength)
+LOCAL int _FlexSPI_WaitRxBlock(FlexSPI_Type *base, uint32_t ulBlock)
 {
-FLGPTN tFlgPtn         = 0;
-ER  tRet               = E_SYS;
-int iRet               = 0;
-unsigned char ucStatus = 0xFF;
+FLGPTN tFlgPtn   = 0;
+uint32_t ulRetry = 0;
 
-    /* パラメータチェック */
-    if (base == NULL) {         /* レジスタベースアドレス未設定 */ 
-        return ucStatus;        /* パラメータエラー */
+    /* ウォーターマーク分(IPRXWA) */
+    if (l_tDrvInfo.ulRxWatermark <= ulBlock) {
+        return _FlexSPI_WaitFifo(base, FlexSPI_INTR_IPRXWA_MASK, FlexSPI_INTEN_IPRXWAEN_MASK, FLEXSPI_EVFBIT_RX);
     }
     else {
         ;   /* do nothing */
     }
 
-    /* FlexSPIコントローラーレジスタアクセス */
-
-    /* 1)IPCR0(SPI転送アドレス設定) */
-    base->IPCR0 = address;
+    /* 端数(IPRXFSTS.FILL) */
+    for (ulRetry = 0; ulRetry < (FLEXSPI_RX_POLL_SPIN + FLEXSPI_MAX_RETRY); ulRetry++) {
+        if (FlexSPI_IsRxBlockReady(base->INTR, base->IPRXFSTS, ulBlock, l_tDrvInfo.ulRxWatermark) != 0U) {
+            return FLEXSPI_E_SUCCESS;
+        }
+        else if (FLEXSPI_RX_POLL_SPIN <= ulRetry) {
+            twai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, 1);
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
 
-    /* 2)IPCR1(SPI転送サイズ設定) */
-    base->IPCR1 &= ~(uint32_t)FlexSPI_IPCR1_IDATSZ_MASK;
-    base->IPCR1 |= FlexSPI_IPCR1_IDATSZ(byteLength);
+    return FLEXSPI_E_ERROR;     /* タイムアウト */
+}
 
-    /* 3)IPRXFCR(RX FIFOクリア) */
-    base->IPRXFCR |= FlexSPI_IPRXFCR_CLRIPRXF(1);
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_EnqueueCommand                                                         */
+/*                                                                                              */
+/* DESCRIPTION: IPコマンド登録(CPUロック中または割り込みコンテキストから呼び出す)               */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : desc                            IPコマンド記述子                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 記述子が登録済み                                */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_EnqueueCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc)
+{
+int iRet = FLEXSPI_E_ERROR;
 
-    /* 4)INTR(RX FIFOフルフラグクリア) */
-    base->INTR |= FlexSPI_INTR_IPRXWA(1);
+    /* パラメータチェック */
+    if ((base  == NULL) ||                                  /* レジスタベースアドレス未設定 */
+        (desc  == NULL) ||                                  /* 記述子未設定 */
+        (desc->ulSeqId >= FLEXSPI_SEQ_MAX) ||               /* LUTシーケンス番号範囲外 */
+        (desc->ulDir   >  FLEXSPI_CMD_DIR_WRITE) ||         /* データ転送方向不正 */
+        ((desc->ulDir != FLEXSPI_CMD_DIR_NONE) &&
+         ((desc->pucBuf   == NULL) ||                       /* データバッファ未設定 */
+          (desc->ulLength == 0U)   ||                       /* データ長がゼロ */
+          (desc->ulLength >  FLEXSPI_CMD_DATA_MAX)))) {     /* FIFOに収まらない */
+        return FLEXSPI_E_PARAM;                             /* パラメータエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
 
-    /* イベントフラグクリア */
-    clr_flg(l_tDrvInfo.tFlgID, ~FLEXSPI_EVFBIT_DONE);
+    if ((desc->ulState == FLEXSPI_CMD_STATE_QUEUED) ||
+        (desc->ulState == FLEXSPI_CMD_STATE_ACTIVE)) {
+        iRet = FLEXSPI_E_ERROR;     /* 登録済み */
+    }
+    else {
+        desc->ulState    = FLEXSPI_CMD_STATE_QUEUED;
+        desc->iResult    = FLEXSPI_E_ERROR;
+        desc->iWaitTskId = TSK_NONE;
+        desc->ptNext     = NULL;
+
+        /* キュー末尾に追加 */
+        if (l_tDrvInfo.ptCmdHead == NULL) {
+            l_tDrvInfo.ptCmdHead = desc;
+            l_tDrvInfo.ptCmdTail = desc;
+
+            /* コントローラー空きのため即時開始 */
+            _FlexSPI_StartCommand(base, desc);
+        }
+        else {
+            l_tDrvInfo.ptCmdTail->ptNext = desc;
+            l_tDrvInfo.ptCmdTail         = desc;
+        }
+        iRet = FLEXSPI_E_SUCCESS;
+    }
 
-    /* 割り込みステータスクリア */
-    base->INTR |= FlexSPI_INTR_IPCMDDONE(1);
+    return iRet;
+}
 
-    /* 割り込みイネーブル */
-    base->INTEN |= FlexSPI_INTEN_IPCMDDONEEN(1);
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_ReserveCommand                                                         */
+/*                                                                                              */
+/* DESCRIPTION: IPコマンドキュー予約                                                            */
+/*              キューが空の場合のみ記述子を先頭に登録し、開始はせずに保持する                  */
+/*              (登録後に呼び出し元がFIFOを準備し、_FlexSPI_StartCommandで開始する。            */
+/*               以降に登録されたコマンドは本コマンドの完了後に開始される)                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : desc                            IPコマンド記述子                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 実行中・実行待ちのコマンドがある                */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_ReserveCommand(FlexSPI_CmdDesc *desc)
+{
+int iRet = FLEXSPI_E_ERROR;
 
-    /* 割り込み許可 */
-    tRet = ena_int(INTNO_QSPI);
-    if (tRet != E_OK) {
-        goto err_end;   /* 割り込み許可エラー */
+    loc_cpu();
+    if (l_tDrvInfo.ptCmdHead == NULL) {
+        desc->pfnCallback    = NULL;
+        desc->ulState        = FLEXSPI_CMD_STATE_QUEUED;
+        desc->iResult        = FLEXSPI_E_ERROR;
+        desc->iWaitTskId     = TSK_NONE;
+        desc->ptNext         = NULL;
+        l_tDrvInfo.ptCmdHead = desc;
+        l_tDrvInfo.ptCmdTail = desc;
+        iRet = FLEXSPI_E_SUCCESS;
     }
     else {
         ;   /* do nothing */
     }
+    unl_cpu();
 
-    /* 5)IPCMD(コマンド実行) */
-    base->IPCMD |= FlexSPI_IPCMD_TRG(1);
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_ExecSync                                                               */
+/*                                                                                              */
+/* DESCRIPTION: IPコマンド同期実行(キューに登録し完了を待つ)                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : desc                            IPコマンド記述子                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 コマンドエラー・タイムアウト                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_ExecSync(FlexSPI_Type *base, FlexSPI_CmdDesc *desc)
+{
+int iRet = FLEXSPI_E_ERROR;
+
+    /* 完了は待ちタスクの起床で通知させる */
+    desc->pfnCallback = NULL;
 
-    /* 6)INTR(SPI転送完了チェック) */
-    if ((base->INTR & FlexSPI_INTR_IPCMDDONE_MASK) == 0U) {
-        wai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_DONE, TWF_ORW, &tFlgPtn);
+    /* キューに登録 */
+    iRet = FlexSPI_SubmitCommand(base, desc);
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        return iRet;
     }
     else {
         ;   /* do nothing */
     }
 
-    /* 割り込み禁止 */
-    tRet = dis_int(INTNO_QSPI);
-    if (tRet != E_OK) {
-        goto err_end;   /* 割り込み禁止エラー */
+    return _FlexSPI_WaitCommand(base, desc);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_WaitCommand                                                            */
+/*                                                                                              */
+/* DESCRIPTION: IPコマンド完了待ち(完了通知関数なしで登録したコマンド)                          */
+/*              記述子に待ちタスクを登録し、完了割り込みで本タスクのみを起床させる              */
+/*              タイムアウト時はキューから取り消す                                              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : desc                            IPコマンド記述子                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 コマンド実行エラー・タイムアウト                */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_WaitCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc)
+{
+ID tTskId = TSK_NONE;
+ER tRet   = E_OK;
+int iRet  = FLEXSPI_E_ERROR;
+
+    /* 待ちタスク登録(完了済みでなければ、完了割り込みが本タスクを起床する) */
+    get_tid(&tTskId);
+    loc_cpu();
+    if (desc->ulState != FLEXSPI_CMD_STATE_DONE) {
+        desc->iWaitTskId = tTskId;
     }
     else {
         ;   /* do nothing */
     }
+    unl_cpu();
 
-    /* RX FIFO読み出し */
-	iRet = FlexSPI_ReadRxFifo(base, &ucStatus, 1U);
-    if (iRet != FLEXSPI_E_SUCCESS) {
-        ucStatus = 0xFF;
+    /* 完了待ち(起床要求はキューイングされるため、登録後の完了を取りこぼさない) */
+    while ((desc->ulState != FLEXSPI_CMD_STATE_DONE) && (tRet == E_OK)) {
+        tRet = tslp_tsk(FLEXSPI_CMD_TIMEOUT);
+    }
+
+    loc_cpu();
+    desc->iWaitTskId = TSK_NONE;
+    unl_cpu();
+
+    if (desc->ulState == FLEXSPI_CMD_STATE_DONE) {
+        desc->ulState = FLEXSPI_CMD_STATE_IDLE;
+        iRet = desc->iResult;
     }
     else {
-        ;   /* do nothing */
+        _FlexSPI_CancelCommand(base, desc);
+        iRet = FLEXSPI_E_ERROR;     /* タイムアウト */
     }
 
-err_end:
-	return ucStatus;
+    return iRet;
 }
 
-/****************************************************************************/
-/*  ローカル関数                                                            */
-/****************************************************************************/
 /************************************************************************************************/
-/* FUNCTION   : __FlexSPI_SoftwareReset                                                         */
+/* FUNCTION   : _FlexSPI_CancelCommand                                                          */
 /*                                                                                              */
-/* DESCRIPTION: ソフトウェアリセット                                                            */
+/* DESCRIPTION: IPコマンド取り消し(タイムアウト時)                                              */
+/*              実行中のコマンドはコントローラーを停止してからキューから外し、                  */
+/*              後続のコマンドを開始する                                                        */
 /*----------------------------------------------------------------------------------------------*/
 /* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : desc                            IPコマンド記述子                                */
 /*                                                                                              */
 /* OUTPUT     : none                                                                            */
 /*                                                                                              */
-/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
-/*              FLEXSPI_E_ERROR                 エラー                                          */
+/* RESULTS    : none                                                                            */
 /*                                                                                              */
 /************************************************************************************************/
-LOCAL int _FlexSPI_SoftwareReset(FlexSPI_Type *base)
+LOCAL void _FlexSPI_CancelCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc)
 {
-FLGPTN tFlgPtn = 0;
-uint32_t i     = 0;
+FlexSPI_CmdDesc *ptPrev = NULL;
+FlexSPI_CmdDesc *ptCur  = NULL;
 
-    /* ソフトウェアリセット */
-    base->MCR0 |= FlexSPI_MCR0_SWRESET_MASK;
+    loc_cpu();
 
-    for (i = 0; i < FLEXSPI_MAX_RETRY; i++) {
-        /* フラグチェック */
-        if ((base->MCR0 & FlexSPI_MCR0_SWRESET_MASK) == 0) {
-            return FLEXSPI_E_SUCCESS;
+    /* キューから検索 */
+    for (ptCur = l_tDrvInfo.ptCmdHead; ptCur != NULL; ptCur = ptCur->ptNext) {
+        if (ptCur == desc) {
+            break;
         }
         else {
-            twai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, 1);
+            ptPrev = ptCur;
+        }
+    }
+
+    if (ptCur != NULL) {
+        /* キューから外す */
+        if (ptPrev == NULL) {
+            l_tDrvInfo.ptCmdHead = desc->ptNext;
+        }
+        else {
+            ptPrev->ptNext = desc->ptNext;
+        }
+        if (l_tDrvInfo.ptCmdTail == desc) {
+            l_tDrvInfo.ptCmdTail = ptPrev;
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        /* 実行中であれば停止を確認してから後続を開始 */
+        if ((ptPrev == NULL) && (desc->ulState == FLEXSPI_CMD_STATE_ACTIVE)) {
+            _FlexSPI_AbortCommand(base);
+        }
+        else {
+            ;   /* do nothing */
+        }
+        if ((ptPrev == NULL) && (l_tDrvInfo.ptCmdHead != NULL)) {
+            _FlexSPI_StartCommand(base, l_tDrvInfo.ptCmdHead);
+        }
+        else if (l_tDrvInfo.ptCmdHead == NULL) {
+            base->INTEN &= ~FlexSPI_INTEN_IPCMDDONEEN_MASK;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    desc->ptNext  = NULL;
+    desc->ulState = FLEXSPI_CMD_STATE_IDLE;
+
+    unl_cpu();
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_StartCommand                                                           */
+/*                                                                                              */
+/* DESCRIPTION: IPコマンド開始(CPUロック中または割り込みコンテキストから呼び出す)               */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : desc                            IPコマンド記述子                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_StartCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc)
+{
+unsigned char *pucBuf = desc->pucBuf;
+uint32_t ulRemain     = desc->ulLength;
+uint32_t ulSize       = 0;
+
+    desc->ulState = FLEXSPI_CMD_STATE_ACTIVE;
+
+    /* 1)IPCR0(SPI転送アドレス設定) */
+    base->IPCR0 = desc->ulAddress;
+
+    /* 2)IPCR1(SPI転送サイズ・LUTシーケンス番号・パラレルモード設定) */
+    base->IPCR1 &= ~(uint32_t)(FlexSPI_IPCR1_IDATSZ_MASK | FlexSPI_IPCR1_ISEQID_MASK | FlexSPI_IPCR1_IPAREN_MASK);
+    base->IPCR1 |= (FlexSPI_IPCR1_IDATSZ(desc->ulLength) | FlexSPI_IPCR1_ISEQID(desc->ulSeqId));
+    if (l_tDrvInfo.ulParallel != FLEXSPI_PARALLEL_OFF) {
+        base->IPCR1 |= FlexSPI_IPCR1_IPAREN_MASK;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 3)IPRXFCR(RX FIFOクリア) */
+    base->IPRXFCR |= FlexSPI_IPRXFCR_CLRIPRXF(1);
+
+    /* 4)INTR(RX FIFOフルフラグクリア) */
+    base->INTR = FlexSPI_INTR_IPRXWA_MASK;
+
+    /* 5)TX FIFO書き込み(FIFOに収まるサイズのため空き待ちは不要) */
+    if (desc->ulDir == FLEXSPI_CMD_DIR_WRITE) {
+        base->IPTXFCR |= FlexSPI_IPTXFCR_CLRIPTXF(1);
+        while (ulRemain != 0U) {
+            ulSize = (l_tDrvInfo.ulTxWatermark < ulRemain) ? l_tDrvInfo.ulTxWatermark : ulRemain;
+            memcpy((void*)&base->TFDR, pucBuf, ulSize);
+            pucBuf   += ulSize;
+            ulRemain -= ulSize;
+            base->INTR = FlexSPI_INTR_IPTXWE_MASK;
         }
     }
+    else {
+        ;   /* do nothing */
+    }
 
-    return FLEXSPI_E_ERROR;     /* FlexSPIコントローラー異常 */
+    /* 割り込みステータスクリア */
+    base->INTR = (FlexSPI_INTR_IPCMDDONE_MASK | FlexSPI_INTR_IPCMDERR_MASK | FlexSPI_INTR_IPCMDGE_MASK);
+
+    /* 割り込みイネーブル */
+    base->INTEN |= FlexSPI_INTEN_IPCMDDONEEN(1);
+
+    /* 6)IPCMD(コマンド実行) */
+    base->IPCMD |= FlexSPI_IPCMD_TRG(1);
 }
 
 /************************************************************************************************/
-/* FUNCTION   : __FlexSPI_SetConfig                                                             */
+/* FUNCTION   : _FlexSPI_AbortCommand                                                           */
 /*                                                                                              */
-/* DESCRIPTION: レジスタ設定(MCR0 - 2)                                                          */
+/* DESCRIPTION: 実行中のIPコマンド停止(CPUロック中に呼び出す)                                   */
+/*              アービタ・シーケンサがアイドルでなければソフトウェアリセットで中断し、          */
+/*              取り消したコマンドの完了ステータスが後続のコマンドの完了と判定されないようにする*/
 /*----------------------------------------------------------------------------------------------*/
 /* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
 /*                                                                                              */
@@ -745,269 +2797,299 @@ uint32_t i     = 0;
 /* RESULTS    : none                                                                            */
 /*                                                                                              */
 /************************************************************************************************/
-LOCAL void _FlexSPI_SetConfig(FlexSPI_Type *base)
+LOCAL void _FlexSPI_AbortCommand(FlexSPI_Type *base)
 {
-uint32_t ulReg = 0;
-
-    /* 2)MCR0(レジスタ設定) */
-    ulReg =  base->MCR0;
-    ulReg &= ~(FlexSPI_MCR0_LEARNEN_MASK      |
-               FlexSPI_MCR0_SCKFREERUNEN_MASK |
-               FlexSPI_MCR0_RESERVED_MASK     |
-               FlexSPI_MCR0_MDIS_MASK         |
-               FlexSPI_MCR0_SWRESET_MASK);
-    ulReg |= (FlexSPI_MCR0_AHBGRANTWAIT_MASK |      /* NOTE: Debug only Please default value */
-              FlexSPI_MCR0_IPGRANTWAIT_MASK  |      /* NOTE: Debug only Please default value */
-              FlexSPI_MCR0_SCKFREERUNEN(0)   |
-              FlexSPI_MCR0_COMBINATIONEN(0)  |
-              FlexSPI_MCR0_DOZEEN(0)         |
-              FlexSPI_MCR0_HSEN(1)           |
-              FlexSPI_MCR0_ATDFEN(0)         |
-              FlexSPI_MCR0_ARDFEN(0)         |
-              FlexSPI_MCR0_RXCLKSRC(0));
-    base->MCR0 = ulReg;
+uint32_t i = 0;
 
-    /* 3)MCR1(レジスタ設定e) */
-    ulReg =  base->MCR1;
-    ulReg &= ~(FlexSPI_MCR1_SEQWAIT_MASK | FlexSPI_MCR1_AHBBUSWAIT_MASK);
-    ulReg |= (FlexSPI_MCR1_SEQWAIT(0x00FFU) |
-              FlexSPI_MCR1_AHBBUSWAIT(0xFFFFU));
-    base->MCR1 = ulReg;
+    /* STS0(アイドル確認) */
+    if (((base->STS0 & FlexSPI_STS0_ARBIDLE_MASK) != 0) &&
+        ((base->STS0 & FlexSPI_STS0_SEQIDLE_MASK) != 0)) {
+        ;   /* do nothing */
+    }
+    else {
+        /* ソフトウェアリセット(CPUロック中のため休止せずに完了を確認する) */
+        base->MCR0 |= FlexSPI_MCR0_SWRESET_MASK;
+        for (i = 0; i < FLEXSPI_ABORT_SPIN; i++) {
+            if ((base->MCR0 & FlexSPI_MCR0_SWRESET_MASK) == 0) {
+                break;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+    }
 
-    /* 4)MCR2(レジスタ設定) */
-    ulReg =  base->MCR2;
-    ulReg &= ~(FlexSPI_MCR2_RESUMEWAIT_MASK   |
-               FlexSPI_MCR2_SCKBDIFFOPT_MASK  |
-               FlexSPI_MCR2_SAMEDEVICEEN_MASK |
-               FlexSPI_MCR2_CLRAHBBUFOPT_MASK);
-    ulReg |= (FlexSPI_MCR2_RESUMEWAIT(0x20U) |
-              FlexSPI_MCR2_SCKBDIFFOPT(0)    |
-              FlexSPI_MCR2_SAMEDEVICEEN(0)   |
-              FlexSPI_MCR2_CLRAHBBUFOPT(0));
-    base->MCR2 = ulReg;
+    /* 割り込みステータスクリア */
+    base->INTR = (FlexSPI_INTR_IPCMDDONE_MASK | FlexSPI_INTR_IPCMDERR_MASK | FlexSPI_INTR_IPCMDGE_MASK);
 }
 
+
 /************************************************************************************************/
-/* FUNCTION   : __FlexSPI_SetCS                                                                 */
+/* FUNCTION   : _FlexSPI_CompleteCommand                                                        */
 /*                                                                                              */
-/* DESCRIPTION: レジスタ設定(MCR0 - 2)                                                          */
+/* DESCRIPTION: IPコマンド完了処理(割り込みコンテキスト)                                        */
+/*              先頭のコマンドを完了させ、後続があれば続けて開始する                            */
 /*----------------------------------------------------------------------------------------------*/
 /* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : ulStatus                        割り込みステータス(INTR)                        */
 /*                                                                                              */
 /* OUTPUT     : none                                                                            */
 /*                                                                                              */
-/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
-/*            : FLEXSPI_E_ERROR                 エラー                                          */
+/* RESULTS    : none                                                                            */
 /*                                                                                              */
 /************************************************************************************************/
-LOCAL int _FlexSPI_SetCS(FlexSPI_Type *base, int chip_select, const flexspi_device_config_t *config)
+LOCAL void _FlexSPI_CompleteCommand(FlexSPI_Type *base, uint32_t ulStatus)
 {
-FLGPTN tFlgPtn       = 0;
-uint32_t configValue = 0;
-uint32_t statusValue = 0;
-uint32_t i           = 0;
-uint8_t index        = (uint8_t)chip_select >> 1U; /* PortA with index 0, PortB with index 1. */
-uint8_t delay        = 0;
-
-    /* 5)STS0(アイドル待ち) */
-    for (i = 0; i < FLEXSPI_MAX_RETRY; i++) {
-        if (((base->STS0 & FlexSPI_STS0_ARBIDLE_MASK) != 0) &&
-            ((base->STS0 & FlexSPI_STS0_SEQIDLE_MASK) != 0)) {
-            break;
-        }
-        else {
-            twai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, 1);
-        }
-    }
-    if (i == FLEXSPI_MAX_RETRY) {
-        return FLEXSPI_E_ERROR;
+FlexSPI_CmdDesc *ptDesc = l_tDrvInfo.ptCmdHead;
+uint32_t ulRemain       = 0;
+uint32_t ulSize         = 0;
+unsigned char *pucBuf   = NULL;
+
+    /* 実行結果 */
+    if ((ulStatus & (FlexSPI_INTR_IPCMDERR_MASK | FlexSPI_INTR_IPCMDGE_MASK)) != 0U) {
+        ptDesc->iResult = FLEXSPI_E_ERROR;
     }
     else {
-        ;   /* do nothing */
+        ptDesc->iResult = FLEXSPI_E_SUCCESS;
     }
 
-    /* 6)FLSHCR0[n](コンフィギュレーション情報設定) */
-    base->FLSHCR0[chip_select] = config->flashSize;
-
-    /* 7)FLSHCR1[n](コンフィギュレーション情報設定) */
-    base->FLSHCR1[chip_select] = (FlexSPI_FLSHCR1_CSINTERVAL(config->CSInterval)         |
-                                  FlexSPI_FLSHCR1_CSINTERVALUNIT(config->CSIntervalUnit) |
-                                  FlexSPI_FLSHCR1_CAS(config->columnspace)               |
-                                  FlexSPI_FLSHCR1_WA(config->enableWordAddress)          |
-                                  FlexSPI_FLSHCR1_TCSH(config->CSHoldTime)               |
-                                  FlexSPI_FLSHCR1_TCSS(config->CSSetupTime));
-	
-    /* 8)FLSHCR2[n](コンフィギュレーション情報設定) */
-    configValue = base->FLSHCR2[chip_select];
-
-    configValue &= ~(FlexSPI_FLSHCR2_AWRWAITUNIT_MASK |
-                     FlexSPI_FLSHCR2_AWRWAIT_MASK     |
-                     FlexSPI_FLSHCR2_AWRSEQNUM_MASK   |
-                     FlexSPI_FLSHCR2_AWRSEQID_MASK    |
-                     FlexSPI_FLSHCR2_ARDSEQNUM_MASK   |
-                     FlexSPI_FLSHCR2_ARDSEQID_MASK);
-
-    configValue |= (FlexSPI_FLSHCR2_AWRWAITUNIT(config->AHBWriteWaitUnit) |
-                    FlexSPI_FLSHCR2_AWRWAIT(config->AHBWriteWaitInterval));
-
-    if (0 < config->AWRSeqNumber) {
-        configValue |= (FlexSPI_FLSHCR2_AWRSEQID((uint32_t)config->AWRSeqIndex) |
-                        FlexSPI_FLSHCR2_AWRSEQNUM((uint32_t)config->AWRSeqNumber - 1U));
+    /* RX FIFOより取得(コマンド完了時点で全データがFIFOにある) */
+    if ((ptDesc->ulDir == FLEXSPI_CMD_DIR_READ) && (ptDesc->iResult == FLEXSPI_E_SUCCESS)) {
+        pucBuf   = ptDesc->pucBuf;
+        ulRemain = ptDesc->ulLength;
+        while (ulRemain != 0U) {
+            ulSize = (l_tDrvInfo.ulRxWatermark < ulRemain) ? l_tDrvInfo.ulRxWatermark : ulRemain;
+            FlexSPI_CopyRxBlock(base, pucBuf, ulSize);
+            base->INTR = FlexSPI_INTR_IPRXWA_MASK;
+            pucBuf   += ulSize;
+            ulRemain -= ulSize;
+        }
     }
     else {
         ;   /* do nothing */
     }
 
-    if (0 < config->ARDSeqNumber) {
-        configValue |= (FlexSPI_FLSHCR2_ARDSEQID((uint32_t)config->ARDSeqIndex) |
-                        FlexSPI_FLSHCR2_ARDSEQNUM((uint32_t)config->ARDSeqNumber - 1U));
+    /* キューから外す */
+    l_tDrvInfo.ptCmdHead = ptDesc->ptNext;
+    if (l_tDrvInfo.ptCmdHead == NULL) {
+        l_tDrvInfo.ptCmdTail = NULL;
     }
     else {
         ;   /* do nothing */
     }
+    ptDesc->ptNext = NULL;
 
-    base->FLSHCR2[chip_select] = configValue;
-
-    /* 9)DLLCR[n/2](レジスタ設定) */
-    configValue        = _FlexSPI_GetDLLValue(base, chip_select, config);
-    base->DLLCR[index] = configValue;
-
-    /* 10)FLSHCR4(コンフィギュレーション情報設定) */
-    if (config->enableWriteMask) {
-        base->FLSHCR4 &= ~FlexSPI_FLSHCR4_WMOPT1_MASK;
+    /* 後続のコマンドを開始(タスク切り替えを挟まない) */
+    if (l_tDrvInfo.ptCmdHead != NULL) {
+        _FlexSPI_StartCommand(base, l_tDrvInfo.ptCmdHead);
     }
     else {
-        base->FLSHCR4 |= FlexSPI_FLSHCR4_WMOPT1_MASK;
+        base->INTEN &= ~FlexSPI_INTEN_IPCMDDONEEN_MASK;
     }
 
-    if (index == 0U) {
-         /*PortA*/
-        base->FLSHCR4 &= ~FlexSPI_FLSHCR4_WMENA_MASK;
-        base->FLSHCR4 |= FlexSPI_FLSHCR4_WMENA(config->enableWriteMask);
+    /* 完了通知 */
+    if (ptDesc->pfnCallback != NULL) {
+        ptDesc->ulState = FLEXSPI_CMD_STATE_IDLE;
+        ptDesc->pfnCallback(ptDesc);
     }
     else {
-        base->FLSHCR4 &= ~FlexSPI_FLSHCR4_WMENB_MASK;
-        base->FLSHCR4 |= FlexSPI_FLSHCR4_WMENB(config->enableWriteMask);
+        ptDesc->ulState = FLEXSPI_CMD_STATE_DONE;
+        if (ptDesc->iWaitTskId != TSK_NONE) {
+            iwup_tsk(ptDesc->iWaitTskId);
+        }
+        else {
+            ;   /* do nothing */
+        }
     }
+}
 
-    /* 11)MCR0(モジュールイネーブル) */
-    base->MCR0 &= ~FlexSPI_MCR0_MDIS_MASK;
-
-    /* According to ERR011377, need to delay at least 100 NOPs to ensure the DLL is locked. */
-    statusValue = (index == 0U) ?
-                   ((uint32_t)kFlexSPI_FlashASampleClockSlaveDelayLocked |
-                    (uint32_t)kFlexSPI_FlashASampleClockRefDelayLocked) :
-                   ((uint32_t)kFlexSPI_FlashBSampleClockSlaveDelayLocked |
-                    (uint32_t)kFlexSPI_FlashBSampleClockRefDelayLocked);
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_ReadRxFifoDma                                                          */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFOより読み出し(DMA)                                                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : size                            読み出し長(キャッシュラインサイズの倍数)        */
+/*                                                                                              */
+/* OUTPUT     : buf                             データ格納バッファ(キャッシュライン境界)        */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 DMA転送エラー・タイムアウト                     */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_ReadRxFifoDma(FlexSPI_Type *base, unsigned char *buf, uint32_t size)
+{
+FLGPTN tFlgPtn = 0;
+ER tRet        = E_SYS;
+int iRet       = FLEXSPI_E_ERROR;
 
-    if ((configValue & FlexSPI_DLLCR_DLLEN_MASK) != 0U) {
-        /* Wait slave delay line locked and slave reference delay line locked. */
-        while ((base->STS2 & statusValue) != statusValue) {
-            //PRINT("SLAVE WAIT\r\n");
-        }
+    /* 転送先のダーティラインを書き戻してから無効化 */
+    _FlexSPI_CleanInvalidateDCache(buf, size);
 
-        /* Wait at least 100 NOPs*/
-        for (delay = 100U; delay > 0U; delay--) {
-            __NOP();
-        }
+    /* イベントフラグクリア */
+    clr_flg(l_tDrvInfo.tFlgID, ~FLEXSPI_EVFBIT_DMA_RX);
+    l_tDrvInfo.iDmaResult[FLEXSPI_DMA_DIR_RX] = FLEXSPI_E_ERROR;
+
+    /* 1)IPRXFCR(RX DMAイネーブル) */
+    base->IPRXFCR |= FlexSPI_IPRXFCR_RXDMAEN(1);
+
+    /* 2)DMA転送開始(ウォーターマーク分をRFDRから繰り返し読み出す) */
+    iRet = l_tDrvInfo.ptDmaOps->pfnStart(FLEXSPI_DMA_DIR_RX,
+                                         (uint32_t)&base->RFDR[0],
+                                         (uint32_t)buf,
+                                         size,
+                                         l_tDrvInfo.ulRxWatermark);
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        iRet = FLEXSPI_E_ERROR;
+        goto err_end;
     }
     else {
         ;   /* do nothing */
     }
-    return FLEXSPI_E_SUCCESS;
+
+    /* 3)DMA転送完了待ち */
+    tRet = twai_flg(l_tDrvInfo.tFlgID, FLEXSPI_EVFBIT_DMA_RX, TWF_ORW, &tFlgPtn, FLEXSPI_DMA_TIMEOUT);
+    if (tRet != E_OK) {
+        l_tDrvInfo.ptDmaOps->pfnAbort(FLEXSPI_DMA_DIR_RX);
+        iRet = FLEXSPI_E_ERROR;     /* タイムアウト */
+    }
+    else {
+        iRet = l_tDrvInfo.iDmaResult[FLEXSPI_DMA_DIR_RX];
+    }
+
+err_end:
+    /* 4)IPRXFCR(RX DMAディセーブル) */
+    base->IPRXFCR &= ~FlexSPI_IPRXFCR_RXDMAEN_MASK;
+
+    /* DMAが書き込んだ領域を再読み込みさせる */
+    _FlexSPI_InvalidateDCache(buf, size);
+
+    return iRet;
 }
 
 /************************************************************************************************/
-/* FUNCTION   : __FlexSPI_GetDLLValue                                                           */
+/* FUNCTION   : _FlexSPI_StartTxFifoDma                                                         */
 /*                                                                                              */
-/* DESCRIPTION: DLLレジスタ値取得                                                               */
+/* DESCRIPTION: TX FIFO書き込み開始(DMA)                                                        */
+/*              完了はFLEXSPI_EVFBIT_DMA_TXで通知される                                         */
 /*----------------------------------------------------------------------------------------------*/
 /* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : txbuf                           送信データ格納バッファ                          */
+/*            : size                            書き込み長(ウォーターマークの倍数)              */
 /*                                                                                              */
 /* OUTPUT     : none                                                                            */
 /*                                                                                              */
-/* RESULTS    : DLL設定値                                                                       */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 DMA開始エラー                                   */
 /*                                                                                              */
 /************************************************************************************************/
-LOCAL int _FlexSPI_GetDLLValue(FlexSPI_Type *base, int chip_select, const flexspi_device_config_t *config)
+LOCAL int _FlexSPI_StartTxFifoDma(FlexSPI_Type *base, unsigned char *txbuf, uint32_t size)
 {
-uint32_t isUnifiedConfig = 1;
-uint32_t flexspiDllValue = 0;
-uint32_t dllValue        = 0;
-uint32_t temp            = 0;
+int iRet = FLEXSPI_E_ERROR;
 
-    if (isUnifiedConfig != 0) {
-        flexspiDllValue = FLEXSPI_DLLCR_DEFAULT; /* 1 fixed delay cells in DLL delay chain) */
+    /* 送信データをメモリへ書き戻す */
+    _FlexSPI_CleanDCache(txbuf, size);
+
+    /* イベントフラグクリア */
+    clr_flg(l_tDrvInfo.tFlgID, ~FLEXSPI_EVFBIT_DMA_TX);
+    l_tDrvInfo.iDmaResult[FLEXSPI_DMA_DIR_TX] = FLEXSPI_E_ERROR;
+
+    /* 1)IPTXFCR(TX DMAイネーブル) */
+    base->IPTXFCR |= FlexSPI_IPTXFCR_TXDMAEN(1);
+
+    /* 2)DMA転送開始(ウォーターマーク分をTFDRへ繰り返し書き込む) */
+    iRet = l_tDrvInfo.ptDmaOps->pfnStart(FLEXSPI_DMA_DIR_TX,
+                                         (uint32_t)txbuf,
+                                         (uint32_t)&base->TFDR[0],
+                                         size,
+                                         l_tDrvInfo.ulTxWatermark);
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        base->IPTXFCR &= ~FlexSPI_IPTXFCR_TXDMAEN_MASK;
+        iRet = FLEXSPI_E_ERROR;
     }
     else {
-        if ((100U * FREQ_1MHz) <= config->flexspiRootClk) {
-            /* DLLEN = 1, SLVDLYTARGET = 0xF, */
-            flexspiDllValue = FlexSPI_DLLCR_DLLEN(1) | FlexSPI_DLLCR_SLVDLYTARGET(0x0F);
-        }
-        else {
-            temp     = (uint32_t)config->dataValidTime * 1000U; /* Convert data valid time in ns to ps. */
-            dllValue = temp / (uint32_t)kFLEXSPI_DelayCellUnitMin;
-            if (dllValue * (uint32_t)kFLEXSPI_DelayCellUnitMin < temp) {
-                dllValue++;
-            }
-            else {
-                ;   /* do nothing */
-            }
-            flexspiDllValue = FlexSPI_DLLCR_OVRDEN(1) | FlexSPI_DLLCR_OVRDVAL(dllValue);
-        }
+        ;   /* do nothing */
     }
-    return flexspiDllValue;
+
+    return iRet;
 }
 
 /************************************************************************************************/
-/* FUNCTION   : __FlexSPI_SetAHBConfig                                                          */
+/* FUNCTION   : _FlexSPI_CleanDCache                                                            */
 /*                                                                                              */
-/* DESCRIPTION: AHB設定                                                                         */
+/* DESCRIPTION: データキャッシュ書き戻し                                                        */
 /*----------------------------------------------------------------------------------------------*/
-/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/* INPUT      : addr                            先頭アドレス                                    */
+/*            : size                            サイズ                                          */
 /*                                                                                              */
 /* OUTPUT     : none                                                                            */
 /*                                                                                              */
 /* RESULTS    : none                                                                            */
 /*                                                                                              */
 /************************************************************************************************/
-LOCAL void _FlexSPI_SetAHBConfig(FlexSPI_Type *base)
+LOCAL void _FlexSPI_CleanDCache(const void *addr, uint32_t size)
 {
-int i = 0;
-
-	// FLASHのサイズをセット(KB単位)
-//	base->FLSHCR0[0] = FROM_CHIP_SIZE / 1024;	// FLSHA1CR0 
-	// 接続しているFLASHは１個のみなので、FLSHA1CR0以外は0
-	base->FLSHCR0[1] = 0;						// FLSHA2CR0
-	base->FLSHCR0[2] = 0;						// FLSHB1CR0
-	base->FLSHCR0[3] = 0;						// FLSHB2CR0
+uint32_t ulAddr = (uint32_t)addr & ~(FLEXSPI_DCACHE_LINE_SIZE - 1U);
+uint32_t ulEnd  = (uint32_t)addr + size;
 
-	/* 12)LUT(LUT設定 4-Byte Quad Output Fast Read) */
-	FlexSPI_SetQuadOutFastRdSequence(base);
-
-    /* 13)AHBRXBUFCR0[0]-[7](レジスタクリア) */
-	for (i = 0; i < 7; i++ ) {
-		base->AHBRXBUFCR0[i] = 0;
-	}
+    __DSB();
+    for ( ; ulAddr < ulEnd; ulAddr += FLEXSPI_DCACHE_LINE_SIZE) {
+        FLEXSPI_SCB_DCCMVAC = ulAddr;
+    }
+    __DSB();
+    __ISB();
+}
 
-    /* 14)AHBRXBUFCR0[7](バッファ設定) */
-	base->AHBRXBUFCR0[7] = (FLEXSPI_AHB_BUFFER_SIZE / 8) | FlexSPI_AHBRXBUFCR0_PREFETCHEN_MASK;
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_CleanInvalidateDCache                                                  */
+/*                                                                                              */
+/* DESCRIPTION: データキャッシュ書き戻し＆無効化                                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : addr                            先頭アドレス                                    */
+/*            : size                            サイズ                                          */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_CleanInvalidateDCache(const void *addr, uint32_t size)
+{
+uint32_t ulAddr = (uint32_t)addr & ~(FLEXSPI_DCACHE_LINE_SIZE - 1U);
+uint32_t ulEnd  = (uint32_t)addr + size;
 
-	/* 15)AHBCR(プリフェッチ設定) */
-	base->AHBCR = FlexSPI_AHBCR_PREFETCHEN_MASK;
+    __DSB();
+    for ( ; ulAddr < ulEnd; ulAddr += FLEXSPI_DCACHE_LINE_SIZE) {
+        FLEXSPI_SCB_DCCIMVAC = ulAddr;
+    }
+    __DSB();
+    __ISB();
+}
 
-    /* 16)FLSHCR2[n](LUTシーケンス設定) */
-	base->FLSHCR2[0] = 1;		// Flash Control Register 2 (FLSHA1CR2)に、シーケンス番号セット
-	
-    /* 17)IPRXFCR(RX FIFO設定) */
-    base->IPRXFCR &= ~FlexSPI_IPRXFCR_RXDMAEN_MASK;
-    base->IPRXFCR &= ~FlexSPI_IPRXFCR_RXWMRK_MASK;
-    base->IPRXFCR |= FlexSPI_IPRXFCR_RXWMRK((uint32_t)FLEXSPI_WATERMARK_BITS / 8U - 1U);
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_InvalidateDCache                                                       */
+/*                                                                                              */
+/* DESCRIPTION: データキャッシュ無効化                                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : addr                            先頭アドレス                                    */
+/*            : size                            サイズ                                          */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_InvalidateDCache(const void *addr, uint32_t size)
+{
+uint32_t ulAddr = (uint32_t)addr & ~(FLEXSPI_DCACHE_LINE_SIZE - 1U);
+uint32_t ulEnd  = (uint32_t)addr + size;
 
-    /* 18)IPTXFCR(TX FIFO設定) */
-    base->IPTXFCR &= ~FlexSPI_IPTXFCR_TXDMAEN_MASK;
-    base->IPTXFCR &= ~FlexSPI_IPTXFCR_TXWMRK_MASK;
-    base->IPTXFCR |= FlexSPI_IPTXFCR_TXWMRK((uint32_t)FLEXSPI_WATERMARK_BITS / 8U - 1U);
+    __DSB();
+    for ( ; ulAddr < ulEnd; ulAddr += FLEXSPI_DCACHE_LINE_SIZE) {
+        FLEXSPI_SCB_DCIMVAC = ulAddr;
+    }
+    __DSB();
+    __ISB();
 }
 
 /* 割り込みサービス */
@@ -1033,7 +3115,11 @@ uint32_t ulStatus          = 0;
     ulStatus = ptDrvInfo->tpBase->INTR;
 
     /* 割り込み分類 */
-    if ((ulStatus & FlexSPI_INTEN_IPCMDDONEEN_MASK) != 0) {
+    if (((ulStatus & FlexSPI_INTR_IPCMDDONE_MASK) != 0U) && (ptDrvInfo->ptCmdHead != NULL)) {
+        /* キューのコマンド完了(後続のコマンドを開始) */
+        _FlexSPI_CompleteCommand(ptDrvInfo->tpBase, ulStatus);
+    }
+    else if ((ulStatus & FlexSPI_INTEN_IPCMDDONEEN_MASK) != 0) {
         /* 割り込みマスク */
         ptDrvInfo->tpBase->INTEN &= ~FlexSPI_INTEN_IPCMDDONEEN_MASK;
 
@@ -1043,4 +3129,30 @@ uint32_t ulStatus          = 0;
     else {
         ;   /* do nothing */
     }
+
+    /* RX FIFOウォーターマーク到達(データの取り出しは待ちタスク側で行う) */
+    if (((ulStatus & FlexSPI_INTR_IPRXWA_MASK) != 0U) &&
+        ((ptDrvInfo->tpBase->INTEN & FlexSPI_INTEN_IPRXWAEN_MASK) != 0U)) {
+        /* 割り込みマスク */
+        ptDrvInfo->tpBase->INTEN &= ~FlexSPI_INTEN_IPRXWAEN_MASK;
+
+        /* イベントフラグセット */
+        iset_flg(ptDrvInfo->tFlgID, FLEXSPI_EVFBIT_RX);
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* TX FIFOウォーターマーク空き */
+    if (((ulStatus & FlexSPI_INTR_IPTXWE_MASK) != 0U) &&
+        ((ptDrvInfo->tpBase->INTEN & FlexSPI_INTEN_IPTXWEEN_MASK) != 0U)) {
+        /* 割り込みマスク */
+        ptDrvInfo->tpBase->INTEN &= ~FlexSPI_INTEN_IPTXWEEN_MASK;
+
+        /* イベントフラグセット */
+        iset_flg(ptDrvInfo->tFlgID, FLEXSPI_EVFBIT_TX);
+    }
+    else {
+        ;   /* do nothing */
+    }
 }
@@ -48,6 +48,8 @@ extern "C" {
 
 /* AHBCR */
 #define FlexSPI_AHBCR_PREFETCHEN_MASK               (0x00000020U)
+#define FlexSPI_AHBCR_APAREN_MASK                   (0x00000001U)
+#define FlexSPI_AHBCR_CLRAHBRXBUF_MASK              (0x00000002U)
 
 /* INTEN */
 #define FlexSPI_INTEN_IPCMDDONE                     (0x00000001U)
@@ -58,6 +60,21 @@ extern "C" {
 
 /* AHBRXBUFCR0 */
 #define FlexSPI_AHBRXBUFCR0_PREFETCHEN_MASK         (0x80000000U)
+#define FlexSPI_AHBRXBUFCR0_PRIORITY_MASK           (0x03000000U)
+#define FlexSPI_AHBRXBUFCR0_PRIORITY_SHIFT          (24U)
+#define FlexSPI_AHBRXBUFCR0_PRIORITY(x) \
+    (((uint32_t)(((uint32_t)(x)) << FlexSPI_AHBRXBUFCR0_PRIORITY_SHIFT)) & FlexSPI_AHBRXBUFCR0_PRIORITY_MASK)
+#define FlexSPI_AHBRXBUFCR0_MSTRID_MASK             (0x000F0000U)
+#define FlexSPI_AHBRXBUFCR0_MSTRID_SHIFT            (16U)
+#define FlexSPI_AHBRXBUFCR0_MSTRID(x) \
+    (((uint32_t)(((uint32_t)(x)) << FlexSPI_AHBRXBUFCR0_MSTRID_SHIFT)) & FlexSPI_AHBRXBUFCR0_MSTRID_MASK)
+#define FlexSPI_AHBRXBUFCR0_BUFSZ_MASK              (0x000001FFU)   /* 8バイト単位 */
+#define FlexSPI_AHBRXBUFCR0_BUFSZ_SHIFT             (0U)
+#define FlexSPI_AHBRXBUFCR0_BUFSZ(x) \
+    (((uint32_t)(((uint32_t)(x)) << FlexSPI_AHBRXBUFCR0_BUFSZ_SHIFT)) & FlexSPI_AHBRXBUFCR0_BUFSZ_MASK)
+
+/* FLSHCR0 */
+#define FlexSPI_FLSHCR0_FLSHSZ_MASK                 (0x007FFFFFU)   /* KB単位 */
 
 /* FLSHCR2 */
 #define FlexSPI_FLSHCR2_AWRWAITUNIT_MASK            (0x70000000U)
@@ -80,6 +97,10 @@ extern "C" {
 #define FlexSPI_IPTXFCR_TXWMRK_MASK                 (0x000001FCU)
 #define FlexSPI_IPTXFCR_TXDMAEN_MASK                (0x00000002U)
 
+/* IPRXFSTS */
+#define FlexSPI_IPRXFSTS_FILL_MASK                  (0x000000FFU)   /* 8バイト単位 */
+#define FlexSPI_IPRXFSTS_FILL_SHIFT                 (0U)
+
 /* DLLCR */
 #define FlexSPI_DLLCR_DLLEN_MASK                    (0x00000001U)
 
@@ -172,6 +193,16 @@ extern "C" {
     (((uint32_t)(((uint32_t)(x)) << FlexSPI_MCR2_CLRAHBBUFOPT_SHIFT)) & FlexSPI_MCR2_CLRAHBBUFOPT_MASK)
 
 /* INTEN */
+#define FlexSPI_INTEN_IPTXWEEN_MASK                 (0x00000040U)
+#define FlexSPI_INTEN_IPTXWEEN_SHIFT                (6U)
+#define FlexSPI_INTEN_IPTXWEEN(x) \
+    (((uint32_t)(((uint32_t)(x)) << FlexSPI_INTEN_IPTXWEEN_SHIFT)) & FlexSPI_INTEN_IPTXWEEN_MASK)
+
+#define FlexSPI_INTEN_IPRXWAEN_MASK                 (0x00000020U)
+#define FlexSPI_INTEN_IPRXWAEN_SHIFT                (5U)
+#define FlexSPI_INTEN_IPRXWAEN(x) \
+    (((uint32_t)(((uint32_t)(x)) << FlexSPI_INTEN_IPRXWAEN_SHIFT)) & FlexSPI_INTEN_IPRXWAEN_MASK)
+
 #define FlexSPI_INTEN_IPCMDDONEEN_MASK              (0x00000001U)
 #define FlexSPI_INTEN_IPCMDDONEEN_SHIFT             (0U)
 #define FlexSPI_INTEN_IPCMDDONEEN(x) \
@@ -188,8 +219,18 @@ extern "C" {
 #define FlexSPI_INTR_IPRXWA(x) \
     (((uint32_t)(((uint32_t)(x)) << FlexSPI_INTR_IPRXWA_SHIFT)) & FlexSPI_INTR_IPRXWA_MASK)
 
+#define FlexSPI_INTR_IPCMDERR_MASK                  (0x00000008U)
+#define FlexSPI_INTR_IPCMDERR_SHIFT                 (3U)
+#define FlexSPI_INTR_IPCMDERR(x) \
+    (((uint32_t)(((uint32_t)(x)) << FlexSPI_INTR_IPCMDERR_SHIFT)) & FlexSPI_INTR_IPCMDERR_MASK)
+
+#define FlexSPI_INTR_IPCMDGE_MASK                   (0x00000002U)
+#define FlexSPI_INTR_IPCMDGE_SHIFT                  (1U)
+#define FlexSPI_INTR_IPCMDGE(x) \
+    (((uint32_t)(((uint32_t)(x)) << FlexSPI_INTR_IPCMDGE_SHIFT)) & FlexSPI_INTR_IPCMDGE_MASK)
+
 #define FlexSPI_INTR_IPCMDDONE_MASK                 (0x00000001U)
-#define FlexSPI_INTR_IPCMDDONE_SHIFT                (5U)
+#define FlexSPI_INTR_IPCMDDONE_SHIFT                (0U)
 #define FlexSPI_INTR_IPCMDDONE(x) \
     (((uint32_t)(((uint32_t)(x)) << FlexSPI_INTR_IPCMDDONE_SHIFT)) & FlexSPI_INTR_IPCMDDONE_MASK)
 
@@ -283,6 +324,13 @@ extern "C" {
 #define FlexSPI_IPCR1_IDATSZ(x) \
     (((uint32_t)(((uint32_t)(x)) << FlexSPI_IPCR1_IDATSZ_SHIFT)) & FlexSPI_IPCR1_IDATSZ_MASK)
 
+#define FlexSPI_IPCR1_ISEQID_MASK                   (0x001F0000U)
+#define FlexSPI_IPCR1_ISEQID_SHIFT                  (16U)
+#define FlexSPI_IPCR1_ISEQID(x) \
+    (((uint32_t)(((uint32_t)(x)) << FlexSPI_IPCR1_ISEQID_SHIFT)) & FlexSPI_IPCR1_ISEQID_MASK)
+
+#define FlexSPI_IPCR1_IPAREN_MASK                   (0x80000000U)
+
 /* IPCMD */
 #define FlexSPI_IPCMD_TRG_MASK                      (0x00000001U)
 #define FlexSPI_IPCMD_TRG_SHIFT                     (0U)
@@ -348,13 +396,266 @@ extern "C" {
     (((uint32_t)(((uint32_t)(x)) << FlexSPI_DLLCR_DLLEN_SHIFT)) & FlexSPI_DLLCR_DLLEN_MASK)
 
 #define __NOP()                                     __asm volatile ("nop")
+#define __DSB()                                     __asm volatile ("dsb 0xF" ::: "memory")
+#define __ISB()                                     __asm volatile ("isb 0xF" ::: "memory")
+
+/* データキャッシュ保守(SCB) */
+#define FLEXSPI_SCB_DCIMVAC                         (*(volatile uint32_t*)0xE000EF5CU)  /* Invalidate by MVA */
+#define FLEXSPI_SCB_DCCMVAC                         (*(volatile uint32_t*)0xE000EF68U)  /* Clean by MVA */
+#define FLEXSPI_SCB_DCCIMVAC                        (*(volatile uint32_t*)0xE000EF70U)  /* Clean & Invalidate by MVA */
+#define FLEXSPI_DCACHE_LINE_SIZE                    (32U)
+
+/* DMA転送方向 */
+#define FLEXSPI_DMA_DIR_RX                          (0U)    /* RX FIFO -> メモリ */
+#define FLEXSPI_DMA_DIR_TX                          (1U)    /* メモリ -> TX FIFO */
+
+/* FIFOウォーターマーク(バイト単位、8 - 128の2のべき乗) */
+#define FLEXSPI_WATERMARK_MIN                       (8U)
+#define FLEXSPI_WATERMARK_MAX                       (128U)  /* RFDR/TFDRの窓サイズ */
+#define FLEXSPI_WATERMARK_DEFAULT                   (8U)
+
+/* FIFO転送モード */
+#define FLEXSPI_XFER_MODE_PIO                       (0U)    /* CPUによるFIFOアクセス */
+#define FLEXSPI_XFER_MODE_DMA                       (1U)    /* DMAによるFIFOアクセス */
+
+/* LUTシーケンス番号(FlexSPI_LoadLUTTableでオープン時に一括設定) */
+#define FLEXSPI_SEQ_SCRATCH                         (0U)    /* FlexSPI_Set*Sequenceによる個別設定用 */
+#define FLEXSPI_SEQ_AHB_READ                        (1U)    /* AHB読み出し(FLSHCR2.ARDSEQID) */
+#define FLEXSPI_SEQ_WRITE_ENABLE                    (2U)    /* Write Enable */
+#define FLEXSPI_SEQ_READ_STATUS                     (3U)    /* Read Status Register */
+#define FLEXSPI_SEQ_READ_FLAG_STATUS                (4U)    /* Read Flag Status Register */
+#define FLEXSPI_SEQ_QUAD_IO_READ                    (5U)    /* 4-Byte Quad Input/Output Fast Read */
+#define FLEXSPI_SEQ_QUAD_WRITE                      (6U)    /* 4-Byte Quad Input Fast Program */
+#define FLEXSPI_SEQ_ERASE_4KB                       (7U)    /* 4-Byte 4KB Subsector Erase */
+#define FLEXSPI_SEQ_ERASE_64KB                      (8U)    /* 4-Byte Sector Erase(64KB) */
+#define FLEXSPI_SEQ_ENTER_QUAD                      (9U)    /* Enter Quad Input/Output Mode */
+#define FLEXSPI_SEQ_RESET_QUAD                      (10U)   /* Reset Quad Input/Output Mode */
+#define FLEXSPI_SEQ_QUAD_IO_READ_DDR                (11U)   /* 4-Byte DTR Quad Input/Output Fast Read(Quadモード中) */
+#define FLEXSPI_SEQ_AHB_READ_DDR                    (12U)   /* 4-Byte DTR Quad Input/Output Fast Read(AHB読み出し) */
+#define FLEXSPI_SEQ_SPI_WRITE_ENABLE                (13U)   /* Write Enable(拡張SPIモード、Octalモード移行前) */
+#define FLEXSPI_SEQ_ENTER_OCTAL                     (14U)   /* Write Volatile Configuration Register(拡張SPIモード) */
+#define FLEXSPI_SEQ_EXIT_OCTAL                      (15U)   /* Write Volatile Configuration Register(Octal DDRモード) */
+#define FLEXSPI_SEQ_SPI_IO_READ                     (16U)   /* 4-Byte Quad Input/Output Fast Read(拡張SPIモード、1-4-4) */
+#define FLEXSPI_SEQ_SPI_IO_READ_DDR                 (17U)   /* 4-Byte DTR Quad Input/Output Fast Read(拡張SPIモード、1-4D-4D) */
+#define FLEXSPI_SEQ_ERASE_32KB                      (18U)   /* 4-Byte 32KB Subsector Erase */
+#define FLEXSPI_SEQ_ERASE_CHIP                      (19U)   /* Bulk Erase */
+#define FLEXSPI_SEQ_SUSPEND                         (20U)   /* Program/Erase Suspend */
+#define FLEXSPI_SEQ_RESUME                          (21U)   /* Program/Erase Resume */
+#define FLEXSPI_SEQ_READ_SFDP                       (22U)   /* Read Serial Flash Discovery Parameter(1-1-1) */
+#define FLEXSPI_SEQ_MAX                             (32U)   /* LUTに格納できるシーケンス数 */
+
+/* IPコマンドのデータ転送方向 */
+#define FLEXSPI_CMD_DIR_NONE                        (0U)    /* データ転送なし(FIFOは呼び出し元が操作) */
+#define FLEXSPI_CMD_DIR_READ                        (1U)    /* RX FIFO -> pucBuf(完了時に取得) */
+#define FLEXSPI_CMD_DIR_WRITE                       (2U)    /* pucBuf -> TX FIFO(開始時に格納) */
+#define FLEXSPI_CMD_DATA_MAX                        (FLEXSPI_WATERMARK_MAX) /* キュー経由で転送できる最大データ長 */
+#define FLEXSPI_STREAM_DATA_MAX                     (0x10000U - FLEXSPI_WATERMARK_MAX)  /* ストリーミング読み出し1コマンドの最大長(IPCR1.IDATSZ以内) */
+
+/* チップセレクト(論理デバイス番号、アドレス空間はこの順に連結される) */
+#define FLEXSPI_CS_A1                               (0)     /* ポートA デバイス1 */
+#define FLEXSPI_CS_A2                               (1)     /* ポートA デバイス2 */
+#define FLEXSPI_CS_B1                               (2)     /* ポートB デバイス1 */
+#define FLEXSPI_CS_B2                               (3)     /* ポートB デバイス2 */
+#define FLEXSPI_CS_NUM                              (4)
+#define FLEXSPI_PORT_NUM                            (2)     /* ポート数(DLLCR[n]) */
+
+/* AHB(メモリマップド)アクセス窓 */
+#define FLEXSPI_AMBA_BASE                           (0x08000000U)
+
+/* RXサンプルクロックソース(MCR0.RXCLKSRC) */
+#define FLEXSPI_RXCLKSRC_LOOPBACK_INTERNAL          (0U)    /* 内部ループバック(低速向け) */
+#define FLEXSPI_RXCLKSRC_LOOPBACK_DQS               (1U)    /* DQSパッドからのループバック */
+#define FLEXSPI_RXCLKSRC_LOOPBACK_SCK               (2U)    /* SCKパッドからのループバック */
+#define FLEXSPI_RXCLKSRC_EXTERNAL_DQS               (3U)    /* デバイスが出力するDQS */
+
+/* DLL遅延セル数上書き値(DLLCR.OVRDVAL) */
+#define FLEXSPI_DLL_OVRDVAL_MAX                     (63U)
+
+/* デバイス種別(LUTのシーケンス構成。シーケンス番号の用途は共通) */
+#define FLEXSPI_DEVICE_QUAD                         (0U)    /* Quad SPI(1-4-4、Quadモードは読み出し毎に切り替え) */
+#define FLEXSPI_DEVICE_OCTAL_SDR                    (1U)    /* Octal SPI SDR(1-8-8、拡張SPIモードのまま使用) */
+#define FLEXSPI_DEVICE_OCTAL_DDR                    (2U)    /* Octal SPI DDR(8D-8D-8D、オープン時にOctal DDRモードへ移行) */
+#define FLEXSPI_DEVICE_NUM                          (3U)
+
+/* LUT命令パラメータのアドレス長(bit) */
+#define FLEXSPI_LUT_ADDR_24BIT                      (24U)   /* 3バイトアドレス命令 */
+#define FLEXSPI_LUT_ADDR_32BIT                      (32U)   /* 4バイトアドレス命令(既定) */
+
+/* パラレルモード(A1とB1を同時にアクセスし、偶数バイトをA1・奇数バイトをB1に格納する) */
+#define FLEXSPI_PARALLEL_OFF                        (0U)
+#define FLEXSPI_PARALLEL_ON                         (1U)
+#define FLEXSPI_PARALLEL_WIDTH                      (2U)    /* 1アドレスあたりのデバイス数 */
+
+/* AHB RXバッファ(AHBRXBUFCR0[n]、合計FLEXSPI_AHB_BUFFER_SIZEを分割して使用する) */
+#define FLEXSPI_AHB_BUFFER_SIZE                     (0x800U) /* 合計容量 */
+#define FLEXSPI_AHB_BUFFER_NUM                      (8U)    /* バッファ数 */
+#define FLEXSPI_AHB_BUFFER_DEFAULT                  (7U)    /* 他のバッファに割り当てのないマスターが使用するバッファ */
+#define FLEXSPI_AHB_PRIORITY_MAX                    (3U)    /* 優先度(0:低 - 3:高) */
+#define FLEXSPI_AHB_MASTER_ID_MAX                   (15U)   /* AHBマスターID(SoCのバス構成に依存) */
+
+/* IPコマンドの状態 */
+#define FLEXSPI_CMD_STATE_IDLE                      (0U)    /* 未登録・完了通知済み */
+#define FLEXSPI_CMD_STATE_QUEUED                    (1U)    /* 実行待ち */
+#define FLEXSPI_CMD_STATE_ACTIVE                    (2U)    /* 実行中 */
+#define FLEXSPI_CMD_STATE_DONE                      (3U)    /* 完了 */
+
+/****************************************************************************/
+/*  構造体定義                                                              */
+/****************************************************************************/
+
+/* DMA制御関数テーブル(プラットフォーム側で用意する) */
+typedef struct FlexSPI_DmaOps_tag {
+    /* DMA転送開始(ulBurst:1回のDMA要求で転送するバイト数) */
+    int     (*pfnStart)(uint32_t ulDir, uint32_t ulSrcAddr, uint32_t ulDstAddr, uint32_t ulSize, uint32_t ulBurst);
+    /* DMA転送中断 */
+    void    (*pfnAbort)(uint32_t ulDir);
+} FlexSPI_DmaOps;
+
+/* AHB RXバッファ構成(AHBRXBUFCR0[n]) */
+typedef struct FlexSPI_AhbBufConfig_tag {
+    uint32_t        ulMasterId;         /* 割り当てるAHBマスターID(FLEXSPI_AHB_BUFFER_DEFAULTでは無視される) */
+    uint32_t        ulSize;             /* バッファサイズ(バイト、8の倍数、0で未使用) */
+    uint32_t        ulPriority;         /* 優先度(0 - FLEXSPI_AHB_PRIORITY_MAX) */
+    uint32_t        ulPrefetch;         /* プリフェッチ(0:無効 1:有効) */
+} FlexSPI_AhbBufConfig;
+
+/* ルートクロック設定関数(プラットフォーム側で用意する、成功時0を返す) */
+typedef int (*FlexSPI_SetRootClockFunc)(uint32_t ulRootClk);
+
+/* LUT読み出し命令 */
+typedef struct FlexSPI_LutRead_tag {
+    uint8_t         ucOpcode;           /* 命令コード */
+    uint8_t         ucAddrPads;         /* アドレスの線数(kFLEXSPI_1PAD/2PAD/4PAD) */
+    uint8_t         ucDataPads;         /* ダミー・データの線数(kFLEXSPI_1PAD/2PAD/4PAD) */
+    uint8_t         ucDummy;            /* ダミーサイクル(モードクロックを含む) */
+} FlexSPI_LutRead;
+
+/* LUT命令パラメータ(Quad SPIのシーケンスと、Octal SPI SDRの消去シーケンスに適用する) */
+typedef struct FlexSPI_LutParam_tag {
+    uint8_t         ucAddrBits;         /* アドレス長(FLEXSPI_LUT_ADDR_*) */
+    FlexSPI_LutRead tSpiRead;           /* IP読み出し(拡張SPIモード) */
+    FlexSPI_LutRead tQpiRead;           /* IP読み出し(Quadモード、命令・アドレスも4線) */
+    FlexSPI_LutRead tAhbRead;           /* AHB読み出し(SDR) */
+    uint8_t         ucProgramOp;        /* ページプログラム */
+    uint8_t         ucProgramPads;      /* ページプログラムのデータの線数(kFLEXSPI_1PAD/4PAD) */
+    uint8_t         ucErase4KBOp;       /* 4KB消去 */
+    uint8_t         ucErase32KBOp;      /* 32KB消去 */
+    uint8_t         ucErase64KBOp;      /* 64KB消去 */
+    uint8_t         ucSuspendOp;        /* 消去中断 */
+    uint8_t         ucResumeOp;         /* 消去再開 */
+    uint8_t         ucEnterQuadOp;      /* Quadモード移行 */
+    uint8_t         ucResetQuadOp;      /* Quadモード解除 */
+} FlexSPI_LutParam;
+
+/* IPコマンド記述子(完了通知まで呼び出し元が領域を保持すること) */
+typedef struct FlexSPI_CmdDesc_tag {
+    uint32_t        ulSeqId;            /* LUTシーケンス番号 */
+    uint32_t        ulAddress;          /* SPI転送デバイスアドレス */
+    uint32_t        ulLength;           /* データ長(IPCR1.IDATSZ) */
+    uint32_t        ulDir;              /* データ転送方向(FLEXSPI_CMD_DIR_*) */
+    unsigned char   *pucBuf;            /* データバッファ(READ/WRITE時) */
+    /* 完了通知(割り込みコンテキストで呼び出される、NULL時は完了待ちタスクを起床する) */
+    void            (*pfnCallback)(struct FlexSPI_CmdDesc_tag *desc);
+    void            *pvExinf;           /* 呼び出し元の拡張情報 */
+    /* 以下はドライバが設定する */
+    volatile uint32_t ulState;          /* 状態(FLEXSPI_CMD_STATE_*) */
+    int             iResult;            /* 実行結果 */
+    int             iWaitTskId;         /* 完了待ちタスクID(TSK_NONE:なし) */
+    struct FlexSPI_CmdDesc_tag *ptNext; /* キューの次の記述子 */
+} FlexSPI_CmdDesc;
+
+/****************************************************************************/
+/*  関数宣言                                                                */
+/****************************************************************************/
+
+/* DMA制御関数登録 */
+int FlexSPI_SetDmaOps(const FlexSPI_DmaOps *ops);
+
+/* RX FIFO転送モード設定 */
+int FlexSPI_SetRxMode(FlexSPI_Type *base, uint32_t mode);
+
+/* TX FIFO転送モード設定 */
+int FlexSPI_SetTxMode(FlexSPI_Type *base, uint32_t mode);
+
+/* FIFOウォーターマーク設定 */
+int FlexSPI_SetWatermark(FlexSPI_Type *base, uint32_t rxBytes, uint32_t txBytes);
+
+/* DMA転送完了通知(DMA割り込みハンドラより呼び出す) */
+void FlexSPI_DmaCompleteHandler(uint32_t dir, int result);
+
+/* LUTシーケンス指定コマンド実行 */
+int FlexSPI_ExecSequence(FlexSPI_Type *base, uint32_t seqId, uint32_t address, uint32_t byteLength);
+
+/* LUTシーケンス指定ストリーミング読み出し(コマンド実行中にRX FIFOを取り出す) */
+int FlexSPI_ReadStream(FlexSPI_Type *base, uint32_t seqId, uint32_t address, unsigned char *buf, uint32_t size);
+
+/* LUTシーケンス指定コマンド実行&読み出し */
+unsigned char FlexSPI_ExecSequenceAndRead(FlexSPI_Type *base, uint32_t seqId, uint32_t address, uint32_t byteLength);
+
+/* LUTシーケンス指定TX FIFO書き込み＆コマンド実行 */
+int FlexSPI_WriteSequence(FlexSPI_Type *base, uint32_t seqId, unsigned char *txbuf, unsigned int address, uint32_t byteLength);
+
+/* LUT一括設定 */
+void FlexSPI_LoadLUTTable(FlexSPI_Type *base);
+
+/* LUT設定[4-Byte Sector Erase(64KB)](FlexSPI_SetErase32KBSectorSequenceは32KB消去を設定する) */
+void FlexSPI_SetErase64KBSectorSequence(FlexSPI_Type *base);
+
+/* LUT命令パラメータ設定・取得(次回のFlexSPI_LoadLUTTableから有効、NULL指定で既定値に戻す) */
+int FlexSPI_SetLutParam(const FlexSPI_LutParam *param);
+void FlexSPI_GetLutParam(FlexSPI_LutParam *param);
+
+/* デバイス種別設定・取得(FlexSPI_Open前に設定すること) */
+int FlexSPI_SetDeviceType(uint32_t type);
+uint32_t FlexSPI_GetDeviceType(void);
+
+/* IPコマンド登録(非同期実行) */
+int FlexSPI_SubmitCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc);
+
+/* IPコマンド登録(非同期実行、完了通知内から続けて登録する場合) */
+int FlexSPI_iSubmitCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc);
+
+/* IPコマンド取り消し(完了待ちタイムアウト時) */
+int FlexSPI_CancelCommand(FlexSPI_Type *base, FlexSPI_CmdDesc *desc);
+
+/* ルートクロック設定関数登録 */
+int FlexSPI_SetClockHook(FlexSPI_SetRootClockFunc pfnSetRootClock);
+
+/* RXサンプルクロックソース設定 */
+int FlexSPI_SetRxClockSource(FlexSPI_Type *base, uint32_t src);
+
+/* SCLK周波数変更(オープン中、全デバイス共通) */
+int FlexSPI_ChangeClock(FlexSPI_Type *base, const flexspi_device_config_t *config);
+
+/* サンプリング点設定(RXサンプルクロックソース・DLL遅延セル数上書き) */
+int FlexSPI_SetSampleDelay(FlexSPI_Type *base, int chip_select, uint32_t rxClkSrc, uint32_t ovrdVal);
+
+/* チップセレクト単位のクローズ(最後のデバイスではコントローラーも停止する) */
+int FlexSPI_CloseCS(FlexSPI_Type *base, int chip_select);
+
+/* デバイス先頭アドレス取得(IPコマンドのアドレス・AHB窓のオフセット) */
+uint32_t FlexSPI_GetDeviceBase(FlexSPI_Type *base, int chip_select);
+
+/* パラレルモード設定(A1+B1) */
+int FlexSPI_SetParallelMode(FlexSPI_Type *base, uint32_t mode);
+
+/* AHB RXバッファ分割設定(FLEXSPI_AHB_BUFFER_NUM個の構成を指定する) */
+int FlexSPI_SetAHBBufferConfig(FlexSPI_Type *base, const FlexSPI_AhbBufConfig *config);
+
+/* AHB RXバッファ分割取得 */
+void FlexSPI_GetAHBBufferConfig(FlexSPI_AhbBufConfig *config);
+
+/* AHB窓からの読み出し(メモリマップド読み出し) */
+int FlexSPI_ReadAHB(FlexSPI_Type *base, uint32_t address, unsigned char *buf, uint32_t size);
 
-#if 0
-int FROM_ReadMap( unsigned int uiFlashAddress, unsigned int uiLength, unsigned int uiSdramAddress );
+/* AHB読み出しデータ破棄(書き込み・消去後にAHB RXバッファ・データキャッシュを無効化する) */
+int FlexSPI_InvalidateAHB(FlexSPI_Type *base, uint32_t address, uint32_t size);
 
-#define FLEXSPI_AHB_BUFFER_SIZE     0x800
-#define FROM_CHIP_SIZE      (32 * 1024 * 1024)          /* FLASHのサイズ   32M */
-#endif
+/* RX FIFO判定・分割・複写(dri_flexspi_xfer.c、OS・割り込みに依存しない) */
+uint32_t FlexSPI_IsRxBlockReady(uint32_t ulIntr, uint32_t ulFifoSts, uint32_t ulBlock, uint32_t ulWatermark);
+uint32_t FlexSPI_GetRxDmaSize(const unsigned char *buf, uint32_t size, uint32_t ulMode, uint32_t ulWatermark);
+int FlexSPI_CheckAHBBufferConfig(const FlexSPI_AhbBufConfig *config);
+void FlexSPI_CopyRxBlock(FlexSPI_Type *base, unsigned char *buf, uint32_t size);
 
 #ifdef __cplusplus
 }
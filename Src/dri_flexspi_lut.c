@@ -36,6 +36,11 @@
 
 #define FLEXSPI_LUT_KEY_VAL             (0x5AF05AF0UL)  /* LUTKEYレジスタ設定値 */
 #define FLEXSPI_LUT_COMMANDSEQ_SIZE     (4U)            /* LUTシーケンスバッファの数 */
+#define FLEXSPI_LUT_DTR_DUMMY           (8U)            /* DTR読み出しのダミーサイクル(デバイス既定値) */
+#define FLEXSPI_LUT_OCTAL_DUMMY         (16U)           /* Octal読み出しのダミーサイクル(デバイス既定値) */
+#define FLEXSPI_LUT_OCTAL_STS_DUMMY     (8U)            /* Octal DDRモードのステータス読み出しダミーサイクル */
+#define FLEXSPI_LUT_SDR_DUMMY           (10U)           /* SDR読み出しのダミーサイクル(デバイス既定値) */
+#define FLEXSPI_LUT_SFDP_DUMMY          (8U)            /* SFDP読み出しのダミーサイクル(JESD216で固定) */
 
 /****************************************************************************/
 /* FLASHコマンド(使用するデバイス固有)                                      */
@@ -47,6 +52,7 @@
 #define FLASH_CMD_QUAD_OUTPUT           (0x6BU)     /* Quad Output Fast Read */
 #define FLASH_4BCMD_QUAD_OUTPUT         (0x6CU)     /* 4-Byte Quad Output Fast Read */
 #define FLASH_4BCMD_IO_FAST_READ        (0xECU)     /* 4-Byte Quad Input/Output Fast Read */
+#define FLASH_4BCMD_DTR_IO_FAST_READ    (0xEEU)     /* 4-Byte DTR Quad Input/Output Fast Read */
 
 #define FLASH_CMD_WRITE_ENABLE          (0x06U)     /* Write Enable */
 #define FLASH_CMD_WRITE_DISABLE         (0x04U)     /* Write Disable */
@@ -61,25 +67,189 @@
 #define FLASH_CMD_4K_ERASE              (0x20U)     /* 4KB Subsector Erase */
 #define FLASH_CMD_32K_ERASE             (0x52U)     /* 32KB Subsector Erase */
 #define FLASH_4BCMD_4K_ERASE            (0x21U)     /* 4-Byte 4KB Subsector Erase */
+#define FLASH_4BCMD_32K_ERASE           (0x5CU)     /* 4-Byte 32KB Subsector Erase */
 #define FLASH_4BCMD_64K_ERASE           (0xDCU)     /* 4-Byte Sector Erase(64KB) */
+#define FLASH_CMD_CHIP_ERASE            (0xC7U)     /* Bulk Erase */
+#define FLASH_CMD_SUSPEND               (0x75U)     /* Program/Erase Suspend */
+#define FLASH_CMD_RESUME                (0x7AU)     /* Program/Erase Resume */
 
 #define FLASH_CMD_ENTER_QUAD            (0x35U)     /* Enter Quad Input/Output Mode */
 #define FLASH_CMD_RESET_QUAD            (0xF5U)     /* Reset Quad Input/Output Mode */
 
+/* Octalデバイス */
+#define FLASH_4BCMD_OCTAL_IO_READ       (0xCCU)     /* 4-Byte Octal Input/Output Fast Read(1-8-8) */
+#define FLASH_4BCMD_OCTAL_DTR_READ      (0xFDU)     /* 4-Byte DTR Octal Input/Output Fast Read */
+#define FLASH_4BCMD_OCTAL_IO_PG         (0x8EU)     /* 4-Byte Octal Input/Output Fast Program(1-8-8) */
+#define FLASH_4BCMD_PAGE_PROGRAM        (0x12U)     /* 4-Byte Page Program */
+#define FLASH_CMD_WR_VOL_CFG            (0x81U)     /* Write Volatile Configuration Register */
+
 /****************************************************************************/
 /*  構造体定義                                                              */
 /****************************************************************************/
 
-/****************************************************************************/
-/*  ローカルデータ                                                          */
-/****************************************************************************/
+/* LUTレイアウト定義 */
+typedef struct FlexSPI_LutLayout_tag {
+    uint32_t    ulSeqId;                    /* 格納先シーケンス番号 */
+    void        (*pfnMake)(uint32_t *lut);  /* シーケンス作成関数 */
+} FlexSPI_LutLayout;
+
+/* デバイス種別毎のLUTレイアウト */
+typedef struct FlexSPI_LutSet_tag {
+    const FlexSPI_LutLayout *ptLayout;      /* LUTレイアウト */
+    uint32_t                ulNum;          /* シーケンス数 */
+} FlexSPI_LutSet;
 
 /****************************************************************************/
 /*  ローカル関数宣言                                                        */
 /****************************************************************************/
 
 /* LUT設定 */
-LOCAL void _FlexSPI_SetLUT(FlexSPI_Type *base, uint32_t *lut, uint8_t size);
+LOCAL void _FlexSPI_SetLUT(FlexSPI_Type *base, uint32_t seqId, uint32_t *lut, uint8_t size);
+
+/* LUTアンロック・ロック */
+LOCAL void _FlexSPI_UnlockLUT(FlexSPI_Type *base);
+LOCAL void _FlexSPI_LockLUT(FlexSPI_Type *base);
+
+/* LUTシーケンス作成 */
+LOCAL void _FlexSPI_MakeEnterQuadModeSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeResetQuadModeSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeWriteEnableSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeReadStatusSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeQuadIOReadSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeSpiIOReadSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeSDRReadSequence(uint32_t *lut, uint32_t cmdPads, const FlexSPI_LutRead *read);
+LOCAL void _FlexSPI_MakeQuadWriteSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeErase4KBSectorSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeErase32KBSectorSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeErase64KBSectorSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeChipEraseSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeSuspendSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeResumeSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeReadFlagStatusSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeQuadOutFastRdSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeQuadIODDRReadSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeAhbDDRReadSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeDDRReadSequence(uint32_t *lut, uint32_t cmdPads);
+LOCAL void _FlexSPI_MakeReadSFDPSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeAddressSequence(uint32_t *lut, uint32_t opcode);
+LOCAL void _FlexSPI_MakeEnterOctalSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalIOReadSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalIODDRReadSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalWriteSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRCommand(uint32_t *lut, uint32_t opcode);
+LOCAL void _FlexSPI_MakeOctalDDRWriteEnableSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRReadStatusSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRReadFlagStatusSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRReadSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRWriteSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRErase4KBSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRErase32KBSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRErase64KBSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRChipEraseSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRSuspendSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRResumeSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRExitSequence(uint32_t *lut);
+LOCAL void _FlexSPI_MakeOctalDDRStatus(uint32_t *lut, uint32_t opcode);
+LOCAL void _FlexSPI_MakeOctalDDRAddress(uint32_t *lut, uint32_t opcode, uint32_t opcode1, uint32_t operand1);
+
+/****************************************************************************/
+/*  ローカルデータ                                                          */
+/****************************************************************************/
+
+/* LUTレイアウト(FlexSPI_LoadLUTTableで設定するシーケンス) */
+/* Quad SPI */
+DLOCAL const FlexSPI_LutLayout l_tLutLayout[] = {
+    { FLEXSPI_SEQ_ENTER_QUAD,        _FlexSPI_MakeEnterQuadModeSequence },
+    { FLEXSPI_SEQ_RESET_QUAD,        _FlexSPI_MakeResetQuadModeSequence },
+    { FLEXSPI_SEQ_WRITE_ENABLE,      _FlexSPI_MakeWriteEnableSequence },
+    { FLEXSPI_SEQ_READ_STATUS,       _FlexSPI_MakeReadStatusSequence },
+    { FLEXSPI_SEQ_QUAD_IO_READ,      _FlexSPI_MakeQuadIOReadSequence },
+    { FLEXSPI_SEQ_QUAD_WRITE,        _FlexSPI_MakeQuadWriteSequence },
+    { FLEXSPI_SEQ_ERASE_4KB,         _FlexSPI_MakeErase4KBSectorSequence },
+    { FLEXSPI_SEQ_ERASE_64KB,        _FlexSPI_MakeErase64KBSectorSequence },
+    { FLEXSPI_SEQ_ERASE_32KB,        _FlexSPI_MakeErase32KBSectorSequence },
+    { FLEXSPI_SEQ_ERASE_CHIP,        _FlexSPI_MakeChipEraseSequence },
+    { FLEXSPI_SEQ_SUSPEND,           _FlexSPI_MakeSuspendSequence },
+    { FLEXSPI_SEQ_RESUME,            _FlexSPI_MakeResumeSequence },
+    { FLEXSPI_SEQ_READ_FLAG_STATUS,  _FlexSPI_MakeReadFlagStatusSequence },
+    { FLEXSPI_SEQ_AHB_READ,          _FlexSPI_MakeQuadOutFastRdSequence },
+    { FLEXSPI_SEQ_QUAD_IO_READ_DDR,  _FlexSPI_MakeQuadIODDRReadSequence },
+    { FLEXSPI_SEQ_AHB_READ_DDR,      _FlexSPI_MakeAhbDDRReadSequence },
+    { FLEXSPI_SEQ_SPI_IO_READ,       _FlexSPI_MakeSpiIOReadSequence },
+    { FLEXSPI_SEQ_SPI_IO_READ_DDR,   _FlexSPI_MakeAhbDDRReadSequence },
+    { FLEXSPI_SEQ_READ_SFDP,         _FlexSPI_MakeReadSFDPSequence },
+};
+
+/* Octal SPI SDR(拡張SPIモードのままアドレス・データを8線で転送) */
+DLOCAL const FlexSPI_LutLayout l_tLutLayoutOctalSdr[] = {
+    { FLEXSPI_SEQ_WRITE_ENABLE,      _FlexSPI_MakeWriteEnableSequence },
+    { FLEXSPI_SEQ_READ_STATUS,       _FlexSPI_MakeReadStatusSequence },
+    { FLEXSPI_SEQ_QUAD_IO_READ,      _FlexSPI_MakeOctalIOReadSequence },
+    { FLEXSPI_SEQ_QUAD_WRITE,        _FlexSPI_MakeOctalWriteSequence },
+    { FLEXSPI_SEQ_ERASE_4KB,         _FlexSPI_MakeErase4KBSectorSequence },
+    { FLEXSPI_SEQ_ERASE_64KB,        _FlexSPI_MakeErase64KBSectorSequence },
+    { FLEXSPI_SEQ_ERASE_32KB,        _FlexSPI_MakeErase32KBSectorSequence },
+    { FLEXSPI_SEQ_ERASE_CHIP,        _FlexSPI_MakeChipEraseSequence },
+    { FLEXSPI_SEQ_SUSPEND,           _FlexSPI_MakeSuspendSequence },
+    { FLEXSPI_SEQ_RESUME,            _FlexSPI_MakeResumeSequence },
+    { FLEXSPI_SEQ_READ_FLAG_STATUS,  _FlexSPI_MakeReadFlagStatusSequence },
+    { FLEXSPI_SEQ_AHB_READ,          _FlexSPI_MakeOctalIOReadSequence },
+    { FLEXSPI_SEQ_QUAD_IO_READ_DDR,  _FlexSPI_MakeOctalIODDRReadSequence },
+    { FLEXSPI_SEQ_AHB_READ_DDR,      _FlexSPI_MakeOctalIODDRReadSequence },
+    { FLEXSPI_SEQ_SPI_IO_READ,       _FlexSPI_MakeOctalIOReadSequence },
+    { FLEXSPI_SEQ_SPI_IO_READ_DDR,   _FlexSPI_MakeOctalIODDRReadSequence },
+    { FLEXSPI_SEQ_READ_SFDP,         _FlexSPI_MakeReadSFDPSequence },
+};
+
+/* Octal SPI DDR(オープン時にOctal DDRモードへ移行し、全コマンドを8D-8D-8Dで転送) */
+DLOCAL const FlexSPI_LutLayout l_tLutLayoutOctalDdr[] = {
+    { FLEXSPI_SEQ_WRITE_ENABLE,      _FlexSPI_MakeOctalDDRWriteEnableSequence },
+    { FLEXSPI_SEQ_READ_STATUS,       _FlexSPI_MakeOctalDDRReadStatusSequence },
+    { FLEXSPI_SEQ_QUAD_IO_READ,      _FlexSPI_MakeOctalDDRReadSequence },
+    { FLEXSPI_SEQ_QUAD_WRITE,        _FlexSPI_MakeOctalDDRWriteSequence },
+    { FLEXSPI_SEQ_ERASE_4KB,         _FlexSPI_MakeOctalDDRErase4KBSequence },
+    { FLEXSPI_SEQ_ERASE_64KB,        _FlexSPI_MakeOctalDDRErase64KBSequence },
+    { FLEXSPI_SEQ_ERASE_32KB,        _FlexSPI_MakeOctalDDRErase32KBSequence },
+    { FLEXSPI_SEQ_ERASE_CHIP,        _FlexSPI_MakeOctalDDRChipEraseSequence },
+    { FLEXSPI_SEQ_SUSPEND,           _FlexSPI_MakeOctalDDRSuspendSequence },
+    { FLEXSPI_SEQ_RESUME,            _FlexSPI_MakeOctalDDRResumeSequence },
+    { FLEXSPI_SEQ_READ_FLAG_STATUS,  _FlexSPI_MakeOctalDDRReadFlagStatusSequence },
+    { FLEXSPI_SEQ_AHB_READ,          _FlexSPI_MakeOctalDDRReadSequence },
+    { FLEXSPI_SEQ_QUAD_IO_READ_DDR,  _FlexSPI_MakeOctalDDRReadSequence },
+    { FLEXSPI_SEQ_AHB_READ_DDR,      _FlexSPI_MakeOctalDDRReadSequence },
+    { FLEXSPI_SEQ_SPI_IO_READ,       _FlexSPI_MakeOctalDDRReadSequence },
+    { FLEXSPI_SEQ_SPI_IO_READ_DDR,   _FlexSPI_MakeOctalDDRReadSequence },
+    { FLEXSPI_SEQ_SPI_WRITE_ENABLE,  _FlexSPI_MakeWriteEnableSequence },
+    { FLEXSPI_SEQ_ENTER_OCTAL,       _FlexSPI_MakeEnterOctalSequence },
+    { FLEXSPI_SEQ_EXIT_OCTAL,        _FlexSPI_MakeOctalDDRExitSequence },
+    { FLEXSPI_SEQ_READ_SFDP,         _FlexSPI_MakeReadSFDPSequence },     /* Octal DDRモード移行前に使用 */
+};
+
+/* デバイス種別毎のLUTレイアウト(FLEXSPI_DEVICE_*順) */
+DLOCAL const FlexSPI_LutSet l_tLutSet[FLEXSPI_DEVICE_NUM] = {
+    { l_tLutLayout,         sizeof(l_tLutLayout) / sizeof(l_tLutLayout[0]) },                   /* FLEXSPI_DEVICE_QUAD */
+    { l_tLutLayoutOctalSdr, sizeof(l_tLutLayoutOctalSdr) / sizeof(l_tLutLayoutOctalSdr[0]) },   /* FLEXSPI_DEVICE_OCTAL_SDR */
+    { l_tLutLayoutOctalDdr, sizeof(l_tLutLayoutOctalDdr) / sizeof(l_tLutLayoutOctalDdr[0]) },   /* FLEXSPI_DEVICE_OCTAL_DDR */
+};
+
+/* デバイス種別(FLEXSPI_DEVICE_*) */
+DLOCAL uint32_t l_ulDeviceType = FLEXSPI_DEVICE_QUAD;
+
+/* LUT命令パラメータ既定値(使用するデバイス固有) */
+DLOCAL const FlexSPI_LutParam l_tLutParamDefault = {
+    FLEXSPI_LUT_ADDR_32BIT,
+    { FLASH_4BCMD_IO_FAST_READ, kFLEXSPI_4PAD, kFLEXSPI_4PAD, FLEXSPI_LUT_SDR_DUMMY },    /* tSpiRead(1-4-4) */
+    { FLASH_4BCMD_IO_FAST_READ, kFLEXSPI_4PAD, kFLEXSPI_4PAD, FLEXSPI_LUT_SDR_DUMMY },    /* tQpiRead(4-4-4) */
+    { FLASH_4BCMD_QUAD_OUTPUT,  kFLEXSPI_1PAD, kFLEXSPI_4PAD, FLEXSPI_LUT_SDR_DUMMY },    /* tAhbRead(1-1-4) */
+    FLASH_4BCMD_QUAD_I_FST_PG,  kFLEXSPI_4PAD,
+    FLASH_4BCMD_4K_ERASE,       FLASH_4BCMD_32K_ERASE,  FLASH_4BCMD_64K_ERASE,
+    FLASH_CMD_SUSPEND,          FLASH_CMD_RESUME,
+    FLASH_CMD_ENTER_QUAD,       FLASH_CMD_RESET_QUAD,
+};
+
+/* LUT命令パラメータ(FlexSPI_SetLutParamで設定した値、または既定値を指す) */
+DLOCAL FlexSPI_LutParam l_tLutParam;
+DLOCAL const FlexSPI_LutParam *l_ptLutParam = &l_tLutParamDefault;
 
 /****************************************************************************/
 /*  提供関数                                                                */
@@ -101,15 +271,8 @@ void FlexSPI_SetEnterQuadModeSequence(FlexSPI_Type *base)
 {
 uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
 
-    lut[0] |= ((kFLEXSPI_Command_SDR    << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_1PAD           << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (FLASH_CMD_ENTER_QUAD    << FlexSPI_LUT_OPERAND0_SHIFT)  |
-
-               (kFLEXSPI_Command_STOP   << FlexSPI_LUT_OPCODE1_SHIFT)   |
-               (kFLEXSPI_1PAD           << FlexSPI_LUT_NUM_PADS1_SHIFT) |
-               (0                       << FlexSPI_LUT_OPERAND1_SHIFT));
-
-    _FlexSPI_SetLUT(base, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
+    _FlexSPI_MakeEnterQuadModeSequence(lut);
+    _FlexSPI_SetLUT(base, FLEXSPI_SEQ_SCRATCH, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
 }
 
 /************************************************************************************************/
@@ -128,15 +291,8 @@ void FlexSPI_SetResetQuadModeSequence(FlexSPI_Type *base)
 {
 uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
 
-    lut[0] |= ((kFLEXSPI_Command_SDR    << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_4PAD           << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (FLASH_CMD_RESET_QUAD    << FlexSPI_LUT_OPERAND0_SHIFT)  |
-
-               (kFLEXSPI_Command_STOP   << FlexSPI_LUT_OPCODE1_SHIFT)   |
-               (kFLEXSPI_4PAD           << FlexSPI_LUT_NUM_PADS1_SHIFT) |
-               (0                       << FlexSPI_LUT_OPERAND1_SHIFT));
-
-    _FlexSPI_SetLUT(base, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
+    _FlexSPI_MakeResetQuadModeSequence(lut);
+    _FlexSPI_SetLUT(base, FLEXSPI_SEQ_SCRATCH, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
 }
 
 /************************************************************************************************/
@@ -155,15 +311,8 @@ void FlexSPI_SetWriteEnableSequence(FlexSPI_Type *base)
 {
 uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
 
-    lut[0] |= ((kFLEXSPI_Command_SDR    << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_1PAD           << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (FLASH_CMD_WRITE_ENABLE  << FlexSPI_LUT_OPERAND0_SHIFT)  |
-
-               (kFLEXSPI_Command_STOP   << FlexSPI_LUT_OPCODE1_SHIFT)   |
-               (kFLEXSPI_1PAD           << FlexSPI_LUT_NUM_PADS1_SHIFT) |
-               (0                       << FlexSPI_LUT_OPERAND1_SHIFT));
-
-    _FlexSPI_SetLUT(base, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
+    _FlexSPI_MakeWriteEnableSequence(lut);
+    _FlexSPI_SetLUT(base, FLEXSPI_SEQ_SCRATCH, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
 }
 
 /************************************************************************************************/
@@ -182,15 +331,8 @@ void FlexSPI_SetReadStatusSequence(FlexSPI_Type *base)
 {
 uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
 
-    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (FLASH_CMD_RD_STATUS         << FlexSPI_LUT_OPERAND0_SHIFT)  |
-
-               (kFLEXSPI_Command_READ_SDR   << FlexSPI_LUT_OPCODE1_SHIFT)   |
-               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
-               (1                           << FlexSPI_LUT_OPERAND1_SHIFT));    /* 1バイト読み込み */
-
-    _FlexSPI_SetLUT(base, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
+    _FlexSPI_MakeReadStatusSequence(lut);
+    _FlexSPI_SetLUT(base, FLEXSPI_SEQ_SCRATCH, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
 }
 
 /************************************************************************************************/
@@ -209,27 +351,8 @@ void FlexSPI_SetQuadIOReadSequence(FlexSPI_Type *base)
 {
 uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
 
-    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_4PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (FLASH_4BCMD_IO_FAST_READ    << FlexSPI_LUT_OPERAND0_SHIFT)  |
-
-               (kFLEXSPI_Command_RADDR_SDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
-               (kFLEXSPI_4PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
-               ((4 * 8)                     << FlexSPI_LUT_OPERAND1_SHIFT));    /* アドレスは32bit */
-
-    lut[1] |= ((kFLEXSPI_Command_DUMMY_SDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_4PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (10                          << FlexSPI_LUT_OPERAND0_SHIFT)  |   /* ダミーサイクル */
-
-               (kFLEXSPI_Command_READ_SDR   << FlexSPI_LUT_OPCODE1_SHIFT)   |
-               (kFLEXSPI_4PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
-               (0                           << FlexSPI_LUT_OPERAND1_SHIFT));
-
-    lut[2] |=  ((kFLEXSPI_Command_STOP      << FlexSPI_LUT_OPCODE0_SHIFT)   |
-                (kFLEXSPI_4PAD              << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-                (0                          << FlexSPI_LUT_OPERAND0_SHIFT));
-
-    _FlexSPI_SetLUT(base, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
+    _FlexSPI_MakeQuadIOReadSequence(lut);
+    _FlexSPI_SetLUT(base, FLEXSPI_SEQ_SCRATCH, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
 }
 
 /************************************************************************************************/
@@ -248,19 +371,8 @@ void FlexSPI_SetQuadWriteSequence(FlexSPI_Type *base)
 {
 uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
 
-    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (FLASH_4BCMD_QUAD_I_FST_PG   << FlexSPI_LUT_OPERAND0_SHIFT)  |
-
-               (kFLEXSPI_Command_RADDR_SDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
-               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
-               ((4 * 8)                     << FlexSPI_LUT_OPERAND1_SHIFT));    /* アドレスは32bit */
-
-    lut[1] |= ((kFLEXSPI_Command_WRITE_SDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_4PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (0                           << FlexSPI_LUT_OPERAND0_SHIFT));
-
-    _FlexSPI_SetLUT(base, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
+    _FlexSPI_MakeQuadWriteSequence(lut);
+    _FlexSPI_SetLUT(base, FLEXSPI_SEQ_SCRATCH, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
 }
 
 /************************************************************************************************/
@@ -279,21 +391,14 @@ void FlexSPI_SetErase4KBSectorSequence(FlexSPI_Type *base)
 {
 uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
 
-    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (FLASH_4BCMD_4K_ERASE        << FlexSPI_LUT_OPERAND0_SHIFT)  |
-
-               (kFLEXSPI_Command_RADDR_SDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
-               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
-               ((4 * 8)                     << FlexSPI_LUT_OPERAND1_SHIFT));    /* アドレスは32bit */
-
-    _FlexSPI_SetLUT(base, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
+    _FlexSPI_MakeErase4KBSectorSequence(lut);
+    _FlexSPI_SetLUT(base, FLEXSPI_SEQ_SCRATCH, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
 }
 
 /************************************************************************************************/
-/* FUNCTION   : FlexSPI_SetErase4KBSectorSequence                                               */
+/* FUNCTION   : FlexSPI_SetErase32KBSectorSequence                                              */
 /*                                                                                              */
-/* DESCRIPTION: LUT設定[4-Byte Sector Erase(64KB)]                                              */
+/* DESCRIPTION: LUT設定[4-Byte 32KB Subsector Erase]                                            */
 /*----------------------------------------------------------------------------------------------*/
 /* INPUT      : base                            FlexSPIコントローラーベースアドレス             */
 /*                                                                                              */
@@ -306,15 +411,28 @@ void FlexSPI_SetErase32KBSectorSequence(FlexSPI_Type *base)
 {
 uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
 
-    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (FLASH_4BCMD_64K_ERASE       << FlexSPI_LUT_OPERAND0_SHIFT)  |
+    _FlexSPI_MakeErase32KBSectorSequence(lut);
+    _FlexSPI_SetLUT(base, FLEXSPI_SEQ_SCRATCH, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
+}
 
-               (kFLEXSPI_Command_RADDR_SDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
-               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
-               ((4 * 8)                     << FlexSPI_LUT_OPERAND1_SHIFT));    /* アドレスは32bit */
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SetErase64KBSectorSequence                                              */
+/*                                                                                              */
+/* DESCRIPTION: LUT設定[4-Byte Sector Erase(64KB)]                                              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーベースアドレス             */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+void FlexSPI_SetErase64KBSectorSequence(FlexSPI_Type *base)
+{
+uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
 
-    _FlexSPI_SetLUT(base, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
+    _FlexSPI_MakeErase64KBSectorSequence(lut);
+    _FlexSPI_SetLUT(base, FLEXSPI_SEQ_SCRATCH, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
 }
 
 /************************************************************************************************/
@@ -333,15 +451,8 @@ void FlexSPI_SetReadFlagStatusSequence(FlexSPI_Type *base)
 {
 uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
 
-    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (FLASH_CMD_RD_FLAG_STAT      << FlexSPI_LUT_OPERAND0_SHIFT)  |
-
-               (kFLEXSPI_Command_READ_SDR   << FlexSPI_LUT_OPCODE1_SHIFT)   |
-               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
-               (1                           << FlexSPI_LUT_OPERAND1_SHIFT));    /* １バイト読み込み */
-
-    _FlexSPI_SetLUT(base, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
+    _FlexSPI_MakeReadFlagStatusSequence(lut);
+    _FlexSPI_SetLUT(base, FLEXSPI_SEQ_SCRATCH, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
 }
 
 /************************************************************************************************/
@@ -359,35 +470,157 @@ uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
 void FlexSPI_SetQuadOutFastRdSequence(FlexSPI_Type *base)
 {
 uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
-int i = 0;
 
-    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (FLASH_4BCMD_QUAD_OUTPUT     << FlexSPI_LUT_OPERAND0_SHIFT)  |
+    _FlexSPI_MakeQuadOutFastRdSequence(lut);
+    _FlexSPI_SetLUT(base, FLEXSPI_SEQ_AHB_READ, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
+}
 
-               (kFLEXSPI_Command_RADDR_SDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
-               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
-               ((4 * 8)                     << FlexSPI_LUT_OPERAND1_SHIFT));    /* アドレスは32bit */
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_LoadLUTTable                                                            */
+/*                                                                                              */
+/* DESCRIPTION: LUT一括設定                                                                     */
+/*              デバイス種別のLUTレイアウトの全シーケンスを各シーケンス番号へ設定する           */
+/*              (LUTKEY/LUTCRによるアンロック・ロックは1回のみ)                                 */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーベースアドレス             */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+void FlexSPI_LoadLUTTable(FlexSPI_Type *base)
+{
+uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
+const FlexSPI_LutSet *ptSet               = &l_tLutSet[l_ulDeviceType];
+uint32_t i = 0;
+uint32_t j = 0;
 
-    lut[1] |= ((kFLEXSPI_Command_DUMMY_SDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
-               (kFLEXSPI_4PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
-               (10                          << FlexSPI_LUT_OPERAND0_SHIFT)  |   /* ダミークロック */
+    /* LUTアンロック */
+    _FlexSPI_UnlockLUT(base);
 
-               (kFLEXSPI_Command_READ_SDR   << FlexSPI_LUT_OPCODE1_SHIFT)   |
-               (kFLEXSPI_4PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
-               (0                           << FlexSPI_LUT_OPERAND1_SHIFT));
+    /* LUTクリア(デバイス種別で使用しないシーケンスはSTOPのみとする) */
+    for (i = 0; i < (FLEXSPI_SEQ_MAX * FLEXSPI_LUT_COMMANDSEQ_SIZE); i++) {
+        base->LUT[i] = 0;
+    }
 
-    /* LUTアンロック */
-    base->LUTKEY = FLEXSPI_LUT_KEY_VAL;
-    base->LUTCR  = FlexSPI_LUTCR_LOCK(0) | FlexSPI_LUTCR_UNLOCK(1);
+    /* LUT設定 */
+    for (i = 0; i < ptSet->ulNum; i++) {
+        memset(lut, 0, sizeof(lut));
+        ptSet->ptLayout[i].pfnMake(lut);
 
-    /* 設定しているLUTテーブルが他と異なることに注意 */
-    for (i = 0; i < FLEXSPI_LUT_COMMANDSEQ_SIZE; i++) {
-        base->LUT[4+i] = lut[i];
+        for (j = 0; j < FLEXSPI_LUT_COMMANDSEQ_SIZE; j++) {
+            base->LUT[(ptSet->ptLayout[i].ulSeqId * FLEXSPI_LUT_COMMANDSEQ_SIZE) + j] = lut[j];
+        }
     }
+
     /* LUTロック */
-    base->LUTKEY = FLEXSPI_LUT_KEY_VAL;
-    base->LUTCR  = FlexSPI_LUTCR_LOCK(1) | FlexSPI_LUTCR_UNLOCK(0);
+    _FlexSPI_LockLUT(base);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SetLutParam                                                             */
+/*                                                                                              */
+/* DESCRIPTION: LUT命令パラメータ設定                                                           */
+/*              次回のFlexSPI_LoadLUTTableから有効(NULL指定で既定値に戻す)                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : param                           LUT命令パラメータ                               */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SetLutParam(const FlexSPI_LutParam *param)
+{
+    if (param == NULL) {
+        l_ptLutParam = &l_tLutParamDefault;
+        return FLEXSPI_E_SUCCESS;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* パラメータチェック(読み出しは4線まで) */
+    if (((param->ucAddrBits != FLEXSPI_LUT_ADDR_24BIT) && (param->ucAddrBits != FLEXSPI_LUT_ADDR_32BIT)) ||
+        (kFLEXSPI_4PAD < param->tSpiRead.ucAddrPads) || (kFLEXSPI_4PAD < param->tSpiRead.ucDataPads) ||
+        (kFLEXSPI_4PAD < param->tQpiRead.ucAddrPads) || (kFLEXSPI_4PAD < param->tQpiRead.ucDataPads) ||
+        (kFLEXSPI_4PAD < param->tAhbRead.ucAddrPads) || (kFLEXSPI_4PAD < param->tAhbRead.ucDataPads) ||
+        (kFLEXSPI_4PAD < param->ucProgramPads)) {
+        return FLEXSPI_E_PARAM;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    l_tLutParam  = *param;
+    l_ptLutParam = &l_tLutParam;
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_GetLutParam                                                             */
+/*                                                                                              */
+/* DESCRIPTION: LUT命令パラメータ取得                                                           */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : param                           LUT命令パラメータ                               */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+void FlexSPI_GetLutParam(FlexSPI_LutParam *param)
+{
+    *param = *l_ptLutParam;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SetDeviceType                                                           */
+/*                                                                                              */
+/* DESCRIPTION: デバイス種別設定                                                                */
+/*              次回のFlexSPI_Open(FlexSPI_LoadLUTTable)から有効                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : type                            デバイス種別(FLEXSPI_DEVICE_*)                  */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SetDeviceType(uint32_t type)
+{
+    /* パラメータチェック */
+    if (FLEXSPI_DEVICE_NUM <= type) {
+        return FLEXSPI_E_PARAM;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    l_ulDeviceType = type;
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_GetDeviceType                                                           */
+/*                                                                                              */
+/* DESCRIPTION: デバイス種別取得                                                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_DEVICE_*                デバイス種別                                    */
+/*                                                                                              */
+/************************************************************************************************/
+uint32_t FlexSPI_GetDeviceType(void)
+{
+    return l_ulDeviceType;
 }
 
 /****************************************************************************/
@@ -399,6 +632,7 @@ int i = 0;
 /* DESCRIPTION: LUT設定                                                                         */
 /*----------------------------------------------------------------------------------------------*/
 /* INPUT      : base                            FlexSPIコントローラーベースアドレス             */
+/*            : seqId                           設定先シーケンス番号                            */
 /*            : lut                             LUTテーブル                                     */
 /*            : size                            設定数                                          */
 /*                                                                                              */
@@ -407,22 +641,20 @@ int i = 0;
 /* RESULTS    : none                                                                            */
 /*                                                                                              */
 /************************************************************************************************/
-LOCAL void _FlexSPI_SetLUT(FlexSPI_Type *base, uint32_t *lut, uint8_t size)
+LOCAL void _FlexSPI_SetLUT(FlexSPI_Type *base, uint32_t seqId, uint32_t *lut, uint8_t size)
 {
 int i = 0;
 
     /* LUTアンロック */
-    base->LUTKEY = FLEXSPI_LUT_KEY_VAL;
-    base->LUTCR  = FlexSPI_LUTCR_LOCK(0) | FlexSPI_LUTCR_UNLOCK(1);
+    _FlexSPI_UnlockLUT(base);
 
     /* LUT設定 */
     for (i = 0; i < size; i++) {
-        base->LUT[i] = lut[i];
+        base->LUT[(seqId * FLEXSPI_LUT_COMMANDSEQ_SIZE) + i] = lut[i];
     }
 
     /* LUTロック */
-    base->LUTKEY = FLEXSPI_LUT_KEY_VAL;
-    base->LUTCR  = FlexSPI_LUTCR_LOCK(1) | FlexSPI_LUTCR_UNLOCK(0);
+    _FlexSPI_LockLUT(base);
 
 #if 0
     PRINT("LUT: ");
@@ -434,56 +666,948 @@ int i = 0;
 #endif
 }
 
-#if 0
-/*******************************************************************
- * @fn FlexSPI_SetWriteDisableSequence
- * @brief LUT登録  WRITE DISABLE
- * @param FlexSPI_Type 対象のFlexSPIレジスタ
- * @note 
- *
- ******************************************************************/
-void FlexSPI_SetWriteDisableSequence(FlexSPI_Type *base)
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_UnlockLUT                                                              */
+/*                                                                                              */
+/* DESCRIPTION: LUTアンロック                                                                   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーベースアドレス             */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_UnlockLUT(FlexSPI_Type *base)
 {
-    uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
-
-    lut[0] |= kFLEXSPI_Command_SDR      << FlexSPI_LUT_OPCODE0_SHIFT |
-              kFLEXSPI_1PAD             << FlexSPI_LUT_NUM_PADS0_SHIFT |
-              FLASH_CMD_WRITE_DISABLE   << FlexSPI_LUT_OPERAND0_SHIFT |
-              kFLEXSPI_Command_STOP     << FlexSPI_LUT_OPCODE1_SHIFT |
-              kFLEXSPI_1PAD             << FlexSPI_LUT_NUM_PADS1_SHIFT |
-              0                         << FlexSPI_LUT_OPERAND1_SHIFT;
-
-    _FlexSPI_SetLUT(base, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
+    base->LUTKEY = FLEXSPI_LUT_KEY_VAL;
+    base->LUTCR  = FlexSPI_LUTCR_LOCK(0) | FlexSPI_LUTCR_UNLOCK(1);
 }
 
-/*******************************************************************
- * @fn FlexSPI_SetReadSFDPSequence
- * @brief LUT登録  READ SERIAL FLASH DISCOVERY PARAMETER
- * @param FlexSPI_Type 対象のFlexSPIレジスタ
- * @note 
- *
- ******************************************************************/
-void FlexSPI_SetReadSFDPSequence(FlexSPI_Type *base, flexspi_pad_t pad)
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_LockLUT                                                                */
+/*                                                                                              */
+/* DESCRIPTION: LUTロック                                                                       */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーベースアドレス             */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_LockLUT(FlexSPI_Type *base)
 {
-    uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
+    base->LUTKEY = FLEXSPI_LUT_KEY_VAL;
+    base->LUTCR  = FlexSPI_LUTCR_LOCK(1) | FlexSPI_LUTCR_UNLOCK(0);
+}
 
-    lut[0] |= kFLEXSPI_Command_SDR          << FlexSPI_LUT_OPCODE0_SHIFT |
-              pad                           << FlexSPI_LUT_NUM_PADS0_SHIFT |
-              FLASH_CMD_READ_SFDP           << FlexSPI_LUT_OPERAND0_SHIFT |
-              kFLEXSPI_Command_RADDR_SDR    << FlexSPI_LUT_OPCODE1_SHIFT |
-              pad                           << FlexSPI_LUT_NUM_PADS1_SHIFT |
-              (4 * 8)                       << FlexSPI_LUT_OPERAND1_SHIFT; // アドレスは4バイト
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeEnterQuadModeSequence                                              */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Enter Quad Input/Output Mode]                                 */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeEnterQuadModeSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR    << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD           << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               ((uint32_t)l_ptLutParam->ucEnterQuadOp << FlexSPI_LUT_OPERAND0_SHIFT) |
+
+               (kFLEXSPI_Command_STOP   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_1PAD           << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (0                       << FlexSPI_LUT_OPERAND1_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeResetQuadModeSequence                                              */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Reset Quad Input/Output Mode]                                 */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeResetQuadModeSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR    << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_4PAD           << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               ((uint32_t)l_ptLutParam->ucResetQuadOp << FlexSPI_LUT_OPERAND0_SHIFT) |
+
+               (kFLEXSPI_Command_STOP   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_4PAD           << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (0                       << FlexSPI_LUT_OPERAND1_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeWriteEnableSequence                                                */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Write Enable]                                                 */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeWriteEnableSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR    << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD           << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (FLASH_CMD_WRITE_ENABLE  << FlexSPI_LUT_OPERAND0_SHIFT)  |
+
+               (kFLEXSPI_Command_STOP   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_1PAD           << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (0                       << FlexSPI_LUT_OPERAND1_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeReadStatusSequence                                                 */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Read Status Register]                                         */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeReadStatusSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (FLASH_CMD_RD_STATUS         << FlexSPI_LUT_OPERAND0_SHIFT)  |
+
+               (kFLEXSPI_Command_READ_SDR   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (1                           << FlexSPI_LUT_OPERAND1_SHIFT));    /* 1バイト読み込み */
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeQuadIOReadSequence                                                 */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte Quad Input/Output Fast Read]                           */
+/*              Quadモード中のIP読み出し用(コマンドも4線で送信する)                             */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeQuadIOReadSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeSDRReadSequence(lut, kFLEXSPI_4PAD, &l_ptLutParam->tQpiRead);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeSpiIOReadSequence                                                  */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte Quad Input/Output Fast Read]                           */
+/*              拡張SPIモードのIP読み出し用(コマンドは1線で送信する、Quadモード移行不要)        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeSpiIOReadSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeSDRReadSequence(lut, kFLEXSPI_1PAD, &l_ptLutParam->tSpiRead);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeSDRReadSequence                                                    */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[SDR読み出し]共通部                                            */
+/*              命令・アドレス長・線数・ダミーサイクルはLUT命令パラメータに従う                 */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : cmdPads                         コマンドの線数(kFLEXSPI_1PAD / kFLEXSPI_4PAD)   */
+/*            : read                            読み出し命令(LUT命令パラメータ)                 */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeSDRReadSequence(uint32_t *lut, uint32_t cmdPads, const FlexSPI_LutRead *read)
+{
+uint32_t addrPads = (cmdPads == kFLEXSPI_4PAD) ? kFLEXSPI_4PAD : (uint32_t)read->ucAddrPads;
+
+    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (cmdPads                     << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               ((uint32_t)read->ucOpcode    << FlexSPI_LUT_OPERAND0_SHIFT)  |
+
+               (kFLEXSPI_Command_RADDR_SDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (addrPads                    << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               ((uint32_t)l_ptLutParam->ucAddrBits << FlexSPI_LUT_OPERAND1_SHIFT));
+
+    if (read->ucDummy != 0U) {
+        lut[1] |= ((kFLEXSPI_Command_DUMMY_SDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
+                   ((uint32_t)read->ucDataPads  << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+                   ((uint32_t)read->ucDummy     << FlexSPI_LUT_OPERAND0_SHIFT)  |   /* ダミーサイクル */
+
+                   (kFLEXSPI_Command_READ_SDR   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+                   ((uint32_t)read->ucDataPads  << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+                   (0                           << FlexSPI_LUT_OPERAND1_SHIFT));
+    }
+    else {
+        lut[1] |= ((kFLEXSPI_Command_READ_SDR   << FlexSPI_LUT_OPCODE0_SHIFT)   |
+                   ((uint32_t)read->ucDataPads  << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+                   (0                           << FlexSPI_LUT_OPERAND0_SHIFT));
+    }
+
+    lut[2] |=  ((kFLEXSPI_Command_STOP      << FlexSPI_LUT_OPCODE0_SHIFT)   |
+                (kFLEXSPI_4PAD              << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+                (0                          << FlexSPI_LUT_OPERAND0_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeQuadWriteSequence                                                  */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte Quad Input Fast Program]                               */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeQuadWriteSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeAddressSequence(lut, l_ptLutParam->ucProgramOp);
+
+    lut[1] |= ((kFLEXSPI_Command_WRITE_SDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               ((uint32_t)l_ptLutParam->ucProgramPads << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (0                           << FlexSPI_LUT_OPERAND0_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeErase4KBSectorSequence                                             */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte 4KB Subsector Erase]                                   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeErase4KBSectorSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeAddressSequence(lut, l_ptLutParam->ucErase4KBOp);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeErase32KBSectorSequence                                            */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte 32KB Subsector Erase]                                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeErase32KBSectorSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeAddressSequence(lut, l_ptLutParam->ucErase32KBOp);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeErase64KBSectorSequence                                            */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte Sector Erase(64KB)]                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeErase64KBSectorSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeAddressSequence(lut, l_ptLutParam->ucErase64KBOp);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeChipEraseSequence                                                  */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Bulk Erase]                                                   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeChipEraseSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (FLASH_CMD_CHIP_ERASE        << FlexSPI_LUT_OPERAND0_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeSuspendSequence                                                    */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Program/Erase Suspend]                                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeSuspendSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR    << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD           << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               ((uint32_t)l_ptLutParam->ucSuspendOp << FlexSPI_LUT_OPERAND0_SHIFT) |
+
+               (kFLEXSPI_Command_STOP   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_1PAD           << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (0                       << FlexSPI_LUT_OPERAND1_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeResumeSequence                                                     */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Program/Erase Resume]                                         */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeResumeSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR    << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD           << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               ((uint32_t)l_ptLutParam->ucResumeOp << FlexSPI_LUT_OPERAND0_SHIFT) |
+
+               (kFLEXSPI_Command_STOP   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_1PAD           << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (0                       << FlexSPI_LUT_OPERAND1_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeReadFlagStatusSequence                                             */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Read Flag Status Register]                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeReadFlagStatusSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (FLASH_CMD_RD_FLAG_STAT      << FlexSPI_LUT_OPERAND0_SHIFT)  |
+
+               (kFLEXSPI_Command_READ_SDR   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (1                           << FlexSPI_LUT_OPERAND1_SHIFT));    /* １バイト読み込み */
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeQuadOutFastRdSequence                                              */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[AHB読み出し](既定値は4-Byte Quad Output Fast Read)  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeQuadOutFastRdSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeSDRReadSequence(lut, kFLEXSPI_1PAD, &l_ptLutParam->tAhbRead);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeQuadIODDRReadSequence                                              */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte DTR Quad Input/Output Fast Read]                       */
+/*              Quadモード中のIP読み出し用(コマンドも4線で送信する)                             */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeQuadIODDRReadSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeDDRReadSequence(lut, kFLEXSPI_4PAD);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeAhbDDRReadSequence                                                 */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte DTR Quad Input/Output Fast Read]                       */
+/*              AHB読み出し用(拡張SPIモードのためコマンドは1線で送信する)                       */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeAhbDDRReadSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeDDRReadSequence(lut, kFLEXSPI_1PAD);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeDDRReadSequence                                                    */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte DTR Quad Input/Output Fast Read]共通部                 */
+/*              コマンドは片エッジ(SDR)、アドレス・ダミー・データは両エッジで転送する           */
+/*              DUMMY_DDRのオペランドは半サイクル単位のためダミーサイクル数の2倍を設定する      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : cmdPads                         コマンドの線数(kFLEXSPI_1PAD / kFLEXSPI_4PAD)   */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeDDRReadSequence(uint32_t *lut, uint32_t cmdPads)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (cmdPads                     << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (FLASH_4BCMD_DTR_IO_FAST_READ << FlexSPI_LUT_OPERAND0_SHIFT) |
+
+               (kFLEXSPI_Command_RADDR_DDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_4PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               ((4 * 8)                     << FlexSPI_LUT_OPERAND1_SHIFT));    /* アドレスは32bit */
+
+    lut[1] |= ((kFLEXSPI_Command_DUMMY_DDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_4PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               ((FLEXSPI_LUT_DTR_DUMMY * 2U) << FlexSPI_LUT_OPERAND0_SHIFT) |   /* ダミーサイクル(半サイクル単位) */
+
+               (kFLEXSPI_Command_READ_DDR   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_4PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (0                           << FlexSPI_LUT_OPERAND1_SHIFT));
+
+    lut[2] |=  ((kFLEXSPI_Command_STOP      << FlexSPI_LUT_OPCODE0_SHIFT)   |
+                (kFLEXSPI_4PAD              << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+                (0                          << FlexSPI_LUT_OPERAND0_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeReadSFDPSequence                                                   */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Read Serial Flash Discovery Parameter](1-1-1)                 */
+/*              アドレスは24bit、ダミーサイクルは8(JESD216で固定)                               */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeReadSFDPSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (FLASH_CMD_READ_SFDP         << FlexSPI_LUT_OPERAND0_SHIFT)  |
+
+               (kFLEXSPI_Command_RADDR_SDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               ((3 * 8)                     << FlexSPI_LUT_OPERAND1_SHIFT));    /* アドレスは24bit */
+
+    lut[1] |= ((kFLEXSPI_Command_DUMMY_SDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (FLEXSPI_LUT_SFDP_DUMMY      << FlexSPI_LUT_OPERAND0_SHIFT)  |   /* ダミーサイクル */
+
+               (kFLEXSPI_Command_READ_SDR   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (0                           << FlexSPI_LUT_OPERAND1_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeAddressSequence                                                    */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[命令＋アドレス](拡張SPIモード)                                */
+/*              アドレス長はLUT命令パラメータに従う                                             */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : opcode                          命令コード                                      */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeAddressSequence(uint32_t *lut, uint32_t opcode)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (opcode                      << FlexSPI_LUT_OPERAND0_SHIFT)  |
+
+               (kFLEXSPI_Command_RADDR_SDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               ((uint32_t)l_ptLutParam->ucAddrBits << FlexSPI_LUT_OPERAND1_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeEnterOctalSequence                                                 */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Write Volatile Configuration Register](拡張SPIモード)         */
+/*              アドレス0(I/Oモード)に書き込む値はTX FIFOで与える                               */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeEnterOctalSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (FLASH_CMD_WR_VOL_CFG        << FlexSPI_LUT_OPERAND0_SHIFT)  |
+
+               (kFLEXSPI_Command_RADDR_SDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               ((3 * 8)                     << FlexSPI_LUT_OPERAND1_SHIFT));    /* アドレスは24bit(電源投入時の設定) */
 
-    lut[1] |= kFLEXSPI_Command_DUMMY_SDR    << FlexSPI_LUT_OPCODE0_SHIFT |
-              pad                           << FlexSPI_LUT_NUM_PADS0_SHIFT |
-              8                             << FlexSPI_LUT_OPERAND0_SHIFT | // ダミーサイクル8
-              kFLEXSPI_Command_READ_SDR     << FlexSPI_LUT_OPCODE1_SHIFT |
-              pad                           << FlexSPI_LUT_NUM_PADS1_SHIFT |
-              0                             << FlexSPI_LUT_OPERAND1_SHIFT;
+    lut[1] |= ((kFLEXSPI_Command_WRITE_SDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (1                           << FlexSPI_LUT_OPERAND0_SHIFT));    /* 1バイト書き込み */
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalIOReadSequence                                                */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte Octal Input/Output Fast Read](1-8-8)                   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalIOReadSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (FLASH_4BCMD_OCTAL_IO_READ   << FlexSPI_LUT_OPERAND0_SHIFT)  |
+
+               (kFLEXSPI_Command_RADDR_SDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               ((4 * 8)                     << FlexSPI_LUT_OPERAND1_SHIFT));    /* アドレスは32bit */
+
+    lut[1] |= ((kFLEXSPI_Command_DUMMY_SDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (FLEXSPI_LUT_OCTAL_DUMMY     << FlexSPI_LUT_OPERAND0_SHIFT)  |   /* ダミーサイクル */
+
+               (kFLEXSPI_Command_READ_SDR   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (0                           << FlexSPI_LUT_OPERAND1_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalIODDRReadSequence                                             */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte DTR Octal Input/Output Fast Read](1-8D-8D)             */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalIODDRReadSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (FLASH_4BCMD_OCTAL_DTR_READ  << FlexSPI_LUT_OPERAND0_SHIFT)  |
+
+               (kFLEXSPI_Command_RADDR_DDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               ((4 * 8)                     << FlexSPI_LUT_OPERAND1_SHIFT));    /* アドレスは32bit */
+
+    lut[1] |= ((kFLEXSPI_Command_DUMMY_DDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               ((FLEXSPI_LUT_OCTAL_DUMMY * 2U) << FlexSPI_LUT_OPERAND0_SHIFT) | /* ダミーサイクル(半サイクル単位) */
+
+               (kFLEXSPI_Command_READ_DDR   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (0                           << FlexSPI_LUT_OPERAND1_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalWriteSequence                                                 */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte Octal Input/Output Fast Program](1-8-8)                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalWriteSequence(uint32_t *lut)
+{
+    lut[0] |= ((kFLEXSPI_Command_SDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_1PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (FLASH_4BCMD_OCTAL_IO_PG     << FlexSPI_LUT_OPERAND0_SHIFT)  |
+
+               (kFLEXSPI_Command_RADDR_SDR  << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               ((4 * 8)                     << FlexSPI_LUT_OPERAND1_SHIFT));    /* アドレスは32bit */
+
+    lut[1] |= ((kFLEXSPI_Command_WRITE_SDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (0                           << FlexSPI_LUT_OPERAND0_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRCommand                                                    */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成 Octal DDRモードのコマンド部(8D)                               */
+/*              コマンドは立ち上がり・立ち下がりの両エッジに同じ値を送信する                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : opcode                          コマンド                                        */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRCommand(uint32_t *lut, uint32_t opcode)
+{
+    lut[0] |= ((kFLEXSPI_Command_DDR        << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (opcode                      << FlexSPI_LUT_OPERAND0_SHIFT)  |
+
+               (kFLEXSPI_Command_DDR        << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (opcode                      << FlexSPI_LUT_OPERAND1_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRAddress                                                    */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成 Octal DDRモードのコマンド・アドレス部(8D-8D)                  */
+/*              アドレスの後に続く命令を1つ指定する                                             */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : opcode                          コマンド                                        */
+/*            : opcode1                         アドレスに続くLUT命令(kFLEXSPI_Command_*)       */
+/*            : operand1                        LUT命令のオペランド                             */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRAddress(uint32_t *lut, uint32_t opcode, uint32_t opcode1, uint32_t operand1)
+{
+    _FlexSPI_MakeOctalDDRCommand(lut, opcode);
+
+    lut[1] |= ((kFLEXSPI_Command_RADDR_DDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               ((4 * 8)                     << FlexSPI_LUT_OPERAND0_SHIFT)  |   /* アドレスは32bit */
+
+               (opcode1                     << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (operand1                    << FlexSPI_LUT_OPERAND1_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRStatus                                                     */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成 Octal DDRモードのステータス読み出し(8D-8D)                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : opcode                          コマンド                                        */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRStatus(uint32_t *lut, uint32_t opcode)
+{
+    _FlexSPI_MakeOctalDDRCommand(lut, opcode);
+
+    lut[1] |= ((kFLEXSPI_Command_DUMMY_DDR  << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               ((FLEXSPI_LUT_OCTAL_STS_DUMMY * 2U) << FlexSPI_LUT_OPERAND0_SHIFT) | /* ダミーサイクル(半サイクル単位) */
+
+               (kFLEXSPI_Command_READ_DDR   << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (1                           << FlexSPI_LUT_OPERAND1_SHIFT));    /* 1バイト読み込み */
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRWriteEnableSequence                                        */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Write Enable](Octal DDRモード)                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRWriteEnableSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeOctalDDRCommand(lut, FLASH_CMD_WRITE_ENABLE);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRReadStatusSequence                                         */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Read Status Register](Octal DDRモード)                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRReadStatusSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeOctalDDRStatus(lut, FLASH_CMD_RD_STATUS);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRReadFlagStatusSequence                                     */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Read Flag Status Register](Octal DDRモード)                   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRReadFlagStatusSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeOctalDDRStatus(lut, FLASH_CMD_RD_FLAG_STAT);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRReadSequence                                               */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte DTR Octal Fast Read](Octal DDRモード)                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRReadSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeOctalDDRAddress(lut, FLASH_4BCMD_OCTAL_DTR_READ,
+                                 kFLEXSPI_Command_DUMMY_DDR, FLEXSPI_LUT_OCTAL_DUMMY * 2U);    /* ダミーサイクル(半サイクル単位) */
+
+    lut[2] |= ((kFLEXSPI_Command_READ_DDR   << FlexSPI_LUT_OPCODE0_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS0_SHIFT) |
+               (0                           << FlexSPI_LUT_OPERAND0_SHIFT)  |
+
+               (kFLEXSPI_Command_STOP       << FlexSPI_LUT_OPCODE1_SHIFT)   |
+               (kFLEXSPI_8PAD               << FlexSPI_LUT_NUM_PADS1_SHIFT) |
+               (0                           << FlexSPI_LUT_OPERAND1_SHIFT));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRWriteSequence                                              */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte Page Program](Octal DDRモード)                         */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRWriteSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeOctalDDRAddress(lut, FLASH_4BCMD_PAGE_PROGRAM, kFLEXSPI_Command_WRITE_DDR, 0);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRErase4KBSequence                                           */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte 4KB Subsector Erase](Octal DDRモード)                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRErase4KBSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeOctalDDRAddress(lut, FLASH_4BCMD_4K_ERASE, kFLEXSPI_Command_STOP, 0);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRErase32KBSequence                                          */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte 32KB Subsector Erase](Octal DDRモード)                 */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRErase32KBSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeOctalDDRAddress(lut, FLASH_4BCMD_32K_ERASE, kFLEXSPI_Command_STOP, 0);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRErase64KBSequence                                          */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[4-Byte Sector Erase(64KB)](Octal DDRモード)                   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRErase64KBSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeOctalDDRAddress(lut, FLASH_4BCMD_64K_ERASE, kFLEXSPI_Command_STOP, 0);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRChipEraseSequence                                          */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Bulk Erase](Octal DDRモード)                                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRChipEraseSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeOctalDDRCommand(lut, FLASH_CMD_CHIP_ERASE);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRSuspendSequence                                            */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Program/Erase Suspend](Octal DDRモード)                       */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRSuspendSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeOctalDDRCommand(lut, FLASH_CMD_SUSPEND);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRResumeSequence                                             */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Program/Erase Resume](Octal DDRモード)                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRResumeSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeOctalDDRCommand(lut, FLASH_CMD_RESUME);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_MakeOctalDDRExitSequence                                               */
+/*                                                                                              */
+/* DESCRIPTION: LUTシーケンス作成[Write Volatile Configuration Register](Octal DDRモード)       */
+/*              拡張SPIモードへ戻す値はTX FIFOで与える                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : lut                             LUTシーケンス(ゼロクリア済みであること)         */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_MakeOctalDDRExitSequence(uint32_t *lut)
+{
+    _FlexSPI_MakeOctalDDRAddress(lut, FLASH_CMD_WR_VOL_CFG, kFLEXSPI_Command_WRITE_DDR, 0);
+}
+
+#if 0
+/*******************************************************************
+ * @fn FlexSPI_SetWriteDisableSequence
+ * @brief LUT登録  WRITE DISABLE
+ * @param FlexSPI_Type 対象のFlexSPIレジスタ
+ * @note 
+ *
+ ******************************************************************/
+void FlexSPI_SetWriteDisableSequence(FlexSPI_Type *base)
+{
+    uint32_t lut[FLEXSPI_LUT_COMMANDSEQ_SIZE] = {0};
 
-    lut[2] |= kFLEXSPI_Command_STOP         << FlexSPI_LUT_OPCODE0_SHIFT |
-              pad                           << FlexSPI_LUT_NUM_PADS0_SHIFT |
-              0                             << FlexSPI_LUT_OPERAND0_SHIFT;
+    lut[0] |= kFLEXSPI_Command_SDR      << FlexSPI_LUT_OPCODE0_SHIFT |
+              kFLEXSPI_1PAD             << FlexSPI_LUT_NUM_PADS0_SHIFT |
+              FLASH_CMD_WRITE_DISABLE   << FlexSPI_LUT_OPERAND0_SHIFT |
+              kFLEXSPI_Command_STOP     << FlexSPI_LUT_OPCODE1_SHIFT |
+              kFLEXSPI_1PAD             << FlexSPI_LUT_NUM_PADS1_SHIFT |
+              0                         << FlexSPI_LUT_OPERAND1_SHIFT;
 
     _FlexSPI_SetLUT(base, lut, FLEXSPI_LUT_COMMANDSEQ_SIZE);
 }
@@ -0,0 +1,219 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_flexspi_xfer.c                                                      0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      FlexSPIドライバ 転送共通処理ソースファイル                                              */
+/*      (RX FIFOの待ち条件判定・DMA/CPU分割・RFDRからの複写、AHB RXバッファ構成のチェックなど、 */
+/*       OS・割り込みに依存しない処理。ドライバとホストモデル(dri_flexspi_sim.c)で共通に使用)   */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "imx8mplus_uC3.h"
+#include "code_rules_def.h"
+#include "dri_flexspi.h"
+#include "dri_flexspi_local.h"
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_IsRxBlockReady                                                          */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFOデータ到着判定                                                           */
+/*              ウォーターマーク分のブロックはINTR.IPRXWAで判定する。                           */
+/*              ウォーターマーク未満の端数ではIPRXWAが立たないため、                            */
+/*              IPRXFSTS.FILL(8バイト単位)で判定する                                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulIntr                          INTRレジスタ値                                  */
+/*            : ulFifoSts                       IPRXFSTSレジスタ値                              */
+/*            : ulBlock                         読み出すブロック長(ウォーターマーク以下)        */
+/*            : ulWatermark                     RX FIFOウォーターマーク(バイト)                 */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 0以外                             到着済み                                      */
+/*              0                               未到着                                          */
+/*                                                                                              */
+/************************************************************************************************/
+uint32_t FlexSPI_IsRxBlockReady(uint32_t ulIntr, uint32_t ulFifoSts, uint32_t ulBlock, uint32_t ulWatermark)
+{
+uint32_t ulFill = 0;
+
+    /* ウォーターマーク分 */
+    if (ulWatermark <= ulBlock) {
+        return ((ulIntr & FlexSPI_INTR_IPRXWA_MASK) != 0U) ? 1U : 0U;
+    }
+    else {
+        ulFill = ((ulFifoSts & FlexSPI_IPRXFSTS_FILL_MASK) >> FlexSPI_IPRXFSTS_FILL_SHIFT) * 8U;
+    }
+
+    /* 端数 */
+    return (ulBlock <= ulFill) ? 1U : 0U;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_GetRxDmaSize                                                            */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFO読み出しのDMA転送長取得                                                  */
+/*              DMA転送はキャッシュライン境界のバッファに限り、                                 */
+/*              キャッシュライン・ウォーターマークの大きい方の倍数とする                        */
+/*              (残りの端数はCPUで読み出す)                                                     */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : buf                             データ格納バッファ                              */
+/*            : size                            読み出し長                                      */
+/*            : ulMode                          RX FIFO転送モード(FLEXSPI_XFER_MODE_*)          */
+/*            : ulWatermark                     RX FIFOウォーターマーク(バイト)                 */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : DMA転送長                          0はDMA転送なし                               */
+/*                                                                                              */
+/************************************************************************************************/
+uint32_t FlexSPI_GetRxDmaSize(const unsigned char *buf, uint32_t size, uint32_t ulMode, uint32_t ulWatermark)
+{
+uint32_t ulAlign = (FLEXSPI_DCACHE_LINE_SIZE < ulWatermark) ? ulWatermark : FLEXSPI_DCACHE_LINE_SIZE;
+
+    if ((ulMode != FLEXSPI_XFER_MODE_DMA) ||
+        (((uint32_t)buf % FLEXSPI_DCACHE_LINE_SIZE) != 0U)) {
+        return 0U;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return size - (size % ulAlign);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_CopyRxBlock                                                             */
+/*                                                                                              */
+/* DESCRIPTION: RFDRより1ブロック取得                                                           */
+/*              格納先の境界に応じて64bit/32bit単位で書き込み、                                 */
+/*              バイト単位の処理は末尾の端数のみとする                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : size                            読み出し長(ウォーターマーク以下)                */
+/*                                                                                              */
+/* OUTPUT     : buf                             データ格納バッファ                              */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+void FlexSPI_CopyRxBlock(FlexSPI_Type *base, unsigned char *buf, uint32_t size)
+{
+uint32_t ulWordNum  = size / 4U;
+uint32_t ulIndex    = 0;
+uint32_t ulReadData = 0;
+uint64_t *pullDst   = NULL;
+uint32_t *pulDst    = NULL;
+
+    if (((uint32_t)buf % 8U) == 0U) {
+        /* 8バイト境界：2ワードずつ64bitで格納 */
+        pullDst = (uint64_t *)buf;
+        for (; (ulIndex + 1U) < ulWordNum; ulIndex += 2U) {
+            *pullDst++ = (uint64_t)base->RFDR[ulIndex] |
+                         ((uint64_t)base->RFDR[ulIndex + 1U] << 32);
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (((uint32_t)buf % 4U) == 0U) {
+        /* 4バイト境界：32bitで格納 */
+        pulDst = (uint32_t *)(buf + (ulIndex * 4U));
+        for (; ulIndex < ulWordNum; ulIndex++) {
+            *pulDst++ = base->RFDR[ulIndex];
+        }
+    }
+    else {
+        /* 境界外：ワード単位で読み出してコピー */
+        for (; ulIndex < ulWordNum; ulIndex++) {
+            ulReadData = base->RFDR[ulIndex];
+            memcpy(&buf[ulIndex * 4U], &ulReadData, 4U);
+        }
+    }
+
+    /* 末尾の端数(4バイト未満) */
+    if ((size % 4U) != 0U) {
+        ulReadData = base->RFDR[ulWordNum];
+        for (ulIndex = ulWordNum * 4U; ulIndex < size; ulIndex++) {
+            buf[ulIndex] = ulReadData & 0xFF;
+            ulReadData >>= 8;
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_CheckAHBBufferConfig                                                    */
+/*                                                                                              */
+/* DESCRIPTION: AHB RXバッファ構成チェック                                                      */
+/*              サイズは8バイト単位、合計はFLEXSPI_AHB_BUFFER_SIZE以下、                        */
+/*              マスターID・優先度は範囲内とする                                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : config                          AHB RXバッファ構成[FLEXSPI_AHB_BUFFER_NUM]      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常                                            */
+/*              FLEXSPI_E_PARAM                 構成に誤りがある                                */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_CheckAHBBufferConfig(const FlexSPI_AhbBufConfig *config)
+{
+uint32_t ulTotal = 0;
+uint32_t i       = 0;
+
+    /* 構成未設定 */
+    if (config == NULL) {
+        return FLEXSPI_E_PARAM;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    for (i = 0; i < FLEXSPI_AHB_BUFFER_NUM; i++) {
+        if (((config[i].ulSize     % 8U) != 0U)                 ||  /* 8バイト単位でない */
+            (config[i].ulMasterId  >  FLEXSPI_AHB_MASTER_ID_MAX) || /* マスターID範囲外 */
+            (config[i].ulPriority  >  FLEXSPI_AHB_PRIORITY_MAX)  || /* 優先度範囲外 */
+            (config[i].ulPrefetch  >  1U)) {
+            return FLEXSPI_E_PARAM;
+        }
+        else {
+            ulTotal += config[i].ulSize;
+        }
+    }
+
+    /* 合計サイズがAHB RXバッファ容量を超える */
+    if (ulTotal > FLEXSPI_AHB_BUFFER_SIZE) {
+        return FLEXSPI_E_PARAM;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return FLEXSPI_E_SUCCESS;
+}
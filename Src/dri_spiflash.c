@@ -23,6 +23,8 @@
 
 //#include <log.h>
 
+#include <string.h>
+
 #include "itron.h"
 #include "kernel.h"
 #include "ARMv7M.h"
@@ -30,7 +32,9 @@
 #include "code_rules_def.h"
 #include "dri_flexspi.h"
 #include "dri_flexspi_lut.h"
+#include "dri_flexspi_local.h"
 #include "dri_spiflash.h"
+#include "dri_spiflash_local.h"
 
 /****************************************************************************/
 /*  定数・マクロ定義                                                        */
@@ -40,17 +44,128 @@
 
 /* イベントフラグビット */
 #define FROM_EVFBIT_WAIT    (0x00000001U)       /* 汎用時間待ち */
+#define FROM_EVFBIT_POLL    (0x00000002U)       /* ステータスポーリング終了 */
+#define FROM_EVFBIT_SUSREQ  (0x00000004U)       /* 読み書き要求(消去完了待ちを起こす) */
+
+/* 完了待ち */
+#define FROM_TICK_US        (1000U)             /* システム時刻1ティックの時間(マイクロ秒) */
+#define FROM_POLL_BURST     (32U)               /* 割り込み内で連続実行するステータス読み出し回数 */
+#define FROM_POLL_TMO       (10)                /* ステータスポーリング1回分の終了待ち(ティック) */
+#define FROM_SUS_RETRY      (2U)                /* 消去中断完了のステータスポーリング回数(1回毎に1ティック待つ) */
+#define FROM_SUS_INTERVAL_US (1000U)            /* 消去再開から次の中断までの最小間隔(マイクロ秒、消去を進める時間) */
+
+/* デバイス排他の種別 */
+#define FROM_LOCK_EXCL      (0U)                /* 消去・設定変更(消去中断中は消去再開まで待つ) */
+#define FROM_LOCK_IO        (1U)                /* 読み出し・書き込み(消去中は消去を中断させて実行する) */
+
+/* ステータスポーリング結果 */
+#define FROM_POLL_BUSY      (0U)                /* 実行中(規定回数読み出した) */
+#define FROM_POLL_READY     (1U)                /* 完了 */
+#define FROM_POLL_ERROR     (2U)                /* 読み出しエラー */
+
+/* 消去種別(消去単位の大きい順) */
+#define FROM_ERASE_CHIP     (0U)                /* チップ消去 */
+#define FROM_ERASE_64KB     (1U)                /* ブロック消去 */
+#define FROM_ERASE_32KB     (2U)                /* 32KBブロック消去 */
+#define FROM_ERASE_4KB      (3U)                /* セクタ消去 */
+#define FROM_ERASE_NUM      (4U)
 
 /****************************************************************************/
 /*  構造体定義                                                              */
 /****************************************************************************/
 
+/* クロックプロファイル */
+typedef struct FROM_ClkProfile_tag {
+    uint32_t        ulRootClk;      /* FlexSPIルートクロック(Hz) */
+    uint32_t        ulRxClkSrc;     /* RXサンプルクロックソース(FLEXSPI_RXCLKSRC_*) */
+    uint8_t         ucDataValidTime;/* データ有効時間(ns、DLL遅延固定時に使用) */
+    uint32_t        ulReadSeq;      /* IP読み出しシーケンス(Quadモード中、FLEXSPI_SEQ_*) */
+    uint32_t        ulSpiReadSeq;   /* IP読み出しシーケンス(拡張SPIモード中、FLEXSPI_SEQ_*) */
+    uint32_t        ulAhbReadSeq;   /* AHB読み出しシーケンス(FLEXSPI_SEQ_*) */
+} FROM_ClkProfile;
+
+/* 完了待ち時間(データシート値、マイクロ秒) */
+typedef struct FROM_WaitProfile_tag {
+    uint32_t        ulTypUs;        /* 標準(予測完了時間の初期値) */
+    uint32_t        ulMaxUs;        /* 最大(この2倍でタイムアウト) */
+} FROM_WaitProfile;
+
+/* 消去種別情報 */
+typedef struct FROM_EraseType_tag {
+    uint32_t        ulSeqId;        /* 消去シーケンス(FLEXSPI_SEQ_*) */
+    uint32_t        ulOp;           /* 完了待ち種別(FROM_WAIT_OP_*) */
+} FROM_EraseType;
+
+/* デバイス構成(1デバイスあたり、オープン時にSFDPから取得する) */
+typedef struct FROM_PartInfo_tag {
+    uint32_t        ulSize;         /* 容量(AHB窓の大きさまで) */
+    uint32_t        ulSectSize;     /* セクタ消去単位 */
+    uint32_t        ulBlkSize;      /* ブロック消去単位 */
+    uint32_t        ulPageSize;     /* ページプログラム単位 */
+    uint32_t        ulEraseSize[FROM_ERASE_NUM];    /* 消去単位(FROM_ERASE_*順、0は使用不可) */
+    uint32_t        ulQpi;          /* Quadモード(4-4-4)対応(1) */
+    uint32_t        ulSuspend;      /* 消去中断対応(1) */
+    uint32_t        ulReadySeq;     /* 完了判定のステータス読み出しシーケンス(FLEXSPI_SEQ_*) */
+    unsigned char   ucReadyMask;    /* 完了判定ビット */
+    unsigned char   ucReadyExpect;  /* 完了時の判定ビット値 */
+    uint32_t        ulSfdp;         /* SFDPから取得済み(1) */
+} FROM_PartInfo;
+
+/* ステータスポーリング情報(割り込み内でステータス読み出しを連続実行する) */
+typedef struct FROM_PollInfo_tag {
+    FlexSPI_CmdDesc tDesc;          /* ステータス読み出しコマンド */
+    unsigned char   ucStatus[FLEXSPI_PARALLEL_WIDTH];   /* ステータス(パラレルモード時はデバイス毎) */
+    unsigned char   ucMask;         /* 判定ビット */
+    unsigned char   ucExpect;       /* 完了時の判定ビット値 */
+    uint32_t        ulCount;        /* 読み出し回数 */
+    volatile uint32_t ulResult;     /* 結果(FROM_POLL_*) */
+} FROM_PollInfo;
+
+/* デバイス情報 */
+typedef struct FROM_DevInfo_tag {
+    int             iChipSelect;    /* FlexSPIチップセレクト(FLEXSPI_CS_*) */
+    uint32_t        ulState;        /* 動作状態 */
+    ID              tSemID;         /* セマフォID(デバイス毎の排他) */
+    ID              tFlgID;         /* イベントフラグID */
+    uint32_t        ulSize;         /* アクセス可能サイズ(DLL校正予約領域を除く) */
+    uint32_t        ulSectSize;     /* セクタ消去単位 */
+    uint32_t        ulBlkSize;      /* ブロック消去単位 */
+    uint32_t        ulPageSize;     /* ページプログラム単位 */
+    uint32_t        ulWidth;        /* 同時アクセスするデバイス数(パラレルモード時は2) */
+    uint32_t        ulIoMode;       /* デバイスのI/Oモード(FROM_IO_MODE_*) */
+    volatile uint32_t ulPgmErs;     /* 書き込み・消去実行中(1、AHB窓の内容が不定) */
+    volatile uint32_t ulGen[FROM_GEN_REGION_NUM];   /* 領域毎の最終更新世代 */
+    FROM_PollInfo   tPoll;          /* ステータスポーリング情報 */
+    volatile uint32_t ulIoReq;      /* 排他待ちの読み書き要求数 */
+    volatile uint32_t ulIoAddr;     /* 排他待ちの読み書き範囲(先頭、全要求の和) */
+    volatile uint32_t ulIoEnd;      /* 排他待ちの読み書き範囲(終端、全要求の和) */
+    volatile uint32_t ulSusAddr;    /* 中断可能な消去の範囲(先頭) */
+    volatile uint32_t ulSusLen;     /* 中断可能な消去の範囲(長さ、0は中断不可) */
+    volatile uint32_t ulSuspended;  /* 消去中断中(1) */
+    volatile uint32_t ulResumed;    /* 消去再開済み(1、消去コマンド毎に0に戻す) */
+    volatile uint32_t ulResumeUs;   /* 消去再開時刻(マイクロ秒) */
+} FROM_DevInfo;
+
 /* NORドライバ情報 */
 typedef struct FROM_DrvInfo_tag {
     FlexSPI_Type    *tpFlexSPIReg;  /* FlexSPIコントローラのレジスタベースアドレス */
-    uint32_t        ulState;        /* 動作状態 */
-    ID              tSemID;         /* セマフォID */
-    ID              tFlgID;         /* イベントフラグID */
+    FROM_DevInfo    tDev[FROM_DEV_NUM];     /* デバイス情報 */
+    uint32_t        ulInit;         /* 初期化済み(1) */
+    uint32_t        ulOpenMask;     /* オープン済みデバイス(bit n = FROM_DEV_n) */
+    ID              tCtrlSemID;     /* セマフォID(オープン・クローズ・クロック変更の排他) */
+    ID              tBusSemID;      /* セマフォID(IPコマンド・FIFO操作の排他) */
+    uint32_t        ulClkProfile;   /* クロックプロファイル(FROM_CLK_PROFILE_*) */
+    uint32_t        ulReadSeq;      /* 適用中のIP読み出しシーケンス(Quadモード中、FLEXSPI_SEQ_*) */
+    uint32_t        ulSpiReadSeq;   /* 適用中のIP読み出しシーケンス(拡張SPIモード中、FLEXSPI_SEQ_*) */
+    uint32_t        ulIoPolicy;     /* I/Oモードポリシー(FROM_IO_MODE_*) */
+    FROM_CalRecord  tCalRecord;     /* DLL校正結果(オープン時に読み込み) */
+    uint32_t        ulParallel;     /* パラレルモード(FROM_PARALLEL_*) */
+    uint32_t        ulReadMode;     /* 読み出し方式(FROM_READ_MODE_*) */
+    volatile uint32_t ulGenSeq;     /* 世代(書き込み・消去・構成変更毎に更新) */
+    FROM_GetTimeFunc pfnGetTime;    /* 時刻取得関数(マイクロ秒) */
+    FROM_WaitStats  tWaitStats[FROM_WAIT_OP_NUM];   /* 完了待ち統計 */
+    FROM_PartInfo   tPart;          /* デバイス構成 */
+    FROM_SfdpInfo   tSfdp;          /* SFDP解析結果(tPart.ulSfdp=1の場合のみ有効) */
 } FROM_DrvInfo;
 
 /****************************************************************************/
@@ -60,21 +175,138 @@ typedef struct FROM_DrvInfo_tag {
 /* NORドライバ情報 */
 DLOCAL FROM_DrvInfo l_tDrvInfo = { 0 };
 
+/* クロックプロファイル(FROM_CLK_PROFILE_*順、ダミーサイクルはデバイス既定値(SDR:10、DTR:8)で全周波数に対応) */
+/* DTRではSCLKがルートクロックの1/2となるため、ルートクロックはSCLKの2倍を設定する */
+DLOCAL const FROM_ClkProfile l_tClkProfile[FROM_CLK_PROFILE_NUM] = {
+    {  40000000U, FLEXSPI_RXCLKSRC_LOOPBACK_INTERNAL, 0U, FLEXSPI_SEQ_QUAD_IO_READ,     FLEXSPI_SEQ_SPI_IO_READ,     FLEXSPI_SEQ_AHB_READ },      /* FROM_CLK_PROFILE_40MHZ */
+    {  80000000U, FLEXSPI_RXCLKSRC_LOOPBACK_DQS,      2U, FLEXSPI_SEQ_QUAD_IO_READ,     FLEXSPI_SEQ_SPI_IO_READ,     FLEXSPI_SEQ_AHB_READ },      /* FROM_CLK_PROFILE_80MHZ */
+    { 133000000U, FLEXSPI_RXCLKSRC_LOOPBACK_DQS,      0U, FLEXSPI_SEQ_QUAD_IO_READ,     FLEXSPI_SEQ_SPI_IO_READ,     FLEXSPI_SEQ_AHB_READ },      /* FROM_CLK_PROFILE_133MHZ */
+    { 166000000U, FLEXSPI_RXCLKSRC_LOOPBACK_DQS,      0U, FLEXSPI_SEQ_QUAD_IO_READ,     FLEXSPI_SEQ_SPI_IO_READ,     FLEXSPI_SEQ_AHB_READ },      /* FROM_CLK_PROFILE_166MHZ */
+    { 100000000U, FLEXSPI_RXCLKSRC_LOOPBACK_DQS,      0U, FLEXSPI_SEQ_QUAD_IO_READ_DDR, FLEXSPI_SEQ_SPI_IO_READ_DDR, FLEXSPI_SEQ_AHB_READ_DDR },  /* FROM_CLK_PROFILE_50MHZ_DDR */
+    { 160000000U, FLEXSPI_RXCLKSRC_LOOPBACK_DQS,      0U, FLEXSPI_SEQ_QUAD_IO_READ_DDR, FLEXSPI_SEQ_SPI_IO_READ_DDR, FLEXSPI_SEQ_AHB_READ_DDR },  /* FROM_CLK_PROFILE_80MHZ_DDR */
+};
+
+/* デバイス毎のチップセレクト(FROM_DEV_*順) */
+DLOCAL const int l_iDevChipSelect[FROM_DEV_NUM] = {
+    FLEXSPI_CS_A1,      /* FROM_DEV_0 */
+    FLEXSPI_CS_B1,      /* FROM_DEV_1 */
+};
+
+/* DLL校正で掃引するRXサンプルクロックソース(デバイスがDQSを出力しないため外部DQSは除く) */
+DLOCAL const uint32_t l_ulCalRxClkSrc[] = {
+    FLEXSPI_RXCLKSRC_LOOPBACK_INTERNAL,
+    FLEXSPI_RXCLKSRC_LOOPBACK_DQS,
+    FLEXSPI_RXCLKSRC_LOOPBACK_SCK,
+};
+
+/* デバイス種別毎のFlexSPIデバイス種別(FROM_DEVICE_*順) */
+DLOCAL const uint32_t l_ulDeviceType[] = {
+    FLEXSPI_DEVICE_QUAD,        /* FROM_DEVICE_QUAD */
+    FLEXSPI_DEVICE_OCTAL_SDR,   /* FROM_DEVICE_OCTAL_SDR */
+    FLEXSPI_DEVICE_OCTAL_DDR,   /* FROM_DEVICE_OCTAL_DDR */
+};
+
+/* 完了待ち時間(FROM_WAIT_OP_*順) */
+DLOCAL const FROM_WaitProfile l_tWaitProfile[FROM_WAIT_OP_NUM] = {
+    {    120U,    1800U },      /* FROM_WAIT_OP_PROGRAM */
+    {  50000U,  400000U },      /* FROM_WAIT_OP_ERASE_4KB */
+    { 150000U, 1000000U },      /* FROM_WAIT_OP_ERASE_64KB */
+    { 100000U, 1000000U },      /* FROM_WAIT_OP_ERASE_32KB */
+    { 80000000U, 240000000U },  /* FROM_WAIT_OP_ERASE_CHIP */
+};
+
+/* 消去種別(FROM_ERASE_*順) */
+DLOCAL const FROM_EraseType l_tEraseType[FROM_ERASE_NUM] = {
+    { FLEXSPI_SEQ_ERASE_CHIP, FROM_WAIT_OP_ERASE_CHIP },    /* FROM_ERASE_CHIP */
+    { FLEXSPI_SEQ_ERASE_64KB, FROM_WAIT_OP_ERASE_64KB },    /* FROM_ERASE_64KB */
+    { FLEXSPI_SEQ_ERASE_32KB, FROM_WAIT_OP_ERASE_32KB },    /* FROM_ERASE_32KB */
+    { FLEXSPI_SEQ_ERASE_4KB,  FROM_WAIT_OP_ERASE_4KB },     /* FROM_ERASE_4KB */
+};
+
+/* デバイス構成の既定値(SFDPが読めない場合に使用、完了判定はフラグステータスのb7) */
+DLOCAL const FROM_PartInfo l_tPartDefault = {
+    (uint32_t)FROM_SIZE, (uint32_t)FROM_SECT_SIZE, (uint32_t)FROM_BLK_SIZE, FROM_PAGE_SIZE,
+    { (uint32_t)FROM_SIZE, (uint32_t)FROM_BLK_SIZE, FROM_BLK32_SIZE, (uint32_t)FROM_SECT_SIZE },
+    1U, 1U, FLEXSPI_SEQ_READ_FLAG_STATUS, 0x80U, 0x80U, 0U
+};
+
+/* DLL校正パターン・読み出しバッファ */
+DLOCAL unsigned char l_ucCalPattern[FROM_CAL_PATTERN_SIZE];
+DLOCAL unsigned char l_ucCalBuf[FROM_CAL_PATTERN_SIZE];
+
 /****************************************************************************/
 /*  ローカル関数宣言                                                        */
 /****************************************************************************/
 
 /* 書き込み処理 */
-LOCAL int _FROM_WriteCore(unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData);
+LOCAL int _FROM_WriteCore(FROM_DevInfo *ptDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData);
+LOCAL int _FROM_WritePage(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData);
 
 /* 読み出し処理 */
-LOCAL int _FROM_ReadCore(unsigned int uiAddress, unsigned int uiLength, unsigned char *strReadData);
+LOCAL int _FROM_ReadCore(FROM_DevInfo *ptDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strReadData);
+
+/* 範囲消去処理(消去単位の組み合わせを選択) */
+LOCAL int _FROM_EraseRange(FROM_DevInfo *ptDev, unsigned int uiAddress, unsigned int uiLength);
+
+/* 消去処理 */
+LOCAL int _FROM_EraseCore(FROM_DevInfo *ptDev, uint32_t ulType, unsigned int uiAddress);
+
+/* 消去・書き込み完了待ち */
+LOCAL int _FROM_WaitReady(FROM_DevInfo *ptDev, uint32_t ulOp, uint32_t ulSeqId, unsigned char ucMask, unsigned char ucExpect);
+LOCAL uint32_t _FROM_PollStatus(FROM_DevInfo *ptDev, uint32_t ulSeqId, unsigned char ucMask, unsigned char ucExpect, uint32_t *pulPolls);
+LOCAL void _FROM_PollDone(FlexSPI_CmdDesc *ptDesc);
+LOCAL uint32_t _FROM_GetTimeUs(void);
+
+/* 消去中断・再開(完了待ち中に読み書き要求を先に実行する) */
+LOCAL int _FROM_SuspendForIo(FROM_DevInfo *ptDev, uint32_t ulOp, uint32_t *pulSusUs);
+LOCAL int _FROM_IsIoPending(FROM_DevInfo *ptDev);
+LOCAL uint32_t _FROM_GetSusHoldUs(FROM_DevInfo *ptDev);
+LOCAL void _FROM_Sleep(FROM_DevInfo *ptDev, TMO tSleep);
+
+/* 書き込み・消去の開始・終了(AHB窓の無効化) */
+LOCAL void _FROM_BeginPgmErs(FROM_DevInfo *ptDev, unsigned int uiAddress, unsigned int uiLength);
+LOCAL void _FROM_EndPgmErs(FROM_DevInfo *ptDev, unsigned int uiAddress, unsigned int uiLength, int iResult);
+
+/* I/Oモード切り替え */
+LOCAL int _FROM_SetIoMode(FROM_DevInfo *ptDev, uint32_t ulMode);
+
+/* AHB窓からの読み出し可否 */
+LOCAL int _FROM_IsMapped(uint32_t ulDev);
+
+/* 読み出しビューの世代更新 */
+LOCAL void _FROM_TouchGen(FROM_DevInfo *ptDev, uint32_t ulAddress, uint32_t ulLength);
+LOCAL void _FROM_TouchGenAll(void);
+
+/* Octal DDRモード移行・解除 */
+LOCAL int _FROM_EnterOctal(FROM_DevInfo *ptDev);
+LOCAL int _FROM_ExitOctal(FROM_DevInfo *ptDev);
+
+/* SFDPによるデバイス構成取得 */
+LOCAL int _FROM_DiscoverPart(FROM_DevInfo *ptDev);
+LOCAL int _FROM_ApplyPart(const FROM_SfdpInfo *ptInfo);
+LOCAL uint8_t _FROM_LinesToPads(uint8_t ucLines);
+
+/* デバイスの排他(消去中断中の読み出しを考慮する) */
+LOCAL void _FROM_LockDev(FROM_DevInfo *ptDev, uint32_t ulMode, uint32_t ulAddress, uint32_t ulLength);
 
-/* セクタ消去処理 */
-LOCAL int _FROM_SectorEraseCore(unsigned int uiAddress, unsigned int uiLength);
+/* 全デバイスの排他(クロック変更用) */
+LOCAL void _FROM_LockAllDev(void);
+LOCAL void _FROM_UnlockAllDev(void);
+LOCAL void _FROM_SetGeometry(FROM_DevInfo *ptDev, uint32_t ulWidth);
 
-/* ブロック消去処理 */
-LOCAL int _FROM_BlockEraseCore(unsigned int uiAddress, unsigned int uiLength);
+/* デバイスコンフィギュレーション情報作成 */
+LOCAL void _FROM_MakeConfig(flexspi_device_config_t *ptConfig, uint32_t ulProfile);
+
+/* クロックプロファイル適用 */
+LOCAL int _FROM_ApplyClockProfile(uint32_t ulProfile);
+LOCAL uint32_t _FROM_GetRxClkSrc(uint32_t ulProfile);
+
+/* DLL校正 */
+LOCAL void _FROM_LoadCalibration(void);
+LOCAL int _FROM_SaveCalibration(void);
+LOCAL int _FROM_PrepareCalPattern(void);
+LOCAL int _FROM_SweepSampleDelay(uint32_t ulRxClkSrc, uint32_t *pulCentre, uint32_t *pulWidth);
+LOCAL int _FROM_ReadCalPattern(void);
 
 /****************************************************************************/
 /*  提供関数                                                                */
@@ -94,47 +326,291 @@ LOCAL int _FROM_BlockEraseCore(unsigned int uiAddress, unsigned int uiLength);
 /************************************************************************************************/
 void FROM_Init(void)
 {
-T_CSEM tCSem = { 0 };
-T_CFLG tCFLG = { 0 };
+T_CSEM tCSem         = { 0 };
+T_CFLG tCFLG         = { 0 };
+FROM_DevInfo *ptDev  = NULL;
+uint32_t i           = 0;
 
-    if (l_tDrvInfo.ulState == FROM_NONE_STATE){
+    if (l_tDrvInfo.ulInit == 0U){
         /* ドライバデータ初期化 */
         l_tDrvInfo.tpFlexSPIReg = (FlexSPI_Type*)FLEXSPI_BASE;  /* FlexSPIコントローラレジスタベースアドレス */
+        l_tDrvInfo.ulReadMode   = FROM_READ_MODE_AHB;           /* 読み出し方式 */
+        l_tDrvInfo.tPart        = l_tPartDefault;               /* デバイス構成(オープン時にSFDPで更新) */
 
         /* セマフォ作成 */
         tCSem.sematr  = (TA_HLNG | TA_TFIFO);
         tCSem.isemcnt = 1;
         tCSem.maxsem  = 1;
-        tCSem.name    = "FROM Semaphore";
-        l_tDrvInfo.tSemID = acre_sem(&tCSem);
-        if (E_OK <= l_tDrvInfo.tSemID) {
+        tCSem.name    = "FROM Ctrl Semaphore";
+        l_tDrvInfo.tCtrlSemID = acre_sem(&tCSem);
+        if (E_OK <= l_tDrvInfo.tCtrlSemID) {
             ;   /* do nothing */
         }
         else {
             for ( ;; ) {}
         }
 
-        /* イベントフラグ作成 */
-        tCFLG.flgatr  = (TA_TFIFO | TA_WMUL);
-        tCFLG.iflgptn = 0;
-        tCFLG.name    = "FROM Eventflag";
-        l_tDrvInfo.tFlgID = acre_flg(&tCFLG);
-        if (E_OK <= l_tDrvInfo.tFlgID) {
-            l_tDrvInfo.ulState = FROM_INIT_STATE;   /* 動作状態更新 */
+        tCSem.name    = "FROM Bus Semaphore";
+        l_tDrvInfo.tBusSemID = acre_sem(&tCSem);
+        if (E_OK <= l_tDrvInfo.tBusSemID) {
+            ;   /* do nothing */
         }
         else {
             for ( ;; ) {}
         }
+
+        for (i = 0; i < FROM_DEV_NUM; i++) {
+            ptDev = &l_tDrvInfo.tDev[i];
+            ptDev->iChipSelect = l_iDevChipSelect[i];
+            _FROM_SetGeometry(ptDev, 1U);
+
+            /* セマフォ作成 */
+            tCSem.name    = "FROM Semaphore";
+            ptDev->tSemID = acre_sem(&tCSem);
+            if (E_OK <= ptDev->tSemID) {
+                ;   /* do nothing */
+            }
+            else {
+                for ( ;; ) {}
+            }
+
+            /* イベントフラグ作成 */
+            tCFLG.flgatr  = (TA_TFIFO | TA_WMUL);
+            tCFLG.iflgptn = 0;
+            tCFLG.name    = "FROM Eventflag";
+            ptDev->tFlgID = acre_flg(&tCFLG);
+            if (E_OK <= ptDev->tFlgID) {
+                ptDev->ulState = FROM_INIT_STATE;   /* 動作状態更新 */
+            }
+            else {
+                for ( ;; ) {}
+            }
+        }
+
+        l_tDrvInfo.ulInit = 1U;
+    }
+    else {
+        ;   /* do nothing */
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_DiscoverPart                                                              */
+/*                                                                                              */
+/* DESCRIPTION: SFDPによるデバイス構成取得                                                      */
+/*              SFDP(1-1-1、拡張SPIモード)を読み出して解析し、LUT・デバイス構成に反映する       */
+/*              オープン直後(リセット後の拡張SPIモード、パラレルモード解除中)に呼び出すこと     */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_SFDP_ERROR                 SFDPなし、または対応できない構成(既定値のまま)  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_DiscoverPart(FROM_DevInfo *ptDev)
+{
+unsigned char ucHdr[FROM_SFDP_HDR_SIZE + (FROM_SFDP_PHDR_MAX * FROM_SFDP_PHDR_SIZE)] = { 0 };
+unsigned char ucBfpt[FROM_SFDP_BFPT_DW_MAX * 4U]                                     = { 0 };
+unsigned char uc4bait[FROM_SFDP_4BAIT_DW_NUM * 4U]                                   = { 0 };
+FROM_SfdpTable tBfpt  = { 0 };
+FROM_SfdpTable t4bait = { 0 };
+FROM_SfdpInfo tInfo   = { 0 };
+uint32_t ulBase       = FlexSPI_GetDeviceBase(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect);
+uint32_t ulBfptDw     = 0;
+int iRet              = FROM_SFDP_ERROR;
+int iRet2             = FLEXSPI_E_ERROR;
+
+    /* バス取得 */
+    wai_sem(l_tDrvInfo.tBusSemID);
+
+    /* 1.SFDPヘッダ・パラメータヘッダ */
+    iRet2 = FlexSPI_ReadStream(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_READ_SFDP, ulBase, ucHdr, sizeof(ucHdr));
+    if (iRet2 != FLEXSPI_E_SUCCESS) {
+        iRet = FROM_SFDP_ERROR;
+        goto err_end;
+    }
+    else {
+        iRet = FROM_SfdpParseHeader(ucHdr, sizeof(ucHdr), &tBfpt, &t4bait);
+    }
+    if (iRet != FROM_SUCCESS) {
+        goto err_end;
+    }
+    else {
+        ulBfptDw = (tBfpt.ulDwNum < FROM_SFDP_BFPT_DW_MAX) ? tBfpt.ulDwNum : FROM_SFDP_BFPT_DW_MAX;
+    }
+
+    /* 2.Basic Flash Parameter Table */
+    iRet2 = FlexSPI_ReadStream(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_READ_SFDP, ulBase + tBfpt.ulAddr, ucBfpt, ulBfptDw * 4U);
+
+    /* 3.4-Byte Address Instruction Table(あれば) */
+    if ((iRet2 == FLEXSPI_E_SUCCESS) && (t4bait.ulDwNum != 0U)) {
+        iRet2 = FlexSPI_ReadStream(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_READ_SFDP, ulBase + t4bait.ulAddr,
+                                   uc4bait, t4bait.ulDwNum * 4U);
+    }
+    else {
+        ;   /* do nothing */
+    }
+    iRet = (iRet2 == FLEXSPI_E_SUCCESS) ? FROM_SUCCESS : FROM_SFDP_ERROR;
+
+err_end:
+    /* バス解放 */
+    sig_sem(l_tDrvInfo.tBusSemID);
+
+    /* 4.解析・反映 */
+    if (iRet == FROM_SUCCESS) {
+        iRet = FROM_SfdpParse(ucBfpt, ulBfptDw, (t4bait.ulDwNum != 0U) ? uc4bait : NULL, t4bait.ulDwNum, &tInfo);
+    }
+    else {
+        ;   /* do nothing */
+    }
+    if (iRet == FROM_SUCCESS) {
+        iRet = _FROM_ApplyPart(&tInfo);
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_ApplyPart                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: デバイス構成反映                                                                */
+/*              LUT命令パラメータを更新してLUTを再設定し、容量・消去単位・完了判定方法を        */
+/*              全デバイスに適用する(2台目以降も同じデバイスとする)                             */
+/*              容量はAHB窓(FROM_SIZE)までとし、AHB窓より大きいデバイスはチップ消去しない       */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptInfo                          SFDP解析結果                                    */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_SFDP_ERROR                 LUTに設定できない構成                           */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_ApplyPart(const FROM_SfdpInfo *ptInfo)
+{
+FlexSPI_LutParam tLut = { 0 };
+FROM_PartInfo tPart   = l_tPartDefault;
+uint32_t i            = 0;
+
+    /* 1.LUT命令パラメータ(DTR・Octalのシーケンスは対象外) */
+    FlexSPI_GetLutParam(&tLut);
+    tLut.ucAddrBits           = (ptInfo->ulAddrBytes == 4U) ? FLEXSPI_LUT_ADDR_32BIT : FLEXSPI_LUT_ADDR_24BIT;
+    tLut.tSpiRead.ucOpcode    = ptInfo->tRead.ucOpcode;
+    tLut.tSpiRead.ucAddrPads  = _FROM_LinesToPads(ptInfo->tRead.ucAddrLines);
+    tLut.tSpiRead.ucDataPads  = _FROM_LinesToPads(ptInfo->tRead.ucDataLines);
+    tLut.tSpiRead.ucDummy     = ptInfo->tRead.ucDummy;
+    tLut.tAhbRead             = tLut.tSpiRead;  /* AHB読み出しは拡張SPIモードで最速の命令 */
+    if (ptInfo->ucEnterQpiOp != 0U) {
+        tLut.tQpiRead.ucOpcode   = ptInfo->tQpiRead.ucOpcode;
+        tLut.tQpiRead.ucAddrPads = kFLEXSPI_4PAD;
+        tLut.tQpiRead.ucDataPads = kFLEXSPI_4PAD;
+        tLut.tQpiRead.ucDummy    = ptInfo->tQpiRead.ucDummy;
+        tLut.ucEnterQuadOp       = ptInfo->ucEnterQpiOp;
+        tLut.ucResetQuadOp       = ptInfo->ucExitQpiOp;
+    }
+    else {
+        ;   /* do nothing */
+    }
+    tLut.ucProgramOp   = ptInfo->ucProgramOp;
+    tLut.ucProgramPads = _FROM_LinesToPads(ptInfo->ucProgramLines);
+    tLut.ucErase4KBOp  = ptInfo->ucEraseOp[FROM_SFDP_ERASE_4KB];
+    tLut.ucErase32KBOp = ptInfo->ucEraseOp[FROM_SFDP_ERASE_32KB];
+    tLut.ucErase64KBOp = ptInfo->ucEraseOp[FROM_SFDP_ERASE_64KB];
+    if (ptInfo->ucSuspendOp != 0U) {
+        tLut.ucSuspendOp = ptInfo->ucSuspendOp;
+        tLut.ucResumeOp  = ptInfo->ucResumeOp;
+    }
+    else {
+        ;   /* do nothing */
+    }
+    if (FlexSPI_SetLutParam(&tLut) != FLEXSPI_E_SUCCESS) {
+        return FROM_SFDP_ERROR;
+    }
+    else {
+        FlexSPI_LoadLUTTable(l_tDrvInfo.tpFlexSPIReg);
+    }
+
+    /* 2.容量・消去単位 */
+    tPart.ulSize = (ptInfo->ulSize < (uint32_t)FROM_SIZE) ? ptInfo->ulSize : (uint32_t)FROM_SIZE;
+    tPart.ulEraseSize[FROM_ERASE_CHIP] = (ptInfo->ulSize <= (uint32_t)FROM_SIZE) ? ptInfo->ulSize : 0U;
+    tPart.ulEraseSize[FROM_ERASE_64KB] = ptInfo->ulEraseSize[FROM_SFDP_ERASE_64KB];
+    tPart.ulEraseSize[FROM_ERASE_32KB] = ptInfo->ulEraseSize[FROM_SFDP_ERASE_32KB];
+    tPart.ulEraseSize[FROM_ERASE_4KB]  = ptInfo->ulEraseSize[FROM_SFDP_ERASE_4KB];
+    tPart.ulSectSize = ptInfo->ulEraseSize[FROM_SFDP_ERASE_4KB];
+    if (ptInfo->ulEraseSize[FROM_SFDP_ERASE_64KB] != 0U) {
+        tPart.ulBlkSize = ptInfo->ulEraseSize[FROM_SFDP_ERASE_64KB];
+    }
+    else if (ptInfo->ulEraseSize[FROM_SFDP_ERASE_32KB] != 0U) {
+        tPart.ulBlkSize = ptInfo->ulEraseSize[FROM_SFDP_ERASE_32KB];
+    }
+    else {
+        tPart.ulBlkSize = ptInfo->ulEraseSize[FROM_SFDP_ERASE_4KB];
+    }
+    tPart.ulPageSize = ptInfo->ulPageSize;
+
+    /* 3.Quadモード・消去中断・完了判定 */
+    tPart.ulQpi     = (ptInfo->ucEnterQpiOp != 0U) ? 1U : 0U;
+    tPart.ulSuspend = (ptInfo->ucSuspendOp != 0U) ? 1U : 0U;
+    if (ptInfo->ucFlagStatus != 0U) {
+        tPart.ulReadySeq    = FLEXSPI_SEQ_READ_FLAG_STATUS;     /* b7:Program or erase controller が'1'なら完了 */
+        tPart.ucReadyMask   = 0x80U;
+        tPart.ucReadyExpect = 0x80U;
+    }
+    else {
+        tPart.ulReadySeq    = FLEXSPI_SEQ_READ_STATUS;          /* b0:write in progress が'0'なら完了 */
+        tPart.ucReadyMask   = 0x01U;
+        tPart.ucReadyExpect = 0x00U;
+    }
+    tPart.ulSfdp = 1U;
+
+    /* 4.全デバイスに適用 */
+    l_tDrvInfo.tPart = tPart;
+    l_tDrvInfo.tSfdp = *ptInfo;
+    for (i = 0; i < FROM_DEV_NUM; i++) {
+        _FROM_SetGeometry(&l_tDrvInfo.tDev[i], l_tDrvInfo.tDev[i].ulWidth);
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_LinesToPads                                                               */
+/*                                                                                              */
+/* DESCRIPTION: 信号線数をLUTのパッド数に変換                                                   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ucLines                         信号線数(1、2、4)                               */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : パッド数                            kFLEXSPI_1PAD/2PAD/4PAD                     */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint8_t _FROM_LinesToPads(uint8_t ucLines)
+{
+uint8_t ucPads = (uint8_t)kFLEXSPI_1PAD;
+
+    if (ucLines == 4U) {
+        ucPads = (uint8_t)kFLEXSPI_4PAD;
+    }
+    else if (ucLines == 2U) {
+        ucPads = (uint8_t)kFLEXSPI_2PAD;
     }
     else {
         ;   /* do nothing */
     }
+
+    return ucPads;
 }
 
 /************************************************************************************************/
 /* FUNCTION   : FROM_Open                                                                       */
 /*                                                                                              */
-/* DESCRIPTION: オープン                                                                        */
+/* DESCRIPTION: オープン(FROM_DEV_0)                                                            */
 /*----------------------------------------------------------------------------------------------*/
 /* INPUT      : none                            なし                                            */
 /*                                                                                              */
@@ -144,12 +620,42 @@ T_CFLG tCFLG = { 0 };
 /*                                                                                              */
 /************************************************************************************************/
 int FROM_Open(void)
+{
+    return FROM_OpenDev(FROM_DEV_0);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_OpenDev                                                                    */
+/*                                                                                              */
+/* DESCRIPTION: オープン(デバイス指定)                                                          */
+/*              最初のデバイスは基準クロックでコントローラーを起動してから、                    */
+/*              現在のクロックプロファイルを適用する                                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(FROM_DEV_*)                        */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_SPI_OPEN_ERROR             オープン処理エラー                              */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_OpenDev(uint32_t ulDev)
 {
 flexspi_device_config_t tConfig = { 0 };
+FROM_DevInfo *ptDev             = NULL;
+const FROM_CalEntry *ptEntry    = NULL;
 int iRet                        = FROM_SPI_OPEN_ERROR;
 
+    /* パラメータチェック */
+    if (FROM_DEV_NUM <= ulDev) {
+        return iRet;                            /* デバイス番号範囲外 */
+    }
+    else {
+        ptDev = &l_tDrvInfo.tDev[ulDev];
+    }
+
     /* 動作状態チェック */
-    if (l_tDrvInfo.ulState != FROM_INIT_STATE) {
+    if (ptDev->ulState != FROM_INIT_STATE) {
         return iRet;                            /* 初期化済み状態でない */
     }
     else {
@@ -157,45 +663,110 @@ int iRet                        = FROM_SPI_OPEN_ERROR;
     }
 
     /* セマフォ取得 */
-    wai_sem(l_tDrvInfo.tSemID);
+    wai_sem(l_tDrvInfo.tCtrlSemID);
+    wai_sem(ptDev->tSemID);
 
     /* 動作状態更新 */
-    l_tDrvInfo.ulState = FROM_OPENING_STATE;    /* オープン処理中 */
-
-    /* コンフィギュレーション情報設定 */
-    tConfig.flexspiRootClk       = 40000000;
-    tConfig.isSck2Enabled        = false;
-    tConfig.flashSize            = (uint32_t)FROM_SIZE / 1024U; /* 設定はKB単位 */
-    tConfig.CSIntervalUnit       = kFLEXSPI_CsIntervalUnit1SckCycle;
-    tConfig.CSInterval           = 3;
-    tConfig.CSHoldTime           = 3;
-    tConfig.CSSetupTime          = 3;
-    tConfig.dataValidTime        = 0;
-    tConfig.columnspace          = 0;
-    tConfig.enableWordAddress    = false;
-    tConfig.AWRSeqIndex          = 0;
-    tConfig.AWRSeqNumber         = 0;
-    tConfig.ARDSeqIndex          = 0;
-    tConfig.ARDSeqNumber         = 0;
-    tConfig.AHBWriteWaitUnit     = kFLEXSPI_AhbWriteWaitUnit2AhbCycle;
-    tConfig.AHBWriteWaitInterval = 0;
-    tConfig.enableWriteMask      = false;
-
-    /* QSPIドライバオープン */
-    iRet = FlexSPI_Open(l_tDrvInfo.tpFlexSPIReg, 0, &tConfig);
+    ptDev->ulState  = FROM_OPENING_STATE;       /* オープン処理中 */
+    ptDev->ulIoMode = FROM_IO_MODE_SPI;         /* リセット後は拡張SPIモード */
+
+    if (l_tDrvInfo.ulOpenMask == 0U) {
+        /* コンフィギュレーション情報設定(最初のオープンは基準クロックプロファイルで行う) */
+        _FROM_MakeConfig(&tConfig, FROM_CLK_PROFILE_DEFAULT);
+        FlexSPI_SetRxClockSource(l_tDrvInfo.tpFlexSPIReg, _FROM_GetRxClkSrc(FROM_CLK_PROFILE_DEFAULT));
+
+        /* QSPIドライバオープン */
+        iRet = FlexSPI_Open(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect, &tConfig);
+        if (iRet == FLEXSPI_E_SUCCESS) {
+            /* SFDPからデバイス構成を取得してLUTを再設定(失敗時は既定値のまま続行する) */
+            (void)_FROM_DiscoverPart(ptDev);
+
+            /* Octal DDRモード移行(以降のコマンドは全て8D-8D-8D) */
+            iRet = _FROM_EnterOctal(ptDev);
+            if (iRet != FLEXSPI_E_SUCCESS) {
+                FlexSPI_Close(l_tDrvInfo.tpFlexSPIReg);
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        if (iRet == FLEXSPI_E_SUCCESS) {
+            l_tDrvInfo.ulOpenMask   = (1UL << ulDev);
+            l_tDrvInfo.ulReadSeq    = l_tClkProfile[FROM_CLK_PROFILE_DEFAULT].ulReadSeq;
+            l_tDrvInfo.ulSpiReadSeq = l_tClkProfile[FROM_CLK_PROFILE_DEFAULT].ulSpiReadSeq;
+
+            /* FIFO転送モード設定(DMA制御関数未登録時はCPU転送のまま) */
+            FlexSPI_SetRxMode(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_XFER_MODE_DMA);
+            FlexSPI_SetTxMode(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_XFER_MODE_DMA);
+
+            /* RX FIFOウォーターマーク設定(1回の読み出し単位をまとめて取得) */
+            iRet = FlexSPI_SetWatermark(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_RX_BUFFER_SIZE, FLEXSPI_WATERMARK_DEFAULT);
+            if (iRet == FLEXSPI_E_SUCCESS) {
+                /* DLL校正結果読み出し(基準クロックで読み出し、校正済みなら掃引を省略する) */
+                _FROM_LoadCalibration();
+
+                /* クロックプロファイル適用 */
+                iRet = _FROM_ApplyClockProfile(l_tDrvInfo.ulClkProfile);
+            }
+            else {
+                ;   /* do nothing */
+            }
+            if (iRet != FLEXSPI_E_SUCCESS) {
+                FlexSPI_Close(l_tDrvInfo.tpFlexSPIReg);
+                l_tDrvInfo.ulOpenMask = 0;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    else {
+        /* 2台目以降は現在のクロックプロファイルでチップセレクトを追加 */
+        _FROM_MakeConfig(&tConfig, l_tDrvInfo.ulClkProfile);
+        iRet = FlexSPI_Open(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect, &tConfig);
+        if (iRet == FLEXSPI_E_SUCCESS) {
+            l_tDrvInfo.ulOpenMask |= (1UL << ulDev);
+
+            /* 校正済みならサンプリング点を上書き */
+            ptEntry = &l_tDrvInfo.tCalRecord.tEntry[l_tDrvInfo.ulClkProfile];
+            if ((l_tDrvInfo.tCalRecord.ulMagic == FROM_CAL_MAGIC) &&
+                (ptEntry->ucValid != 0U)) {
+                iRet = FlexSPI_SetSampleDelay(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect,
+                                              ptEntry->ucRxClkSrc, ptEntry->ucOvrdVal);
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
     if (iRet == FLEXSPI_E_SUCCESS) {
         /* 動作状態更新 */
-        l_tDrvInfo.ulState = FROM_OPEN_STATE;   /* オープン中 */
+        ptDev->ulState = FROM_OPEN_STATE;       /* オープン中 */
         iRet = FROM_SUCCESS;
+
+        /* AHB窓の配置が変わるため全ビューを無効化 */
+        _FROM_TouchGenAll();
     }
     else {
         /* 動作状態更新 */
-        l_tDrvInfo.ulState = FROM_INIT_STATE;   /* 初期化済み */
+        ptDev->ulState = FROM_INIT_STATE;       /* 初期化済み */
         iRet = FROM_SPI_OPEN_ERROR;             /* オープン処理エラー */
     }
 
     /* セマフォ解放 */
-    sig_sem(l_tDrvInfo.tSemID);
+    sig_sem(ptDev->tSemID);
+    sig_sem(l_tDrvInfo.tCtrlSemID);
 
     return iRet;
 }
@@ -203,7 +774,7 @@ int iRet                        = FROM_SPI_OPEN_ERROR;
 /************************************************************************************************/
 /* FUNCTION   : FROM_Close                                                                      */
 /*                                                                                              */
-/* DESCRIPTION: クローズ                                                                        */
+/* DESCRIPTION: クローズ(FROM_DEV_0)                                                            */
 /*----------------------------------------------------------------------------------------------*/
 /* INPUT      : none                            なし                                            */
 /*                                                                                              */
@@ -214,18 +785,45 @@ int iRet                        = FROM_SPI_OPEN_ERROR;
 /************************************************************************************************/
 int FROM_Close(void)
 {
-int iRet = FROM_SPI_CLOSE_ERROR;
+    return FROM_CloseDev(FROM_DEV_0);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_CloseDev                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: クローズ(デバイス指定)                                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(FROM_DEV_*)                        */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_SPI_CLOSE_ERROR            クローズ処理エラー                              */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_CloseDev(uint32_t ulDev)
+{
+FROM_DevInfo *ptDev = NULL;
+int iRet            = FROM_SPI_CLOSE_ERROR;
+
+    /* パラメータチェック */
+    if (FROM_DEV_NUM <= ulDev) {
+        return iRet;            /* デバイス番号範囲外 */
+    }
+    else {
+        ptDev = &l_tDrvInfo.tDev[ulDev];
+    }
 
     /* 動作状態チェック */
-    if (l_tDrvInfo.ulState == FROM_BUSY_STATE) {
+    if (ptDev->ulState == FROM_BUSY_STATE) {
         return iRet;    /* 入出力動作中 */
     }
     else {
         ;   /* do nothng */
     }
 
-    if ((l_tDrvInfo.ulState == FROM_NONE_STATE) ||
-        (l_tDrvInfo.ulState == FROM_INIT_STATE)) {
+    if ((ptDev->ulState == FROM_NONE_STATE) ||
+        (ptDev->ulState == FROM_INIT_STATE)) {
         return FROM_SUCCESS;    /* 未オープンなので正常終了とする */
     }
     else {
@@ -233,847 +831,3052 @@ int iRet = FROM_SPI_CLOSE_ERROR;
     }
 
     /* セマフォ取得 */
-    wai_sem(l_tDrvInfo.tSemID);
+    wai_sem(l_tDrvInfo.tCtrlSemID);
+    _FROM_LockDev(ptDev, FROM_LOCK_EXCL, 0U, 0U);
 
     /* 動作状態更新 */
-    l_tDrvInfo.ulState = FROM_CLOSING_STATE;    /* クローズ処理中 */
+    ptDev->ulState = FROM_CLOSING_STATE;    /* クローズ処理中 */
+
+    /* Quadモード解除(デバイスを拡張SPIモードへ戻し、ブートROM等から再認識できるようにする) */
+    wai_sem(l_tDrvInfo.tBusSemID);
+    iRet = _FROM_SetIoMode(ptDev, FROM_IO_MODE_SPI);
+    sig_sem(l_tDrvInfo.tBusSemID);
 
-    /* QSPIドライバクローズ */
-    iRet = FlexSPI_Close(l_tDrvInfo.tpFlexSPIReg);
+    /* Octal DDRモード解除(同上) */
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        iRet = _FROM_ExitOctal(ptDev);
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* QSPIドライバクローズ(最後のデバイスではコントローラーも停止する) */
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        wai_sem(l_tDrvInfo.tBusSemID);
+        iRet = FlexSPI_CloseCS(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect);
+        sig_sem(l_tDrvInfo.tBusSemID);
+    }
+    else {
+        ;   /* do nothing */
+    }
     if (iRet == FLEXSPI_E_SUCCESS) {
         /* 動作状態更新 */
-        l_tDrvInfo.ulState = FROM_INIT_STATE;    /* 初期化済み */
+        l_tDrvInfo.ulOpenMask &= ~(1UL << ulDev);
+        ptDev->ulState = FROM_INIT_STATE;    /* 初期化済み */
         iRet = FROM_SUCCESS;
+
+        /* AHB窓の配置が変わるため全ビューを無効化 */
+        _FROM_TouchGenAll();
     }
     else {
         /* 動作状態更新 */
-        l_tDrvInfo.ulState = FROM_OPEN_STATE;    /* オープン中 */
+        ptDev->ulState = FROM_OPEN_STATE;    /* オープン中 */
+        iRet = FROM_SPI_CLOSE_ERROR;
     }
 
     /* セマフォ解放 */
-    sig_sem(l_tDrvInfo.tSemID);
+    sig_sem(ptDev->tSemID);
+    sig_sem(l_tDrvInfo.tCtrlSemID);
 
     return iRet;
 }
 
 /************************************************************************************************/
-/* FUNCTION   : FROM_Write                                                                      */
+/* FUNCTION   : FROM_SetClockProfile                                                            */
 /*                                                                                              */
-/* DESCRIPTION: 書き込み                                                                        */
+/* DESCRIPTION: クロックプロファイル設定(全デバイス共通)                                        */
+/*              オープン前は次回オープン時に反映、オープン中は入出力の完了を待って切り替える    */
 /*----------------------------------------------------------------------------------------------*/
-/* INPUT      : uiAddress                       書き込みを開始するアドレス                      */
-/*            : uiLength                        書き込みデータ長                                */
-/*            : strWriteData                    書き込みデータ                                  */
+/* INPUT      : ulProfile                       FROM_CLK_PROFILE_*                              */
 /*                                                                                              */
 /* OUTPUT     : none                            なし                                            */
 /*                                                                                              */
 /* RESULTS    : FROM_SUCCESS                    正常終了                                        */
-/*            : FROM_WRITE_ERROR                書き込みエラー                                  */
-/*            : FROM_WRITE_ENABLE_ERROR         書き込み失敗                                    */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                未初期化                                        */
+/*              FROM_CLOCK_ERROR                クロック変更エラー                              */
 /*                                                                                              */
 /************************************************************************************************/
-int FROM_Write(unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData)
+int FROM_SetClockProfile(uint32_t ulProfile)
 {
-uint32_t ulSize = 0;
-int iRet        = FROM_WRITE_ERROR;
+uint32_t ulOld = 0;
+int iRet       = FROM_CLOCK_ERROR;
 
     /* パラメータチェック */
-    if (FROM_SIZE <= uiAddress) {
-        iRet = FROM_WRITE_ERROR;    /* 書き込み開始アドレスが範囲外 */
-        goto err_end;
+    if (FROM_CLK_PROFILE_NUM <= ulProfile) {
+        return FROM_PARAM_ERROR;    /* プロファイル範囲外 */
     }
     else {
         ;   /* do nothing */
     }
 
-    if (FROM_SIZE < (uiAddress + uiLength)) {
-        iRet = FROM_WRITE_ERROR;    /* 書き込みサイズが範囲外 */
-        goto err_end;
+    /* 動作状態チェック */
+    if (l_tDrvInfo.ulInit == 0U) {
+        return FROM_STATE_ERROR;    /* 未初期化 */
     }
     else {
         ;   /* do nothing */
     }
 
-    if (strWriteData == NULL) {
-        iRet = FROM_WRITE_ERROR;    /* 書き込みデータ未設定 */
-        goto err_end;
-    }
-    else {
-        ;   /* do nothing */
-    }
+    /* セマフォ取得 */
+    wai_sem(l_tDrvInfo.tCtrlSemID);
 
-    /* 動作状態チェック */
-    if (l_tDrvInfo.ulState != FROM_OPEN_STATE) {
-        iRet = FROM_WRITE_ERROR;    /* オープン中でない */
-        goto err_end;
+    if (l_tDrvInfo.ulOpenMask == 0U) {
+        /* 未オープン時は保持のみ */
+        l_tDrvInfo.ulClkProfile = ulProfile;
+        iRet = FROM_SUCCESS;
     }
     else {
-        ;   /* do nothng */
-    }
-
-    /* セマフォ取得 */
-    wai_sem(l_tDrvInfo.tSemID);
-
-    /* 動作状態更新 */
-    l_tDrvInfo.ulState = FROM_BUSY_STATE;   /* 入出力中 */
-
-    /* 書き込み処理 */
+        /* 全デバイスの入出力完了待ち */
+        _FROM_LockAllDev();
 
-    while (0 < uiLength) {
-        /* １回の書き込みサイズ設定 */
-        ulSize = (FLEXSPI_TX_BUFFER_SIZE < uiLength) ? FLEXSPI_TX_BUFFER_SIZE : uiLength;
-
-        /* 書き込み処理 */
-        iRet = _FROM_WriteCore( uiAddress, ulSize, strWriteData );
-        if (iRet != FROM_SUCCESS) {
-            iRet = FROM_WRITE_ERROR;        /* 書き込みエラー */
-            goto err_end1;
+        /* SCLK周波数変更(校正済みならサンプリング点も切り替える) */
+        ulOld = l_tDrvInfo.ulClkProfile;
+        if (_FROM_ApplyClockProfile(ulProfile) == FLEXSPI_E_SUCCESS) {
+            iRet = FROM_SUCCESS;
         }
         else {
-            /* 残書き込み長・アドレス更新 */
-            strWriteData += ulSize;
-            uiAddress    += ulSize;
-            uiLength     -= ulSize;
+            /* 元のクロックプロファイルに戻す */
+            _FROM_ApplyClockProfile(ulOld);
+            iRet = FROM_CLOCK_ERROR;    /* クロック変更エラー */
         }
-    }
 
-err_end1:
-    /* 動作状態更新 */
-    l_tDrvInfo.ulState = FROM_OPEN_STATE;   /* オープン中 */
+        _FROM_UnlockAllDev();
+    }
 
     /* セマフォ解放 */
-    sig_sem(l_tDrvInfo.tSemID);
+    sig_sem(l_tDrvInfo.tCtrlSemID);
 
-err_end:
     return iRet;
 }
 
 /************************************************************************************************/
-/* FUNCTION   : FROM_Read                                                                       */
+/* FUNCTION   : FROM_GetClockProfile                                                            */
 /*                                                                                              */
-/* DESCRIPTION: 読み出し                                                                        */
+/* DESCRIPTION: クロックプロファイル取得                                                        */
 /*----------------------------------------------------------------------------------------------*/
-/* INPUT      : uiAddress                       読みだしを開始するアドレス                      */
-/*            : uiLength                        読み出しデータ長                                */
-/*            : strReadData                     読み出しデータバッファ                          */
+/* INPUT      : none                            なし                                            */
 /*                                                                                              */
 /* OUTPUT     : none                            なし                                            */
 /*                                                                                              */
-/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
-/*            : FROM_READ_ERROR                 読み出しエラー                                  */
+/* RESULTS    : FROM_CLK_PROFILE_*              現在のクロックプロファイル                      */
 /*                                                                                              */
 /************************************************************************************************/
-int FROM_Read(unsigned int uiAddress, unsigned int uiLength, unsigned char *strReadData)
+uint32_t FROM_GetClockProfile(void)
 {
-int iRet        = FROM_READ_ERROR;
-uint32_t ulSize = 0;
-
-    /* パラメータチェック */
-    if (FROM_SIZE <= uiAddress) {
-        iRet = FROM_READ_ERROR;     /* 読み出し開始アドレスが範囲外 */
-        goto err_end;
-    }
-    else {
-        ;   /* do nothing */
-    }
+    return l_tDrvInfo.ulClkProfile;
+}
 
-    if (FROM_SIZE < (uiAddress + uiLength)) {
-        iRet = FROM_READ_ERROR;     /* 読み出しサイズが範囲外 */
-        goto err_end;
-    }
-    else {
-        ;   /* do nothing */
-    }
+/************************************************************************************************/
+/* FUNCTION   : FROM_Calibrate                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: DLL校正                                                                         */
+/*              基準クロックで校正パターンを確認した後、指定プロファイルのクロックで            */
+/*              RXサンプルクロックソース毎にDLL遅延セル数を掃引し、最も広い合格ウィンドウ       */
+/*              の中央を採用する。結果はFROM_CAL_RECORD_ADDRに保存し、次回以降のオープン時に    */
+/*              適用する                                                                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulProfile                       校正するクロックプロファイル(FROM_CLK_PROFILE_*)*/
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                オープン中でない                                */
+/*              FROM_CLOCK_ERROR                クロック変更エラー                              */
+/*              FROM_CAL_ERROR                  有効なサンプリング点なし                        */
+/*              FROM_ERASE_ERROR                校正領域の消去エラー                            */
+/*              FROM_WRITE_ERROR                校正領域の書き込みエラー(校正結果は適用済み)    */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_Calibrate(uint32_t ulProfile)
+{
+FROM_CalEntry *ptEntry = NULL;
+uint32_t ulOld         = 0;
+uint32_t ulApplied     = 0;
+uint32_t ulCentre      = 0;
+uint32_t ulWidth       = 0;
+uint32_t ulBestSrc     = 0;
+uint32_t ulBestCentre  = 0;
+uint32_t ulBestWidth   = 0;
+uint32_t i             = 0;
+int iRet               = FROM_CAL_ERROR;
 
-    if (strReadData == NULL) {
-        iRet = FROM_READ_ERROR;     /* 読み出しバッファ未設定 */
-        goto err_end;
+    /* パラメータチェック */
+    if (FROM_CLK_PROFILE_NUM <= ulProfile) {
+        return FROM_PARAM_ERROR;    /* プロファイル範囲外 */
     }
     else {
         ;   /* do nothing */
     }
 
     /* 動作状態チェック */
-    if (l_tDrvInfo.ulState != FROM_OPEN_STATE) {
-        iRet = FROM_READ_ERROR;     /* オープン中でない */
-        goto err_end;
+    if ((l_tDrvInfo.tDev[FROM_DEV_0].ulState != FROM_OPEN_STATE) ||
+        (l_tDrvInfo.ulParallel != FROM_PARALLEL_OFF)) {
+        return FROM_STATE_ERROR;    /* オープン中でない、またはパラレルモード(校正はFROM_DEV_0単体で行う) */
     }
     else {
-        ;   /* do nothng */
+        ;   /* do nothing */
     }
 
     /* セマフォ取得 */
-    wai_sem(l_tDrvInfo.tSemID);
-
-    /* 動作状態更新 */
-    l_tDrvInfo.ulState = FROM_BUSY_STATE;
-
-    /* 読み出し処理 */
-    while (0 < uiLength) {
-        /* １回の読み出しサイズ設定 */
-        ulSize = (FLEXSPI_RX_BUFFER_SIZE < uiLength) ? FLEXSPI_RX_BUFFER_SIZE : uiLength;
-        /* 読み出し処理 */
-        iRet = _FROM_ReadCore(uiAddress, ulSize, strReadData );
-        if (iRet != FROM_SUCCESS) {
-            iRet = FROM_READ_ERROR; /* 読み出しエラー */
-            goto err_end1;
-        }
-        else {
-            /* 残読み出し長・アドレス更新 */
-            strReadData += ulSize;
-            uiAddress   += ulSize;
-            uiLength    -= ulSize;
-        }
-    }
+    wai_sem(l_tDrvInfo.tCtrlSemID);
 
-err_end1:
-    /* 動作状態更新 */
-    l_tDrvInfo.ulState = FROM_OPEN_STATE;   /* オープン中 */
-
-    /* セマフォ解放 */
-    sig_sem(l_tDrvInfo.tSemID);
-
-err_end:
-    return iRet;
-}
+    /* 全デバイスの入出力完了待ち */
+    _FROM_LockAllDev();
 
-/************************************************************************************************/
-/* FUNCTION   : FROM_SectorErase                                                                */
-/*                                                                                              */
-/* DESCRIPTION: セクタ消去                                                                      */
-/*----------------------------------------------------------------------------------------------*/
-/* INPUT      : uiAddress                       消去を開始するアドレス                          */
-/*            : uiLength                        消去するバイト数                                */
-/*                                                                                              */
-/* OUTPUT     : none                            なし                                            */
-/*                                                                                              */
-/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
-/*            : FROM_ERASE_ERROR                消去エラー                                      */
-/*                                                                                              */
-/************************************************************************************************/
-int FROM_SectorErase(unsigned int uiAddress, unsigned int uiLength)
-{
-int iRet = FROM_ERASE_ERROR;
+    ulOld = l_tDrvInfo.ulClkProfile;
 
-    /* パラメータチェック */
-    if (FROM_SIZE <= uiAddress) {
-        iRet = FROM_ERASE_ERROR;    /* 消去開始アドレスが範囲を超えている */
+    /* 1)基準クロックで校正パターン確認(不一致時は書き込む) */
+    if (_FROM_ApplyClockProfile(FROM_CLK_PROFILE_DEFAULT) != FLEXSPI_E_SUCCESS) {
+        iRet = FROM_CLOCK_ERROR;
         goto err_end;
     }
     else {
         ;   /* do nothing */
     }
 
-    if ((uiAddress % FROM_SECT_SIZE) != 0) {
-        iRet = FROM_ERASE_ERROR;    /* 消去開始アドレスがセクタ境界でない */
+    iRet = _FROM_PrepareCalPattern();
+    if (iRet != FROM_SUCCESS) {
         goto err_end;
     }
     else {
         ;   /* do nothing */
     }
 
-    if (FROM_SIZE < (uiAddress + uiLength)) {
-        iRet = FROM_ERASE_ERROR;    /* 消去バイト数が範囲を超えている */
+    /* 2)校正対象のクロックへ変更 */
+    if (_FROM_ApplyClockProfile(ulProfile) != FLEXSPI_E_SUCCESS) {
+        iRet = FROM_CLOCK_ERROR;
         goto err_end;
     }
     else {
         ;   /* do nothing */
     }
 
-    if ((uiLength % FROM_SECT_SIZE) != 0) {
-        iRet = FROM_ERASE_ERROR;    /* 消去バイト数がセクタ境界でない */
+    /* 3)RXサンプルクロックソース毎に掃引し、最も広い合格ウィンドウを選択 */
+    for (i = 0; i < (uint32_t)(sizeof(l_ulCalRxClkSrc) / sizeof(l_ulCalRxClkSrc[0])); i++) {
+        iRet = _FROM_SweepSampleDelay(l_ulCalRxClkSrc[i], &ulCentre, &ulWidth);
+        if (iRet == FROM_CLOCK_ERROR) {
+            goto err_end;
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        if ((iRet == FROM_SUCCESS) && (ulBestWidth < ulWidth)) {
+            ulBestSrc    = l_ulCalRxClkSrc[i];
+            ulBestCentre = ulCentre;
+            ulBestWidth  = ulWidth;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    if (ulBestWidth < FROM_CAL_WINDOW_MIN) {
+        iRet = FROM_CAL_ERROR;      /* 安定して読み出せるサンプリング点なし */
         goto err_end;
     }
     else {
         ;   /* do nothing */
     }
 
-    /* 動作状態チェック */
-    if (l_tDrvInfo.ulState != FROM_OPEN_STATE) {
-        iRet = FROM_ERASE_ERROR;    /* オープン状態でない */
+    /* 4)校正結果適用(同一基板上の同一デバイスとして全デバイスに適用する) */
+    ptEntry = &l_tDrvInfo.tCalRecord.tEntry[ulProfile];
+    ptEntry->ucValid    = 1U;
+    ptEntry->ucRxClkSrc = (uint8_t)ulBestSrc;
+    ptEntry->ucOvrdVal  = (uint8_t)ulBestCentre;
+    ptEntry->ucWindow   = (uint8_t)ulBestWidth;
+    FROM_CalSealRecord(&l_tDrvInfo.tCalRecord);
+
+    if (_FROM_ApplyClockProfile(ulProfile) != FLEXSPI_E_SUCCESS) {
+        iRet = FROM_CLOCK_ERROR;
         goto err_end;
     }
     else {
-        ;   /* do nothing */
+        ulApplied = 1;
     }
 
-    /* セマフォ取得 */
-    wai_sem(l_tDrvInfo.tSemID);
-
-    /* 動作状態更新 */
-    l_tDrvInfo.ulState = FROM_BUSY_STATE;
+    /* 5)校正結果保存 */
+    iRet = _FROM_SaveCalibration();
 
-    while (0 < uiLength) {
-        /* セクタ消去処理 */
-        iRet = _FROM_SectorEraseCore(uiAddress, (unsigned int)FROM_SECT_SIZE);
-        if (iRet != FROM_SUCCESS) {
-            iRet = FROM_ERASE_ERROR;    /* セクタ消去エラー */
-            goto err_end1;
-        }
-        else {
-            /* 消去するアドレス／残消去サイズ更新 */
-            uiAddress += FROM_SECT_SIZE;
-            uiLength  -= FROM_SECT_SIZE;
-        }
+err_end:
+    /* 校正結果を適用できなかった場合は元のクロックプロファイルに戻す */
+    if (ulApplied == 0U) {
+        _FROM_ApplyClockProfile(ulOld);
+    }
+    else {
+        ;   /* do nothing */
     }
 
-err_end1:
-    /* 動作状態更新 */
-    l_tDrvInfo.ulState = FROM_OPEN_STATE;
+    _FROM_UnlockAllDev();
 
     /* セマフォ解放 */
-    sig_sem(l_tDrvInfo.tSemID);
+    sig_sem(l_tDrvInfo.tCtrlSemID);
 
-err_end:
     return iRet;
 }
 
 /************************************************************************************************/
-/* FUNCTION   : FROM_BlockErase                                                                 */
+/* FUNCTION   : FROM_SetParallelMode                                                            */
 /*                                                                                              */
-/* DESCRIPTION: ブロック消去                                                                    */
+/* DESCRIPTION: パラレルモード設定                                                              */
+/*              FROM_DEV_0とFROM_DEV_1を同時にアクセスし、FROM_DEV_0のアドレス空間として扱う    */
+/*              サイズ・消去単位は2倍となり、FROM_DEV_1はパラレルモード解除まで入出力中となる   */
+/*              データは2台で組になるため、個別アクセスとは混在させないこと                     */
 /*----------------------------------------------------------------------------------------------*/
-/* INPUT      : uiAddress                       消去を開始するアドレス                          */
-/*            : uiLength                        消去するバイト数                                */
+/* INPUT      : ulMode                          FROM_PARALLEL_ON / FROM_PARALLEL_OFF            */
 /*                                                                                              */
 /* OUTPUT     : none                            なし                                            */
 /*                                                                                              */
 /* RESULTS    : FROM_SUCCESS                    正常終了                                        */
-/*            : FROM_ERASE_ERROR                消去エラー                                      */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                FROM_DEV_0・FROM_DEV_1がオープン中でない        */
+/*              FROM_SPI_OPEN_ERROR             FlexSPIコントローラー設定エラー                 */
 /*                                                                                              */
 /************************************************************************************************/
-int FROM_BlockErase(unsigned int uiAddress, unsigned int uiLength)
+int FROM_SetParallelMode(uint32_t ulMode)
 {
-int iRet = FROM_ERASE_ERROR;
+uint32_t ulWidth = 1U;
+int iRet         = FROM_SPI_OPEN_ERROR;
 
     /* パラメータチェック */
-    if (FROM_SIZE <= uiAddress) {
-        iRet = FROM_ERASE_ERROR;    /* 消去開始アドレスが範囲を超えている */
-        goto err_end;
+    if ((ulMode != FROM_PARALLEL_OFF) && (ulMode != FROM_PARALLEL_ON)) {
+        return FROM_PARAM_ERROR;
     }
     else {
         ;   /* do nothing */
     }
 
-    if ((uiAddress % FROM_BLK_SIZE) != 0) {
-        iRet = FROM_ERASE_ERROR;    /* 消去開始アドレスがブロック境界でない */
-        goto err_end;
+    /* セマフォ取得 */
+    wai_sem(l_tDrvInfo.tCtrlSemID);
+
+    /* 動作状態チェック(両デバイスがオープン中であること) */
+    if (l_tDrvInfo.ulOpenMask != ((1UL << FROM_DEV_0) | (1UL << FROM_DEV_1))) {
+        sig_sem(l_tDrvInfo.tCtrlSemID);
+        return FROM_STATE_ERROR;
     }
     else {
         ;   /* do nothing */
     }
 
-    if (FROM_SIZE < (uiAddress + uiLength)) {
-        iRet = FROM_ERASE_ERROR;    /* 消去バイト数が範囲を超えている */
-        goto err_end;
+    /* 全デバイスの入出力完了待ち */
+    _FROM_LockAllDev();
+
+    /* QSPIドライバ設定(両デバイスのI/Oモードを揃えるため、先に拡張SPIモードへ戻す) */
+    wai_sem(l_tDrvInfo.tBusSemID);
+    iRet = _FROM_SetIoMode(&l_tDrvInfo.tDev[FROM_DEV_0], FROM_IO_MODE_SPI);
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        iRet = _FROM_SetIoMode(&l_tDrvInfo.tDev[FROM_DEV_1], FROM_IO_MODE_SPI);
     }
     else {
         ;   /* do nothing */
     }
-
-    if ((uiLength % FROM_BLK_SIZE) != 0) {
-        iRet = FROM_ERASE_ERROR;    /* 消去バイト数がブロック境界でない */
-        goto err_end;
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        iRet = FlexSPI_SetParallelMode(l_tDrvInfo.tpFlexSPIReg,
+                                       (ulMode == FROM_PARALLEL_ON) ? FLEXSPI_PARALLEL_ON : FLEXSPI_PARALLEL_OFF);
     }
     else {
         ;   /* do nothing */
     }
+    sig_sem(l_tDrvInfo.tBusSemID);
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        /* アクセス単位更新 */
+        ulWidth = (ulMode == FROM_PARALLEL_ON) ? FLEXSPI_PARALLEL_WIDTH : 1U;
+        _FROM_SetGeometry(&l_tDrvInfo.tDev[FROM_DEV_0], ulWidth);
+        l_tDrvInfo.ulParallel = ulMode;
+        iRet = FROM_SUCCESS;
 
-    /* 動作状態チェック */
-    if (l_tDrvInfo.ulState != FROM_OPEN_STATE) {
-        iRet = FROM_ERASE_ERROR;    /* オープン状態でない */
-        goto err_end;
+        /* データ配置が変わるため全ビューを無効化 */
+        _FROM_TouchGenAll();
     }
     else {
-        ;   /* do nothing */
-    }
-
-    /* セマフォ取得 */
-    wai_sem(l_tDrvInfo.tSemID);
-
-    /* 動作状態更新 */
-    l_tDrvInfo.ulState = FROM_BUSY_STATE;
-
-    while (0 < uiLength) {
-        /* ブロック消去処理 */
-        iRet = _FROM_BlockEraseCore(uiAddress, (unsigned int)FROM_BLK_SIZE);
-        if (iRet != FROM_SUCCESS) {
-            iRet = FROM_ERASE_ERROR;    /* ブロック消去エラー */
-            goto err_end1;
-        }
-        else {
-            /* 消去するアドレス／残消去サイズ更新 */
-            uiAddress += FROM_BLK_SIZE;
-            uiLength  -= FROM_BLK_SIZE;
-        }
+        iRet = FROM_SPI_OPEN_ERROR;
     }
 
-err_end1:
-    /* 動作状態更新 */
-    l_tDrvInfo.ulState = FROM_OPEN_STATE;
+    _FROM_UnlockAllDev();
 
     /* セマフォ解放 */
-    sig_sem(l_tDrvInfo.tSemID);
+    sig_sem(l_tDrvInfo.tCtrlSemID);
 
-err_end:
     return iRet;
 }
 
 /************************************************************************************************/
-/* FUNCTION   : FROM_getState                                                                   */
-/*                                                                                              */
-/* DESCRIPTION: NORドライバ動作状態取得                                                         */
-/*----------------------------------------------------------------------------------------------*/
-/* INPUT      : none                            なし                                            */
-/*                                                                                              */
-/* OUTPUT     : none                            なし                                            */
-/*                                                                                              */
-/* RESULTS    : FROM_STATUS                     NORドライバ動作状態                             */
-/*                                                                                              */
-/************************************************************************************************/
-int FROM_getState(void)
-{
-    return l_tDrvInfo.ulState;
-}
-
-/****************************************************************************/
-/*  ローカル関数                                                            */
-/****************************************************************************/
-/************************************************************************************************/
-/* FUNCTION   : _FROM_WriteCore                                                                 */
+/* FUNCTION   : FROM_SetDeviceType                                                              */
 /*                                                                                              */
-/* DESCRIPTION: 書き込み処理                                                                    */
+/* DESCRIPTION: デバイス種別設定                                                                */
+/*              LUT・コントローラー構成は次回のオープンから有効                                 */
+/*              Octalデバイスはポートの信号線を結合するためFROM_DEV_0のみ使用可能               */
 /*----------------------------------------------------------------------------------------------*/
-/* INPUT      : uiAddress                       書き込みを開始するアドレス                      */
-/*            : uiLength                        書き込みデータ長                                */
-/*            : strWriteData                    書き込みデータ                                  */
+/* INPUT      : ulType                          FROM_DEVICE_*                                   */
 /*                                                                                              */
 /* OUTPUT     : none                            なし                                            */
 /*                                                                                              */
 /* RESULTS    : FROM_SUCCESS                    正常終了                                        */
-/*            : FROM_WRITE_ERROR                書き込みエラー                                  */
-/*            : FROM_WRITE_ENABLE_ERROR         書き込み失敗                                    */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                オープン中のデバイスがある                      */
 /*                                                                                              */
 /************************************************************************************************/
-LOCAL int _FROM_WriteCore(unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData)
+int FROM_SetDeviceType(uint32_t ulType)
 {
-FLGPTN tFlgPtn         = 0;
-int iRet               = FROM_WRITE_ERROR;
-uint32_t i             = 0;
-unsigned char ucStatus = 0x00;
-
-    /* 書き込み許可 */
-    FlexSPI_SetWriteEnableSequence(l_tDrvInfo.tpFlexSPIReg);    /* LUT設定 */
-    iRet = FlexSPI_ExecCommand(l_tDrvInfo.tpFlexSPIReg, 0, 0);  /* コマンド実行 */
-    if (iRet != FLEXSPI_E_SUCCESS) {
-        iRet = FROM_WRITE_ENABLE_ERROR;
-        goto err_end;
-    }
-    else {
-        ;   /* do nothing */
-    }
+int iRet = FROM_STATE_ERROR;
 
-    /* 書き込み */
-    FlexSPI_SetQuadWriteSequence(l_tDrvInfo.tpFlexSPIReg);      /* LUT設定 */
-    iRet = FlexSPI_WriteTxFifo(l_tDrvInfo.tpFlexSPIReg, strWriteData, uiAddress, uiLength);
-    if (iRet != FLEXSPI_E_SUCCESS) {
-        iRet = FROM_WRITE_ERROR;
-        goto err_end;
+    /* パラメータチェック */
+    if ((sizeof(l_ulDeviceType) / sizeof(l_ulDeviceType[0])) <= ulType) {
+        return FROM_PARAM_ERROR;
     }
     else {
         ;   /* do nothing */
     }
 
-    /* 書き込み完了待ち */
-    FlexSPI_SetReadStatusSequence(l_tDrvInfo.tpFlexSPIReg);
-    for (i = 0; i < 1000U; i++) {
-        /* ステータス読み出し */
-        ucStatus = FlexSPI_ExecCommandAndRead(l_tDrvInfo.tpFlexSPIReg, 0, 0);
-        if (ucStatus == 0xFF) {
-            iRet = FROM_WRITE_ERROR;
-            goto err_end;
-        }
-        else {
-            ;   /* do nothing */
-        }
-        /* ステータスチェック(b0:write in progress ビットが'0'なら完了) */
-        if ((ucStatus & 0x01) == 0) {
-            break;
-        }
-        else {
-            /* ウエイト */
-            twai_flg(l_tDrvInfo.tFlgID, FROM_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, 1);
-        }
-    }
-    if (i == 1000U) {
-        iRet = FROM_WRITE_ERROR;
-        goto err_end;
-    }
+    /* セマフォ取得 */
+    wai_sem(l_tDrvInfo.tCtrlSemID);
 
-    FlexSPI_SetReadFlagStatusSequence(l_tDrvInfo.tpFlexSPIReg);     /* LUT設定 */
-    for (i = 0; i < 1000U; i++) {
-        /* フラグステータス読み出し */
-        ucStatus = FlexSPI_ExecCommandAndRead(l_tDrvInfo.tpFlexSPIReg, 0, 0);
-        if (ucStatus == 0xFF) {
-            iRet = FROM_WRITE_ERROR;
-            goto err_end;
-        }
-        else {
-            ;   /* do nothing */
-        }
-        /* ステータスチェック(b7:Program or erase controller ビットが'1'なら完了) */
-        if ((ucStatus & 0x80) != 0) {
-            break;
-        }
-        else {
-            /* ウエイト */
-            twai_flg(l_tDrvInfo.tFlgID, FROM_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, 1);
-        }
+    /* 動作状態チェック(LUT・コントローラー構成はオープン時に決まる) */
+    if (l_tDrvInfo.ulOpenMask != 0U) {
+        iRet = FROM_STATE_ERROR;
     }
-    if (i == 1000U) {
-        iRet = FROM_WRITE_ERROR;
-        goto err_end;
+    else if (FlexSPI_SetDeviceType(l_ulDeviceType[ulType]) != FLEXSPI_E_SUCCESS) {
+        iRet = FROM_PARAM_ERROR;
     }
     else {
         iRet = FROM_SUCCESS;
     }
-err_end:
+
+    /* セマフォ解放 */
+    sig_sem(l_tDrvInfo.tCtrlSemID);
+
     return iRet;
 }
 
 /************************************************************************************************/
-/* FUNCTION   : _FROM_ReadCore                                                                  */
+/* FUNCTION   : FROM_ReadPtr                                                                    */
 /*                                                                                              */
-/* DESCRIPTION: 読み出し処理                                                                    */
+/* DESCRIPTION: 読み出しビュー取得                                                              */
+/*              AHB窓上のデータを複写せずに参照する                                             */
+/*              参照中に書き込み・消去・構成変更があるとデータは不定となるため、                */
+/*              参照後にFROM_IsViewValidで判定し、無効なら取得し直すこと                        */
 /*----------------------------------------------------------------------------------------------*/
-/* INPUT      : uiAddress                       読み出しを開始するアドレス                      */
+/* INPUT      : ulDev                           デバイス番号(FROM_DEV_*)                        */
+/*            : uiAddress                       読み出しを開始するアドレス                      */
 /*            : uiLength                        読み出しデータ長                                */
 /*                                                                                              */
-/* OUTPUT     : strReadData                     読み出しデータ格納バッファ                      */
-/* OUTPUT     : none                            なし                                            */
+/* OUTPUT     : ptView                          読み出しビュー                                  */
 /*                                                                                              */
 /* RESULTS    : FROM_SUCCESS                    正常終了                                        */
-/*            : FROM_READ_ERROR                 読み出しエラー                                  */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                オープン中でない、またはAHB窓に配置されていない */
+/*              FROM_READ_ERROR                 Quadモード解除エラー                            */
 /*                                                                                              */
 /************************************************************************************************/
-LOCAL int _FROM_ReadCore(unsigned int uiAddress, unsigned int uiLength, unsigned char *strReadData)
+int FROM_ReadPtr(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, FROM_View *ptView)
 {
-int iRet  = FROM_READ_ERROR;
-int iRet2 = FROM_READ_ERROR;
+FROM_DevInfo *ptDev = NULL;
+uint32_t ulAhb      = 0;
+int iRet            = FROM_STATE_ERROR;
 
-    /* Quadモード設定 */
-    FlexSPI_SetEnterQuadModeSequence(l_tDrvInfo.tpFlexSPIReg);          /* LUT設定 */
-    iRet2 = FlexSPI_ExecCommand(l_tDrvInfo.tpFlexSPIReg, 0, 0);          /* コマンド実行 */
-    if (iRet2 != FLEXSPI_E_SUCCESS) {
-        iRet = FROM_READ_ERROR;
-        goto err_end;
+    /* パラメータチェック */
+    if ((FROM_DEV_NUM <= ulDev) ||              /* デバイス番号範囲外 */
+        (ptView == NULL)) {                     /* ビュー未設定 */
+        return FROM_PARAM_ERROR;
     }
     else {
-        ;   /* do nothing */
+        ptDev = &l_tDrvInfo.tDev[ulDev];
     }
 
-    /* 読み出し */
-    FlexSPI_SetQuadIOReadSequence(l_tDrvInfo.tpFlexSPIReg);                     /* LUT設定 */
-    iRet2 = FlexSPI_ExecCommand(l_tDrvInfo.tpFlexSPIReg, uiAddress, uiLength);  /* コマンド実行 */
-    if (iRet2 != FLEXSPI_E_SUCCESS) {
-        iRet = FROM_READ_ERROR;
-        goto err_end1;
+    if ((ptDev->ulSize <= uiAddress) ||         /* 開始アドレスが範囲外 */
+        (ptDev->ulSize <  (uiAddress + uiLength))) {    /* サイズが範囲外 */
+        return FROM_PARAM_ERROR;
     }
     else {
         ;   /* do nothing */
     }
 
-    iRet2 = FlexSPI_ReadRxFifo(l_tDrvInfo.tpFlexSPIReg, strReadData, uiLength);  /* RX FIFO読み出し */
-    if (iRet2 != FLEXSPI_E_SUCCESS) {
-        iRet = FROM_READ_ERROR;
-        goto err_end;
+    /* 動作状態チェック */
+    if (ptDev->ulState != FROM_OPEN_STATE) {
+        return FROM_STATE_ERROR;                /* オープン中でない */
     }
     else {
         ;   /* do nothing */
     }
 
-err_end1:
-    /* Quadモード解除 */
-    FlexSPI_SetResetQuadModeSequence(l_tDrvInfo.tpFlexSPIReg);                  /* LUT設定 */
-    iRet2 = FlexSPI_ExecCommand(l_tDrvInfo.tpFlexSPIReg, 0, 0);                 /* コマンド実行 */
-    if (iRet2 != FLEXSPI_E_SUCCESS) {
-        iRet = FROM_READ_ERROR;
-        goto err_end;
+    /* セマフォ取得(書き込み・消去と排他し、世代を確定させる) */
+    _FROM_LockDev(ptDev, FROM_LOCK_EXCL, 0U, 0U);
+
+    ulAhb = FROM_GetAhbAddress(ulDev);
+    if ((ulAhb == 0U) || (ptDev->ulPgmErs != 0U)) {
+        iRet = FROM_STATE_ERROR;                /* AHB窓に配置されていない、または内容が不定 */
     }
     else {
+        /* AHB読み出しシーケンスは拡張SPIモードで送信するため、Quadモードを解除しておく */
+        wai_sem(l_tDrvInfo.tBusSemID);
+        iRet = _FROM_SetIoMode(ptDev, FROM_IO_MODE_SPI);
+        sig_sem(l_tDrvInfo.tBusSemID);
+        iRet = (iRet == FLEXSPI_E_SUCCESS) ? FROM_SUCCESS : FROM_READ_ERROR;
+    }
+
+    if (iRet == FROM_SUCCESS) {
+        ptView->pucData      = (const unsigned char*)(ulAhb + uiAddress);
+        ptView->ulLength     = uiLength;
+        ptView->ulDev        = ulDev;
+        ptView->ulAddress    = uiAddress;
+        ptView->ulGeneration = l_tDrvInfo.ulGenSeq;
         iRet = FROM_SUCCESS;
     }
-   
-err_end:
+
+    /* セマフォ解放 */
+    sig_sem(ptDev->tSemID);
+
     return iRet;
 }
 
 /************************************************************************************************/
-/* FUNCTION   : _FROM_SectorEraseCore                                                           */
+/* FUNCTION   : FROM_IsViewValid                                                                */
 /*                                                                                              */
-/* DESCRIPTION: セクタ消去処理                                                                  */
+/* DESCRIPTION: 読み出しビュー有効判定                                                          */
+/*              取得後に対象範囲への書き込み・消去、またはAHB窓の構成変更がなければ有効         */
 /*----------------------------------------------------------------------------------------------*/
-/* INPUT      : uiAddress                       消去を開始するアドレス                          */
-/*            : uiLength                        消去するバイト数                                */
+/* INPUT      : ptView                          読み出しビュー                                  */
 /*                                                                                              */
 /* OUTPUT     : none                            なし                                            */
 /*                                                                                              */
-/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
-/*            : FROM_ERASE_ERROR                消去エラー                                      */
+/* RESULTS    : 1                               有効(参照したデータは正しい)                    */
+/*              0                               無効(FROM_ReadPtrで取得し直すこと)              */
 /*                                                                                              */
 /************************************************************************************************/
-LOCAL int _FROM_SectorEraseCore(unsigned int uiAddress, unsigned int uiLength)
+int FROM_IsViewValid(const FROM_View *ptView)
 {
-FLGPTN tFlgPtn         = 0;
-int iRet               = FROM_ERASE_ERROR;
-uint32_t i             = 0;
-unsigned char ucStatus = 0x00;
+const FROM_DevInfo *ptDev = NULL;
+uint32_t ulRegion         = 0;
+uint32_t ulFirst          = 0;
+uint32_t ulLast           = 0;
+uint32_t i                = 0;
 
-    /* 書き込み許可 */
-    FlexSPI_SetWriteEnableSequence(l_tDrvInfo.tpFlexSPIReg);    /* LUT設定 */
-    iRet = FlexSPI_ExecCommand(l_tDrvInfo.tpFlexSPIReg, 0, 0);  /* コマンド実行 */
-    if (iRet != FLEXSPI_E_SUCCESS) {
-        iRet = FROM_ERASE_ERROR;
-        goto err_end;
+    /* パラメータチェック */
+    if ((ptView == NULL) || (FROM_DEV_NUM <= ptView->ulDev)) {
+        return 0;
     }
     else {
-        ;   /* do nothing */
+        ptDev = &l_tDrvInfo.tDev[ptView->ulDev];
     }
 
-    /* セクタ消去 */
-    FlexSPI_SetErase4KBSectorSequence(l_tDrvInfo.tpFlexSPIReg);                 /* LUT設定 */
-    iRet = FlexSPI_ExecCommand(l_tDrvInfo.tpFlexSPIReg, uiAddress, uiLength);   /* コマンド実行 */
-    if (iRet != FLEXSPI_E_SUCCESS) {
-        iRet = FROM_ERASE_ERROR;
-        goto err_end;
+    /* 参照した範囲の領域 */
+    ulRegion = ptDev->ulSize / FROM_GEN_REGION_NUM;
+    ulFirst  = ptView->ulAddress / ulRegion;
+    ulLast   = (ptView->ulLength == 0U) ? ulFirst : ((ptView->ulAddress + ptView->ulLength - 1U) / ulRegion);
+    if (FROM_GEN_REGION_NUM <= ulLast) {
+        return 0;
     }
     else {
         ;   /* do nothing */
     }
 
-    /* 消去完了待ち */
-    FlexSPI_SetReadStatusSequence(l_tDrvInfo.tpFlexSPIReg);                     /* LUT設定 */
-    for (i = 0; i < 1000U; i++) {
-        /* ステータス読み出し */
-        ucStatus = FlexSPI_ExecCommandAndRead(l_tDrvInfo.tpFlexSPIReg, 0, 0x40001);
-        if (ucStatus == 0xFF) {
-            iRet = FROM_ERASE_ERROR;
-            goto err_end;
+    /* 取得後に更新された領域があれば無効(世代の差で比較し、一周しても判定できるようにする) */
+    for (i = ulFirst; i <= ulLast; i++) {
+        if ((int32_t)(ptDev->ulGen[i] - ptView->ulGeneration) > 0) {
+            return 0;
         }
         else {
             ;   /* do nothing */
         }
+    }
 
-        /* ステータスチェック(b0:write in progress ビットが'0'なら完了) */
-        if ((ucStatus & 0x01) == 0) {
+    return 1;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_SetIoMode                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: I/Oモードポリシー設定(全デバイス共通、次回のオープンから有効)                   */
+/*              FROM_IO_MODE_SPIは拡張SPIモードのまま1-4-4で読み出し、モード切り替えを行わない  */
+/*              FROM_IO_MODE_QPIは最初のIP読み出しでQuadモードへ移行し、拡張SPIモードが必要な   */
+/*              コマンド(書き込み・消去・AHB読み出し等)の前にのみ解除する                       */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulMode                          FROM_IO_MODE_*                                  */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                オープン中のデバイスがある                      */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_SetIoMode(uint32_t ulMode)
+{
+int iRet = FROM_STATE_ERROR;
+
+    /* パラメータチェック */
+    if ((ulMode != FROM_IO_MODE_SPI) && (ulMode != FROM_IO_MODE_QPI)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* セマフォ取得 */
+    wai_sem(l_tDrvInfo.tCtrlSemID);
+
+    /* 動作状態チェック(デバイスのI/Oモードはオープン時に拡張SPIから開始する) */
+    if (l_tDrvInfo.ulOpenMask != 0U) {
+        iRet = FROM_STATE_ERROR;
+    }
+    else {
+        l_tDrvInfo.ulIoPolicy = ulMode;
+        iRet = FROM_SUCCESS;
+    }
+
+    /* セマフォ解放 */
+    sig_sem(l_tDrvInfo.tCtrlSemID);
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_SetReadMode                                                                */
+/*                                                                                              */
+/* DESCRIPTION: 読み出し方式設定(全デバイス共通)                                                */
+/*              FROM_READ_MODE_AHBではAHB窓から複写し、                                         */
+/*              書き込み・消去中のデバイスのみIPコマンドで読み出す                              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulMode                          FROM_READ_MODE_IP / FROM_READ_MODE_AHB          */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_SetReadMode(uint32_t ulMode)
+{
+    /* パラメータチェック */
+    if ((ulMode != FROM_READ_MODE_IP) && (ulMode != FROM_READ_MODE_AHB)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 読み出し中の方式は変えないよう、全デバイスの入出力完了を待つ */
+    wai_sem(l_tDrvInfo.tCtrlSemID);
+    _FROM_LockAllDev();
+
+    l_tDrvInfo.ulReadMode = ulMode;
+
+    _FROM_UnlockAllDev();
+    sig_sem(l_tDrvInfo.tCtrlSemID);
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_SetTimeHook                                                                */
+/*                                                                                              */
+/* DESCRIPTION: 時刻取得関数登録(完了待ち時間の計測に使用)                                      */
+/*              未登録時はシステム時刻(ミリ秒単位)で計測する                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pfnGetTime                      時刻取得関数(NULLで登録解除)                    */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_SetTimeHook(FROM_GetTimeFunc pfnGetTime)
+{
+    l_tDrvInfo.pfnGetTime = pfnGetTime;
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_GetWaitStats                                                               */
+/*                                                                                              */
+/* DESCRIPTION: 完了待ち統計取得                                                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulOp                            完了待ち種別(FROM_WAIT_OP_*)                    */
+/*                                                                                              */
+/* OUTPUT     : ptStats                         完了待ち統計                                    */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_GetWaitStats(uint32_t ulOp, FROM_WaitStats *ptStats)
+{
+    /* パラメータチェック */
+    if ((ulOp >= FROM_WAIT_OP_NUM) || (ptStats == NULL)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    loc_cpu();
+    *ptStats = l_tDrvInfo.tWaitStats[ulOp];
+    unl_cpu();
+
+    /* 未計測の場合はデータシート標準値を予測完了時間とする */
+    if (ptStats->ulCount == 0U) {
+        ptStats->ulPredUs = l_tWaitProfile[ulOp].ulTypUs;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_ClearWaitStats                                                             */
+/*                                                                                              */
+/* DESCRIPTION: 完了待ち統計クリア(予測完了時間もデータシート標準値に戻る)                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                            なし                                            */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : none                            なし                                            */
+/*                                                                                              */
+/************************************************************************************************/
+void FROM_ClearWaitStats(void)
+{
+    loc_cpu();
+    memset(l_tDrvInfo.tWaitStats, 0, sizeof(l_tDrvInfo.tWaitStats));
+    unl_cpu();
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_Write                                                                      */
+/*                                                                                              */
+/* DESCRIPTION: 書き込み(FROM_DEV_0)                                                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : uiAddress                       書き込みを開始するアドレス                      */
+/*            : uiLength                        書き込みデータ長                                */
+/*            : strWriteData                    書き込みデータ                                  */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*            : FROM_WRITE_ERROR                書き込みエラー                                  */
+/*            : FROM_WRITE_ENABLE_ERROR         書き込み失敗                                    */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_Write(unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData)
+{
+    return FROM_WriteDev(FROM_DEV_0, uiAddress, uiLength, strWriteData);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_WriteDev                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: 書き込み(デバイス指定)                                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(FROM_DEV_*)                        */
+/*            : uiAddress                       書き込みを開始するアドレス                      */
+/*            : uiLength                        書き込みデータ長                                */
+/*            : strWriteData                    書き込みデータ                                  */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*            : FROM_WRITE_ERROR                書き込みエラー                                  */
+/*            : FROM_WRITE_ENABLE_ERROR         書き込み失敗                                    */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_WriteDev(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData)
+{
+FROM_DevInfo *ptDev     = NULL;
+FROM_SplitConfig tSplit = { 0 };
+int iRet                = FROM_WRITE_ERROR;
+
+    /* パラメータチェック */
+    if (FROM_DEV_NUM <= ulDev) {
+        iRet = FROM_WRITE_ERROR;    /* デバイス番号範囲外 */
+        goto err_end;
+    }
+    else {
+        ptDev = &l_tDrvInfo.tDev[ulDev];
+    }
+
+    if (ptDev->ulSize <= uiAddress) {
+        iRet = FROM_WRITE_ERROR;    /* 書き込み開始アドレスが範囲外 */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (ptDev->ulSize < (uiAddress + uiLength)) {
+        iRet = FROM_WRITE_ERROR;    /* 書き込みサイズが範囲外 */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (strWriteData == NULL) {
+        iRet = FROM_WRITE_ERROR;    /* 書き込みデータ未設定 */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック(入出力中は完了、または消去の中断を待つ) */
+    if ((ptDev->ulState != FROM_OPEN_STATE) && (ptDev->ulState != FROM_BUSY_STATE)) {
+        iRet = FROM_WRITE_ERROR;    /* オープン中でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothng */
+    }
+
+    /* セマフォ取得(消去完了待ち中のデバイスは消去を中断させる) */
+    _FROM_LockDev(ptDev, FROM_LOCK_IO, uiAddress, uiLength);
+
+    /* 動作状態再チェック(排他待ちの間にクローズされた、またはパラレルモードのFROM_DEV_1) */
+    if (ptDev->ulState != FROM_OPEN_STATE) {
+        sig_sem(ptDev->tSemID);
+        iRet = FROM_WRITE_ERROR;    /* オープン中でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothng */
+    }
+
+    /* 動作状態更新 */
+    ptDev->ulState = FROM_BUSY_STATE;   /* 入出力中 */
+
+    /* 書き込み・消去開始(完了までAHB窓は使用しない) */
+    _FROM_BeginPgmErs(ptDev, uiAddress, uiLength);
+
+    /* 書き込み処理(ページ境界・インターリーブ単位・TX FIFO容量で分割する) */
+    tSplit.ulDev      = ulDev;
+    tSplit.ulPageSize = ptDev->ulPageSize;
+    tSplit.ulWidth    = ptDev->ulWidth;
+    tSplit.ulChunkMax = FLEXSPI_TX_BUFFER_SIZE;
+    tSplit.pfnWrite   = _FROM_WritePage;
+    iRet = FROM_SplitWrite(&tSplit, uiAddress, uiLength, strWriteData);
+    if (iRet != FROM_SUCCESS) {
+        iRet = FROM_WRITE_ERROR;        /* 書き込みエラー */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 書き込み・消去終了(書き込み範囲のAHB読み出しデータをまとめて破棄) */
+    _FROM_EndPgmErs(ptDev, uiAddress, uiLength, iRet);
+
+    /* 動作状態更新 */
+    ptDev->ulState = FROM_OPEN_STATE;   /* オープン中 */
+
+    /* セマフォ解放 */
+    sig_sem(ptDev->tSemID);
+
+err_end:
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_Read                                                                       */
+/*                                                                                              */
+/* DESCRIPTION: 読み出し(FROM_DEV_0)                                                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : uiAddress                       読みだしを開始するアドレス                      */
+/*            : uiLength                        読み出しデータ長                                */
+/*            : strReadData                     読み出しデータバッファ                          */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*            : FROM_READ_ERROR                 読み出しエラー                                  */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_Read(unsigned int uiAddress, unsigned int uiLength, unsigned char *strReadData)
+{
+    return FROM_ReadDev(FROM_DEV_0, uiAddress, uiLength, strReadData);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_ReadDev                                                                    */
+/*                                                                                              */
+/* DESCRIPTION: 読み出し(デバイス指定)                                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(FROM_DEV_*)                        */
+/*            : uiAddress                       読みだしを開始するアドレス                      */
+/*            : uiLength                        読み出しデータ長                                */
+/*            : strReadData                     読み出しデータバッファ                          */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*            : FROM_READ_ERROR                 読み出しエラー                                  */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_ReadDev(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strReadData)
+{
+FROM_DevInfo *ptDev                         = NULL;
+int iRet                                    = FROM_READ_ERROR;
+uint32_t ulSize                             = 0;
+uint32_t ulHead                             = 0;
+unsigned char ucPad[FLEXSPI_PARALLEL_WIDTH] = { 0 };
+
+    /* パラメータチェック */
+    if (FROM_DEV_NUM <= ulDev) {
+        iRet = FROM_READ_ERROR;    /* デバイス番号範囲外 */
+        goto err_end;
+    }
+    else {
+        ptDev = &l_tDrvInfo.tDev[ulDev];
+    }
+
+    if (ptDev->ulSize <= uiAddress) {
+        iRet = FROM_READ_ERROR;     /* 読み出し開始アドレスが範囲外 */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (ptDev->ulSize < (uiAddress + uiLength)) {
+        iRet = FROM_READ_ERROR;     /* 読み出しサイズが範囲外 */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (strReadData == NULL) {
+        iRet = FROM_READ_ERROR;     /* 読み出しバッファ未設定 */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック(入出力中は完了、または消去の中断を待つ) */
+    if ((ptDev->ulState != FROM_OPEN_STATE) && (ptDev->ulState != FROM_BUSY_STATE)) {
+        iRet = FROM_READ_ERROR;     /* オープン中でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothng */
+    }
+
+    /* セマフォ取得(消去完了待ち中のデバイスは消去を中断させる) */
+    _FROM_LockDev(ptDev, FROM_LOCK_IO, uiAddress, uiLength);
+
+    /* 動作状態再チェック(排他待ちの間にクローズされた、またはパラレルモードのFROM_DEV_1) */
+    if (ptDev->ulState != FROM_OPEN_STATE) {
+        sig_sem(ptDev->tSemID);
+        iRet = FROM_READ_ERROR;     /* オープン中でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothng */
+    }
+
+    /* 動作状態更新 */
+    ptDev->ulState = FROM_BUSY_STATE;
+
+    /* メモリマップド読み出し(書き込み・消去中はIPコマンドで読み出す) */
+    if ((_FROM_IsMapped(ulDev) != 0) && (ptDev->ulPgmErs == 0U)) {
+        wai_sem(l_tDrvInfo.tBusSemID);
+        iRet = _FROM_SetIoMode(ptDev, FROM_IO_MODE_SPI);  /* AHB読み出しシーケンスは拡張SPIモード */
+        if (iRet == FLEXSPI_E_SUCCESS) {
+            iRet = FlexSPI_ReadAHB(l_tDrvInfo.tpFlexSPIReg,
+                                   FlexSPI_GetDeviceBase(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect) + uiAddress,
+                                   strReadData, uiLength);
+        }
+        else {
+            ;   /* do nothing */
+        }
+        sig_sem(l_tDrvInfo.tBusSemID);
+        iRet = (iRet == FLEXSPI_E_SUCCESS) ? FROM_SUCCESS : FROM_READ_ERROR;
+        goto err_end1;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 読み出し処理 */
+    while (0 < uiLength) {
+        ulHead = uiAddress % ptDev->ulWidth;
+        if ((ulHead != 0U) || (uiLength < ptDev->ulWidth)) {
+            /* インターリーブ単位に満たない端数は単位ごと読み出して切り出す */
+            ulSize = ptDev->ulWidth - ulHead;
+            ulSize = (uiLength < ulSize) ? uiLength : ulSize;
+            iRet = _FROM_ReadCore(ptDev, uiAddress - ulHead, ptDev->ulWidth, ucPad);
+            if (iRet == FROM_SUCCESS) {
+                memcpy(strReadData, &ucPad[ulHead], ulSize);
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        else {
+            /* １回の読み出しサイズ設定(1コマンドで読み出せる最大長、インターリーブ単位の倍数) */
+            ulSize = (FLEXSPI_STREAM_DATA_MAX < uiLength) ? FLEXSPI_STREAM_DATA_MAX : uiLength;
+            ulSize -= ulSize % ptDev->ulWidth;
+            /* 読み出し処理 */
+            iRet = _FROM_ReadCore(ptDev, uiAddress, ulSize, strReadData);
+        }
+        if (iRet != FROM_SUCCESS) {
+            iRet = FROM_READ_ERROR; /* 読み出しエラー */
+            goto err_end1;
+        }
+        else {
+            /* 残読み出し長・アドレス更新 */
+            strReadData += ulSize;
+            uiAddress   += ulSize;
+            uiLength    -= ulSize;
+        }
+    }
+
+err_end1:
+    /* 動作状態更新 */
+    ptDev->ulState = FROM_OPEN_STATE;   /* オープン中 */
+
+    /* セマフォ解放 */
+    sig_sem(ptDev->tSemID);
+
+err_end:
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_SectorErase                                                                */
+/*                                                                                              */
+/* DESCRIPTION: セクタ消去(FROM_DEV_0)                                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : uiAddress                       消去を開始するアドレス                          */
+/*            : uiLength                        消去するバイト数                                */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*            : FROM_ERASE_ERROR                消去エラー                                      */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_SectorErase(unsigned int uiAddress, unsigned int uiLength)
+{
+    return FROM_SectorEraseDev(FROM_DEV_0, uiAddress, uiLength);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_SectorEraseDev                                                             */
+/*                                                                                              */
+/* DESCRIPTION: セクタ消去(デバイス指定)                                                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(FROM_DEV_*)                        */
+/*            : uiAddress                       消去を開始するアドレス                          */
+/*            : uiLength                        消去するバイト数                                */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*            : FROM_ERASE_ERROR                消去エラー                                      */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_SectorEraseDev(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength)
+{
+FROM_DevInfo *ptDev = NULL;
+int iRet            = FROM_ERASE_ERROR;
+
+    /* パラメータチェック */
+    if (FROM_DEV_NUM <= ulDev) {
+        iRet = FROM_ERASE_ERROR;    /* デバイス番号範囲外 */
+        goto err_end;
+    }
+    else {
+        ptDev = &l_tDrvInfo.tDev[ulDev];
+    }
+
+    if (ptDev->ulSize <= uiAddress) {
+        iRet = FROM_ERASE_ERROR;    /* 消去開始アドレスが範囲を超えている */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if ((uiAddress % ptDev->ulSectSize) != 0) {
+        iRet = FROM_ERASE_ERROR;    /* 消去開始アドレスがセクタ境界でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (ptDev->ulSize < (uiAddress + uiLength)) {
+        iRet = FROM_ERASE_ERROR;    /* 消去バイト数が範囲を超えている */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if ((uiLength % ptDev->ulSectSize) != 0) {
+        iRet = FROM_ERASE_ERROR;    /* 消去バイト数がセクタ境界でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック(入出力中は完了を待つ) */
+    if ((ptDev->ulState != FROM_OPEN_STATE) && (ptDev->ulState != FROM_BUSY_STATE)) {
+        iRet = FROM_ERASE_ERROR;    /* オープン状態でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* セマフォ取得 */
+    _FROM_LockDev(ptDev, FROM_LOCK_EXCL, 0U, 0U);
+
+    /* 動作状態再チェック(排他待ちの間にクローズされた、またはパラレルモードのFROM_DEV_1) */
+    if (ptDev->ulState != FROM_OPEN_STATE) {
+        sig_sem(ptDev->tSemID);
+        iRet = FROM_ERASE_ERROR;    /* オープン状態でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態更新 */
+    ptDev->ulState = FROM_BUSY_STATE;
+
+    /* 消去処理(境界が揃う範囲はより大きな消去単位で消去する) */
+    iRet = _FROM_EraseRange(ptDev, uiAddress, uiLength);
+
+    /* 動作状態更新 */
+    ptDev->ulState = FROM_OPEN_STATE;
+
+    /* セマフォ解放 */
+    sig_sem(ptDev->tSemID);
+
+err_end:
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_BlockErase                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: ブロック消去(FROM_DEV_0)                                                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : uiAddress                       消去を開始するアドレス                          */
+/*            : uiLength                        消去するバイト数                                */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*            : FROM_ERASE_ERROR                消去エラー                                      */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_BlockErase(unsigned int uiAddress, unsigned int uiLength)
+{
+    return FROM_BlockEraseDev(FROM_DEV_0, uiAddress, uiLength);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_BlockEraseDev                                                              */
+/*                                                                                              */
+/* DESCRIPTION: ブロック消去(デバイス指定)                                                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(FROM_DEV_*)                        */
+/*            : uiAddress                       消去を開始するアドレス                          */
+/*            : uiLength                        消去するバイト数                                */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*            : FROM_ERASE_ERROR                消去エラー                                      */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_BlockEraseDev(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength)
+{
+FROM_DevInfo *ptDev = NULL;
+int iRet            = FROM_ERASE_ERROR;
+
+    /* パラメータチェック */
+    if (FROM_DEV_NUM <= ulDev) {
+        iRet = FROM_ERASE_ERROR;    /* デバイス番号範囲外 */
+        goto err_end;
+    }
+    else {
+        ptDev = &l_tDrvInfo.tDev[ulDev];
+    }
+
+    if (ptDev->ulSize <= uiAddress) {
+        iRet = FROM_ERASE_ERROR;    /* 消去開始アドレスが範囲を超えている */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if ((uiAddress % ptDev->ulBlkSize) != 0) {
+        iRet = FROM_ERASE_ERROR;    /* 消去開始アドレスがブロック境界でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (ptDev->ulSize < (uiAddress + uiLength)) {
+        iRet = FROM_ERASE_ERROR;    /* 消去バイト数が範囲を超えている */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if ((uiLength % ptDev->ulBlkSize) != 0) {
+        iRet = FROM_ERASE_ERROR;    /* 消去バイト数がブロック境界でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック(入出力中は完了を待つ) */
+    if ((ptDev->ulState != FROM_OPEN_STATE) && (ptDev->ulState != FROM_BUSY_STATE)) {
+        iRet = FROM_ERASE_ERROR;    /* オープン状態でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* セマフォ取得 */
+    _FROM_LockDev(ptDev, FROM_LOCK_EXCL, 0U, 0U);
+
+    /* 動作状態再チェック(排他待ちの間にクローズされた、またはパラレルモードのFROM_DEV_1) */
+    if (ptDev->ulState != FROM_OPEN_STATE) {
+        sig_sem(ptDev->tSemID);
+        iRet = FROM_ERASE_ERROR;    /* オープン状態でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態更新 */
+    ptDev->ulState = FROM_BUSY_STATE;
+
+    /* 消去処理(デバイス全体の場合はチップ消去) */
+    iRet = _FROM_EraseRange(ptDev, uiAddress, uiLength);
+
+    /* 動作状態更新 */
+    ptDev->ulState = FROM_OPEN_STATE;
+
+    /* セマフォ解放 */
+    sig_sem(ptDev->tSemID);
+
+err_end:
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_Erase                                                                      */
+/*                                                                                              */
+/* DESCRIPTION: 消去(FROM_DEV_0、4KB/32KB/64KB/チップ消去を組み合わせる)                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : uiAddress                       消去を開始するアドレス(セクタ境界)              */
+/*            : uiLength                        消去するバイト数(セクタ単位)                    */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_Erase(unsigned int uiAddress, unsigned int uiLength)
+{
+    return FROM_EraseDev(FROM_DEV_0, uiAddress, uiLength);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_EraseDev                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: 消去(デバイス指定)                                                              */
+/*              範囲を覆う最少の消去コマンド列(4KB/32KB/64KB/チップ消去)で消去する              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(FROM_DEV_*)                        */
+/*            : uiAddress                       消去を開始するアドレス(セクタ境界)              */
+/*            : uiLength                        消去するバイト数(セクタ単位)                    */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_EraseDev(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength)
+{
+FROM_DevInfo *ptDev = NULL;
+int iRet            = FROM_ERASE_ERROR;
+
+    /* パラメータチェック */
+    if (FROM_DEV_NUM <= ulDev) {
+        iRet = FROM_ERASE_ERROR;    /* デバイス番号範囲外 */
+        goto err_end;
+    }
+    else {
+        ptDev = &l_tDrvInfo.tDev[ulDev];
+    }
+
+    if (ptDev->ulSize <= uiAddress) {
+        iRet = FROM_ERASE_ERROR;    /* 消去開始アドレスが範囲を超えている */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if ((uiAddress % ptDev->ulSectSize) != 0) {
+        iRet = FROM_ERASE_ERROR;    /* 消去開始アドレスがセクタ境界でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (ptDev->ulSize < (uiAddress + uiLength)) {
+        iRet = FROM_ERASE_ERROR;    /* 消去バイト数が範囲を超えている */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if ((uiLength % ptDev->ulSectSize) != 0) {
+        iRet = FROM_ERASE_ERROR;    /* 消去バイト数がセクタ境界でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック(入出力中は完了を待つ) */
+    if ((ptDev->ulState != FROM_OPEN_STATE) && (ptDev->ulState != FROM_BUSY_STATE)) {
+        iRet = FROM_ERASE_ERROR;    /* オープン状態でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* セマフォ取得 */
+    _FROM_LockDev(ptDev, FROM_LOCK_EXCL, 0U, 0U);
+
+    /* 動作状態再チェック(排他待ちの間にクローズされた、またはパラレルモードのFROM_DEV_1) */
+    if (ptDev->ulState != FROM_OPEN_STATE) {
+        sig_sem(ptDev->tSemID);
+        iRet = FROM_ERASE_ERROR;    /* オープン状態でない */
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態更新 */
+    ptDev->ulState = FROM_BUSY_STATE;
+
+    /* 消去処理(アドレス境界・残サイズに収まる最大の消去単位を順に選択する) */
+    iRet = _FROM_EraseRange(ptDev, uiAddress, uiLength);
+
+    /* 動作状態更新 */
+    ptDev->ulState = FROM_OPEN_STATE;
+
+    /* セマフォ解放 */
+    sig_sem(ptDev->tSemID);
+
+err_end:
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_getState                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: NORドライバ動作状態取得                                                         */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                            なし                                            */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_STATUS                     NORドライバ動作状態                             */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_getState(void)
+{
+    return FROM_getStateDev(FROM_DEV_0);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_getStateDev                                                                */
+/*                                                                                              */
+/* DESCRIPTION: NORドライバ動作状態取得(デバイス指定)                                           */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(FROM_DEV_*)                        */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_STATUS                     NORドライバ動作状態                             */
+/*                                               (デバイス番号範囲外はFROM_NONE_STATE)          */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_getStateDev(uint32_t ulDev)
+{
+    if (FROM_DEV_NUM <= ulDev) {
+        return FROM_NONE_STATE;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return l_tDrvInfo.tDev[ulDev].ulState;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_GetAhbAddress                                                              */
+/*                                                                                              */
+/* DESCRIPTION: AHB窓の先頭アドレス取得                                                         */
+/*              デバイスの先頭はオープン済みデバイスのサイズで決まるため、                      */
+/*              オープン・クローズ後に再取得すること                                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(FROM_DEV_*)                        */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : アドレス                            AHB窓の先頭アドレス(未オープン時は0)        */
+/*                                                                                              */
+/************************************************************************************************/
+uint32_t FROM_GetAhbAddress(uint32_t ulDev)
+{
+    if ((FROM_DEV_NUM <= ulDev) ||
+        ((l_tDrvInfo.ulOpenMask & (1UL << ulDev)) == 0U) ||
+        ((l_tDrvInfo.ulParallel != FROM_PARALLEL_OFF) && (ulDev != FROM_DEV_0))) {
+        return 0;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return FLEXSPI_AMBA_BASE + FlexSPI_GetDeviceBase(l_tDrvInfo.tpFlexSPIReg, l_tDrvInfo.tDev[ulDev].iChipSelect);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_GetSectSize                                                                */
+/*                                                                                              */
+/* DESCRIPTION: セクタサイズ取得(消去の最小単位)                                                */
+/*              SFDPの解析結果とパラレルモードで決まるため、オープン後に再取得すること          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(FROM_DEV_*)                        */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : サイズ                          セクタサイズ(未オープン時は0)                   */
+/*                                                                                              */
+/************************************************************************************************/
+uint32_t FROM_GetSectSize(uint32_t ulDev)
+{
+    if ((FROM_DEV_NUM <= ulDev) ||
+        ((l_tDrvInfo.ulOpenMask & (1UL << ulDev)) == 0U) ||
+        ((l_tDrvInfo.ulParallel != FROM_PARALLEL_OFF) && (ulDev != FROM_DEV_0))) {
+        return 0;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return l_tDrvInfo.tDev[ulDev].ulSectSize;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_GetSfdpInfo                                                                */
+/*                                                                                              */
+/* DESCRIPTION: SFDP解析結果取得                                                                */
+/*              最初にオープンしたデバイスから読み出した構成(全デバイスに適用中)                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                            なし                                            */
+/*                                                                                              */
+/* OUTPUT     : ptInfo                          SFDP解析結果                                    */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                SFDPから取得していない                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_GetSfdpInfo(FROM_SfdpInfo *ptInfo)
+{
+int iRet = FROM_STATE_ERROR;
+
+    /* パラメータチェック */
+    if (ptInfo == NULL) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* セマフォ取得(オープン中の更新と排他) */
+    wai_sem(l_tDrvInfo.tCtrlSemID);
+
+    if (l_tDrvInfo.tPart.ulSfdp != 0U) {
+        *ptInfo = l_tDrvInfo.tSfdp;
+        iRet    = FROM_SUCCESS;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* セマフォ解放 */
+    sig_sem(l_tDrvInfo.tCtrlSemID);
+
+    return iRet;
+}
+
+/****************************************************************************/
+/*  ローカル関数                                                            */
+/****************************************************************************/
+/************************************************************************************************/
+/* FUNCTION   : _FROM_WriteCore                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: 書き込み処理                                                                    */
+/*              呼び出し元で_FROM_BeginPgmErs・_FROM_EndPgmErsにより書き込み範囲を囲むこと      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : uiAddress                       書き込みを開始するアドレス(デバイス内)          */
+/*            : uiLength                        書き込みデータ長                                */
+/*            : strWriteData                    書き込みデータ                                  */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_WRITE_ENABLE_ERROR         書き込み失敗                                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_WriteCore(FROM_DevInfo *ptDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData)
+{
+int iRet        = FROM_WRITE_ERROR;
+uint32_t ulBase = FlexSPI_GetDeviceBase(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect);
+
+    /* バス取得 */
+    wai_sem(l_tDrvInfo.tBusSemID);
+
+    /* I/Oモード設定(書き込み・消去コマンドは拡張SPIモードで送信する) */
+    iRet = _FROM_SetIoMode(ptDev, FROM_IO_MODE_SPI);
+
+    /* 書き込み許可 */
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        iRet = FlexSPI_ExecSequence(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_WRITE_ENABLE, ulBase, 0);  /* コマンド実行 */
+    }
+    else {
+        ;   /* do nothing */
+    }
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        iRet = FROM_WRITE_ENABLE_ERROR;
+        goto err_end1;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 書き込み */
+    iRet = FlexSPI_WriteSequence(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_QUAD_WRITE, strWriteData, ulBase + uiAddress, uiLength);
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        iRet = FROM_WRITE_ERROR;
+        goto err_end1;
+    }
+    else {
+        iRet = FROM_SUCCESS;
+    }
+
+err_end1:
+    /* バス解放(完了待ちの間は他デバイスへアクセスできる) */
+    sig_sem(l_tDrvInfo.tBusSemID);
+    if (iRet != FROM_SUCCESS) {
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 書き込み完了待ち(フラグステータス対応デバイスはb7:Program or erase controller ビットが'1'なら完了) */
+    /* (b7はステータスのb0:write in progressと同時に変化するため、ステータスは読み出さない) */
+    if (_FROM_WaitReady(ptDev, FROM_WAIT_OP_PROGRAM, l_tDrvInfo.tPart.ulReadySeq,
+                        l_tDrvInfo.tPart.ucReadyMask, l_tDrvInfo.tPart.ucReadyExpect) != FROM_SUCCESS) {
+        iRet = FROM_WRITE_ERROR;
+        goto err_end;
+    }
+    else {
+        iRet = FROM_SUCCESS;
+    }
+err_end:
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_WritePage                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: 1回の書き込み(FROM_SplitWriteの書き込み関数)                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号                                    */
+/*            : uiAddress                       書き込みを開始するアドレス(デバイス内)          */
+/*            : uiLength                        書き込みデータ長                                */
+/*            : strWriteData                    書き込みデータ                                  */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : _FROM_WriteCoreの戻り値                                                         */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_WritePage(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData)
+{
+    return _FROM_WriteCore(&l_tDrvInfo.tDev[ulDev], uiAddress, uiLength, strWriteData);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_ReadCore                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: 読み出し処理                                                                    */
+/*              1回のIPコマンドで読み出す(FLEXSPI_STREAM_DATA_MAX以下)                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : uiAddress                       読み出しを開始するアドレス(デバイス内)          */
+/*            : uiLength                        読み出しデータ長                                */
+/*                                                                                              */
+/* OUTPUT     : strReadData                     読み出しデータ格納バッファ                      */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_ReadCore(FROM_DevInfo *ptDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strReadData)
+{
+int iRet        = FROM_READ_ERROR;
+int iRet2       = FROM_READ_ERROR;
+uint32_t ulBase = FlexSPI_GetDeviceBase(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect);
+uint32_t ulSeq  = 0;
+
+    /* バス取得 */
+    wai_sem(l_tDrvInfo.tBusSemID);
+
+    /* I/Oモード設定(ポリシーと異なる場合のみ切り替え、以降の読み出しはモードを維持する) */
+    /* (Quadモード非対応のデバイスは拡張SPIモードのまま) */
+    iRet2 = _FROM_SetIoMode(ptDev, (l_tDrvInfo.tPart.ulQpi != 0U) ? l_tDrvInfo.ulIoPolicy : FROM_IO_MODE_SPI);
+    if (iRet2 != FLEXSPI_E_SUCCESS) {
+        iRet = FROM_READ_ERROR;
+        goto err_end;
+    }
+    else {
+        ulSeq = (ptDev->ulIoMode == FROM_IO_MODE_QPI) ? l_tDrvInfo.ulReadSeq : l_tDrvInfo.ulSpiReadSeq;
+    }
+
+    /* 読み出し(コマンド実行中にRX FIFOを取り出す) */
+    iRet2 = FlexSPI_ReadStream(l_tDrvInfo.tpFlexSPIReg, ulSeq, ulBase + uiAddress, strReadData, uiLength);
+    if (iRet2 != FLEXSPI_E_SUCCESS) {
+        iRet = FROM_READ_ERROR;
+    }
+    else {
+        iRet = FROM_SUCCESS;
+    }
+
+err_end:
+    /* バス解放 */
+    sig_sem(l_tDrvInfo.tBusSemID);
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_EraseRange                                                                */
+/*                                                                                              */
+/* DESCRIPTION: 範囲消去処理                                                                    */
+/*              アドレス境界・残サイズに収まる最大の消去単位を順に選択して消去する              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : uiAddress                       消去を開始するアドレス(デバイス内、セクタ境界)  */
+/*            : uiLength                        消去するバイト数(セクタ単位)                    */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_EraseRange(FROM_DevInfo *ptDev, unsigned int uiAddress, unsigned int uiLength)
+{
+unsigned int uiStart = uiAddress;
+unsigned int uiTotal = uiLength;
+uint32_t ulType      = FROM_ERASE_CHIP;
+uint32_t ulSize      = 0;
+int iRet             = FROM_SUCCESS;
+
+    /* 書き込み・消去開始(完了までAHB窓は使用しない) */
+    _FROM_BeginPgmErs(ptDev, uiStart, uiTotal);
+
+    while (0 < uiLength) {
+        /* 消去種別選択(デバイスが対応し、先頭が境界に揃い、残サイズ以下の最大の消去単位) */
+        ulType = FROM_ERASE_CHIP;
+        ulSize = l_tDrvInfo.tPart.ulEraseSize[ulType] * ptDev->ulWidth;
+        while ((ulType < FROM_ERASE_4KB) &&
+               ((ulSize == 0U) || ((uiAddress % ulSize) != 0U) || (uiLength < ulSize))) {
+            ulType++;
+            ulSize = l_tDrvInfo.tPart.ulEraseSize[ulType] * ptDev->ulWidth;
+        }
+
+        /* 消去処理(チップ消去以外は完了待ち中に中断して読み出しを受け付ける、中断対応デバイスのみ) */
+        loc_cpu();
+        ptDev->ulSusAddr = uiAddress;
+        ptDev->ulResumed = 0U;
+        ptDev->ulSusLen  = ((ulType != FROM_ERASE_CHIP) && (l_tDrvInfo.tPart.ulSuspend != 0U)) ? ulSize : 0U;
+        unl_cpu();
+        iRet = _FROM_EraseCore(ptDev, ulType, uiAddress);
+        loc_cpu();
+        ptDev->ulSusLen  = 0U;
+        unl_cpu();
+        if (iRet != FROM_SUCCESS) {
+            iRet = FROM_ERASE_ERROR;    /* 消去エラー */
+            break;
+        }
+        else {
+            /* 消去するアドレス／残消去サイズ更新 */
+            uiAddress += ulSize;
+            uiLength  -= ulSize;
+        }
+    }
+
+    /* 書き込み・消去終了(消去範囲のAHB読み出しデータをまとめて破棄) */
+    _FROM_EndPgmErs(ptDev, uiStart, uiTotal, iRet);
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_EraseCore                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: 消去処理(1コマンド)                                                             */
+/*              呼び出し元で_FROM_BeginPgmErs・_FROM_EndPgmErsにより消去範囲を囲むこと          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : ulType                          消去種別(FROM_ERASE_*)                          */
+/*            : uiAddress                       消去を開始するアドレス(消去単位境界)            */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_EraseCore(FROM_DevInfo *ptDev, uint32_t ulType, unsigned int uiAddress)
+{
+const FROM_EraseType *ptType = &l_tEraseType[ulType];
+int iRet                     = FROM_ERASE_ERROR;
+uint32_t ulBase              = FlexSPI_GetDeviceBase(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect);
+
+    /* バス取得 */
+    wai_sem(l_tDrvInfo.tBusSemID);
+
+    /* I/Oモード設定(書き込み・消去コマンドは拡張SPIモードで送信する) */
+    iRet = _FROM_SetIoMode(ptDev, FROM_IO_MODE_SPI);
+
+    /* 書き込み許可 */
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        iRet = FlexSPI_ExecSequence(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_WRITE_ENABLE, ulBase, 0);  /* コマンド実行 */
+    }
+    else {
+        ;   /* do nothing */
+    }
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        /* 消去 */
+        iRet = FlexSPI_ExecSequence(l_tDrvInfo.tpFlexSPIReg, ptType->ulSeqId, ulBase + uiAddress, 0);    /* コマンド実行 */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* バス解放(完了待ちの間は他デバイスへアクセスできる) */
+    sig_sem(l_tDrvInfo.tBusSemID);
+
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        iRet = FROM_ERASE_ERROR;
+        goto err_end;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 消去完了待ち(書き込みと同じく、フラグステータス対応デバイスはb7:Program or erase controller ビットが'1'なら完了) */
+    if (_FROM_WaitReady(ptDev, ptType->ulOp, l_tDrvInfo.tPart.ulReadySeq,
+                        l_tDrvInfo.tPart.ucReadyMask, l_tDrvInfo.tPart.ucReadyExpect) != FROM_SUCCESS) {
+        iRet = FROM_ERASE_ERROR;
+        goto err_end;
+    }
+    else {
+        iRet = FROM_SUCCESS;
+    }
+err_end:
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_WaitReady                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: 消去・書き込み完了待ち                                                          */
+/*              予測完了時間の7/8を待ってからステータスポーリングを開始し、                     */
+/*              実測busy時間を統計に記録する                                                    */
+/*              中断可能な消去中は、読み書き要求があれば消去を中断して読み書きを先に実行する    */
+/*              タイムアウトは中断していた時間を除いたbusy時間で判定する                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : ulOp                            完了待ち種別(FROM_WAIT_OP_*)                    */
+/*            : ulSeqId                         ステータス読み出しシーケンス(FLEXSPI_SEQ_*)     */
+/*            : ucMask                          判定ビット                                      */
+/*            : ucExpect                        完了時の判定ビット値                            */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    完了                                            */
+/*              FROM_READ_ERROR                 ステータス読み出しエラー、またはタイムアウト    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_WaitReady(FROM_DevInfo *ptDev, uint32_t ulOp, uint32_t ulSeqId, unsigned char ucMask, unsigned char ucExpect)
+{
+FROM_WaitStats *ptStats = &l_tDrvInfo.tWaitStats[ulOp];
+uint32_t ulStart        = _FROM_GetTimeUs();
+uint32_t ulPred         = 0;
+uint32_t ulBusy         = 0;
+uint32_t ulPolls        = 0;
+uint32_t ulResult       = FROM_POLL_BUSY;
+uint32_t ulLimit        = l_tWaitProfile[ulOp].ulMaxUs * 2U;
+uint32_t ulSleep        = 0;
+uint32_t ulSusUs        = 0;
+TMO tSleep              = 0;
+
+    /* 1)予測完了時間の7/8を待つ(完了前のステータス読み出しでバスを占有しない) */
+    /*   (中断可能な消去中は読み書き要求で起床し、消去を中断して読み書きを先に実行する) */
+    ulPred  = (ptStats->ulCount != 0U) ? ptStats->ulPredUs : l_tWaitProfile[ulOp].ulTypUs;
+    ulSleep = ulPred - (ulPred / 8U);
+    while (((_FROM_GetTimeUs() - ulStart) + FROM_TICK_US) <= ulSleep) {
+        tSleep = (TMO)((ulSleep - (_FROM_GetTimeUs() - ulStart)) / FROM_TICK_US);
+        _FROM_Sleep(ptDev, tSleep);
+        if (_FROM_SuspendForIo(ptDev, ulOp, &ulSusUs) != FROM_SUCCESS) {
+            ulResult = FROM_POLL_ERROR;     /* 消去再開エラー */
             break;
         }
         else {
-            /* ウエイト */
-            twai_flg(l_tDrvInfo.tFlgID, FROM_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, 1);
+            ulStart += ulSusUs;             /* 中断していた時間はbusy時間に含めない */
+        }
+    }
+
+    /* 2)ステータスポーリング(割り込み内で連続読み出し、実行中のままなら1ティック待って再開) */
+    /*   (中断していた時間を除いたbusy時間が最大完了時間の2倍を超えたらタイムアウト) */
+    while (ulResult == FROM_POLL_BUSY) {
+        ulResult = _FROM_PollStatus(ptDev, ulSeqId, ucMask, ucExpect, &ulPolls);
+        if (ulResult != FROM_POLL_BUSY) {
+            break;
+        }
+        else if (ulLimit <= (_FROM_GetTimeUs() - ulStart)) {
+            break;                          /* タイムアウト */
+        }
+        else {
+            _FROM_Sleep(ptDev, 1);
+        }
+        if (_FROM_SuspendForIo(ptDev, ulOp, &ulSusUs) != FROM_SUCCESS) {
+            ulResult = FROM_POLL_ERROR;     /* 消去再開エラー */
+            break;
+        }
+        else {
+            ulStart += ulSusUs;             /* 中断していた時間はbusy時間に含めない */
+        }
+    }
+    ulBusy = _FROM_GetTimeUs() - ulStart;
+
+    /* 3)統計更新(予測完了時間は実測の移動平均(1/8)) */
+    loc_cpu();
+    ptStats->ulPolls += ulPolls;
+    if (ulResult == FROM_POLL_READY) {
+        if ((ptStats->ulCount == 0U) || (ulBusy < ptStats->ulMinUs)) {
+            ptStats->ulMinUs = ulBusy;
+        }
+        else {
+            ;   /* do nothing */
+        }
+        if (ulBusy > ptStats->ulMaxUs) {
+            ptStats->ulMaxUs = ulBusy;
+        }
+        else {
+            ;   /* do nothing */
+        }
+        ptStats->ulPredUs = ((ulPred * 7U) + ulBusy) / 8U;
+        ptStats->ulLastUs = ulBusy;
+        ptStats->ulCount++;
+    }
+    else if (ulResult == FROM_POLL_BUSY) {
+        ptStats->ulTimeouts++;
+    }
+    else {
+        ;   /* do nothing */
+    }
+    unl_cpu();
+
+    return (ulResult == FROM_POLL_READY) ? FROM_SUCCESS : FROM_READ_ERROR;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SuspendForIo                                                              */
+/*                                                                                              */
+/* DESCRIPTION: 消去中断・再開                                                                  */
+/*              中断可能な消去中に読み書き要求があれば、消去を中断してデバイスの排他を          */
+/*              一旦解放し、待ち行列の読み書きを実行させてから消去を再開する                    */
+/*              消去再開からFROM_SUS_INTERVAL_US経過するまでは中断しない                        */
+/*              (中断・再開を繰り返して消去が進まなくなることを防ぐ)                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : ulOp                            完了待ち種別(FROM_WAIT_OP_*)                    */
+/*                                                                                              */
+/* OUTPUT     : pulSusUs                        中断していた時間(マイクロ秒、中断しなければ0)   */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了(中断しなかった場合を含む)              */
+/*              FROM_ERASE_ERROR                消去再開エラー                                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_SuspendForIo(FROM_DevInfo *ptDev, uint32_t ulOp, uint32_t *pulSusUs)
+{
+FLGPTN tFlgPtn    = 0;
+uint32_t ulBase   = FlexSPI_GetDeviceBase(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect);
+uint32_t ulStart  = 0;
+uint32_t ulPolls  = 0;
+uint32_t ulResult = FROM_POLL_ERROR;
+uint32_t i        = 0;
+int iRet          = FLEXSPI_E_SUCCESS;
+
+    *pulSusUs = 0U;
+
+    /* 中断して実行できる読み書き要求がない、または消去再開直後であれば何もしない */
+    if ((_FROM_IsIoPending(ptDev) == 0) || (_FROM_GetSusHoldUs(ptDev) != 0U)) {
+        return FROM_SUCCESS;
+    }
+    else {
+        ulStart = _FROM_GetTimeUs();
+    }
+
+    /* 1)消去中断 */
+    wai_sem(l_tDrvInfo.tBusSemID);
+    iRet = _FROM_SetIoMode(ptDev, FROM_IO_MODE_SPI);
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        iRet = FlexSPI_ExecSequence(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_SUSPEND, ulBase, 0);    /* コマンド実行 */
+    }
+    else {
+        ;   /* do nothing */
+    }
+    sig_sem(l_tDrvInfo.tBusSemID);
+
+    /* 2)中断完了待ち(フラグステータス対応デバイスはb7:Program or erase controller ビットが'1'なら中断済み) */
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        for (i = 0; i < FROM_SUS_RETRY; i++) {
+            ulResult = _FROM_PollStatus(ptDev, l_tDrvInfo.tPart.ulReadySeq, l_tDrvInfo.tPart.ucReadyMask,
+                                        l_tDrvInfo.tPart.ucReadyExpect, &ulPolls);
+            if (ulResult != FROM_POLL_BUSY) {
+                break;
+            }
+            else {
+                twai_flg(ptDev->tFlgID, FROM_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, 1);
+            }
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 3)デバイスの排他を一旦解放し、待ち行列の後ろに並び直す(その間に読み書きを実行させる) */
+    if (ulResult == FROM_POLL_READY) {
+        ptDev->ulSuspended = 1U;
+        ptDev->ulState     = FROM_OPEN_STATE;
+        sig_sem(ptDev->tSemID);
+        wai_sem(ptDev->tSemID);
+        ptDev->ulState     = FROM_BUSY_STATE;
+        ptDev->ulSuspended = 0U;
+        ptDev->ulPgmErs    = 1U;    /* 中断中の書き込みが解除したAHB窓の使用停止を戻す */
+
+        loc_cpu();
+        l_tDrvInfo.tWaitStats[ulOp].ulSuspends++;
+        unl_cpu();
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 4)消去再開(中断を確認できなかった場合も指示する、読み出しでI/Oモードが変わっている場合がある) */
+    wai_sem(l_tDrvInfo.tBusSemID);
+    iRet = _FROM_SetIoMode(ptDev, FROM_IO_MODE_SPI);
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        iRet = FlexSPI_ExecSequence(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_RESUME, ulBase, 0);     /* コマンド実行 */
+    }
+    else {
+        ;   /* do nothing */
+    }
+    sig_sem(l_tDrvInfo.tBusSemID);
+
+    /* 消去再開時刻(次の中断はFROM_SUS_INTERVAL_US後から) */
+    ptDev->ulResumeUs = _FROM_GetTimeUs();
+    ptDev->ulResumed  = 1U;
+
+    *pulSusUs = ptDev->ulResumeUs - ulStart;
+
+    return (iRet == FLEXSPI_E_SUCCESS) ? FROM_SUCCESS : FROM_ERASE_ERROR;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_IsIoPending                                                               */
+/*                                                                                              */
+/* DESCRIPTION: 中断して実行できる読み書き要求の有無                                            */
+/*              (中断可能な消去中で、排他待ちの読み書き範囲が消去範囲と重ならない)              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : 1                               あり                                            */
+/*              0                               なし                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_IsIoPending(FROM_DevInfo *ptDev)
+{
+int iRet = 0;
+
+    loc_cpu();
+    if ((ptDev->ulSusLen != 0U) && (ptDev->ulSuspended == 0U) && (ptDev->ulIoReq != 0U) &&
+        ((ptDev->ulIoEnd <= ptDev->ulSusAddr) || ((ptDev->ulSusAddr + ptDev->ulSusLen) <= ptDev->ulIoAddr))) {
+        iRet = 1;
+    }
+    else {
+        ;   /* do nothing */
+    }
+    unl_cpu();
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_GetSusHoldUs                                                              */
+/*                                                                                              */
+/* DESCRIPTION: 消去中断までの待ち時間                                                          */
+/*              消去再開からFROM_SUS_INTERVAL_US経過するまでの残り時間を返す                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : 残り時間(マイクロ秒、0は中断可能)                                               */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_GetSusHoldUs(FROM_DevInfo *ptDev)
+{
+uint32_t ulElapsed = 0;
+
+    if (ptDev->ulResumed == 0U) {
+        return 0U;
+    }
+    else {
+        ulElapsed = _FROM_GetTimeUs() - ptDev->ulResumeUs;
+    }
+
+    return (ulElapsed < FROM_SUS_INTERVAL_US) ? (FROM_SUS_INTERVAL_US - ulElapsed) : 0U;
+}
+
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_Sleep                                                                     */
+/*                                                                                              */
+/* DESCRIPTION: 完了待ち中の時間待ち(中断可能な消去中は読み書き要求で起床する)                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : tSleep                          待ち時間(ティック)                              */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : none                            なし                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_Sleep(FROM_DevInfo *ptDev, TMO tSleep)
+{
+FLGPTN tFlgPtn  = 0;
+uint32_t ulHold = 0;
+TMO tHold       = 0;
+
+    if (ptDev->ulSusLen != 0U) {
+        ulHold = _FROM_GetSusHoldUs(ptDev);
+        clr_flg(ptDev->tFlgID, ~FROM_EVFBIT_SUSREQ);
+        if (ulHold != 0U) {
+            /* 消去再開直後は中断できる時刻まで待つ(読み書き要求では起床しない) */
+            tHold = (TMO)((ulHold + FROM_TICK_US - 1U) / FROM_TICK_US);
+            twai_flg(ptDev->tFlgID, FROM_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, (tHold < tSleep) ? tHold : tSleep);
+        }
+        else if (_FROM_IsIoPending(ptDev) == 0) {
+            twai_flg(ptDev->tFlgID, FROM_EVFBIT_SUSREQ, TWF_ORW, &tFlgPtn, tSleep);
+        }
+        else {
+            ;   /* do nothing */
         }
     }
-    if (i == 1000U) {
-        iRet = FROM_ERASE_ERROR;
-        goto err_end;
+    else {
+        twai_flg(ptDev->tFlgID, FROM_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, tSleep);
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_PollStatus                                                                */
+/*                                                                                              */
+/* DESCRIPTION: ステータスポーリング(最大FROM_POLL_BURST回、割り込み内で連続実行)               */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : ulSeqId                         ステータス読み出しシーケンス(FLEXSPI_SEQ_*)     */
+/*            : ucMask                          判定ビット                                      */
+/*            : ucExpect                        完了時の判定ビット値                            */
+/*            : pulPolls                        ステータス読み出し回数(加算する)                */
+/*                                                                                              */
+/* OUTPUT     : pulPolls                        ステータス読み出し回数                          */
+/*                                                                                              */
+/* RESULTS    : FROM_POLL_READY                 完了                                            */
+/*              FROM_POLL_BUSY                  実行中                                          */
+/*              FROM_POLL_ERROR                 ステータス読み出しエラー                        */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_PollStatus(FROM_DevInfo *ptDev, uint32_t ulSeqId, unsigned char ucMask, unsigned char ucExpect, uint32_t *pulPolls)
+{
+FROM_PollInfo *ptPoll = &ptDev->tPoll;
+FLGPTN tFlgPtn        = 0;
+uint32_t ulResult     = FROM_POLL_ERROR;
+
+    ptPoll->tDesc.ulSeqId     = ulSeqId;
+    ptPoll->tDesc.ulAddress   = FlexSPI_GetDeviceBase(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect);
+    ptPoll->tDesc.ulLength    = ptDev->ulWidth;     /* パラレルモード時はデバイス毎に1バイトずつ返る */
+    ptPoll->tDesc.ulDir       = FLEXSPI_CMD_DIR_READ;
+    ptPoll->tDesc.pucBuf      = ptPoll->ucStatus;
+    ptPoll->tDesc.pfnCallback = _FROM_PollDone;
+    ptPoll->tDesc.pvExinf     = ptDev;
+    ptPoll->ucMask            = ucMask;
+    ptPoll->ucExpect          = ucExpect;
+    ptPoll->ulCount           = 0;
+    ptPoll->ulResult          = FROM_POLL_ERROR;
+    clr_flg(ptDev->tFlgID, ~FROM_EVFBIT_POLL);
+
+    /* バス取得(ポーリング中はRX FIFOを占有する) */
+    wai_sem(l_tDrvInfo.tBusSemID);
+    if ((_FROM_SetIoMode(ptDev, FROM_IO_MODE_SPI) == FLEXSPI_E_SUCCESS) &&
+        (FlexSPI_SubmitCommand(l_tDrvInfo.tpFlexSPIReg, &ptPoll->tDesc) == FLEXSPI_E_SUCCESS)) {
+        if (twai_flg(ptDev->tFlgID, FROM_EVFBIT_POLL, TWF_ORW, &tFlgPtn, FROM_POLL_TMO) == E_OK) {
+            ulResult = ptPoll->ulResult;
+        }
+        else {
+            /* コントローラー無応答(記述子をキューから外し、以降の登録を可能にする) */
+            (void)FlexSPI_CancelCommand(l_tDrvInfo.tpFlexSPIReg, &ptPoll->tDesc);
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+    sig_sem(l_tDrvInfo.tBusSemID);
+
+    *pulPolls += ptPoll->ulCount;
+
+    return ulResult;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_PollDone                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: ステータス読み出し完了通知(FlexSPI割り込みから呼び出される)                     */
+/*              実行中かつ読み出し回数がFROM_POLL_BURST未満なら同じコマンドを再登録し、         */
+/*              それ以外はタスクへ結果を通知する                                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDesc                          ステータス読み出しコマンド                      */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : none                            なし                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_PollDone(FlexSPI_CmdDesc *ptDesc)
+{
+FROM_DevInfo *ptDev   = (FROM_DevInfo *)ptDesc->pvExinf;
+FROM_PollInfo *ptPoll = &ptDev->tPoll;
+uint32_t ulResult     = FROM_POLL_READY;
+uint32_t j            = 0;
+
+    ptPoll->ulCount++;
+
+    /* ステータスチェック(全デバイスが完了していること) */
+    if (ptDesc->iResult != FLEXSPI_E_SUCCESS) {
+        ulResult = FROM_POLL_ERROR;
+    }
+    else {
+        for (j = 0; j < ptDev->ulWidth; j++) {
+            if (ptPoll->ucStatus[j] == 0xFF) {
+                ulResult = FROM_POLL_ERROR;
+                break;
+            }
+            else if ((ptPoll->ucStatus[j] & ptPoll->ucMask) != ptPoll->ucExpect) {
+                ulResult = FROM_POLL_BUSY;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+    }
+
+    /* 実行中ならタスクへ戻らず続けて読み出す */
+    if ((ulResult == FROM_POLL_BUSY) && (ptPoll->ulCount < FROM_POLL_BURST)) {
+        if (FlexSPI_iSubmitCommand(l_tDrvInfo.tpFlexSPIReg, ptDesc) == FLEXSPI_E_SUCCESS) {
+            return;
+        }
+        else {
+            ulResult = FROM_POLL_ERROR;
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    ptPoll->ulResult = ulResult;
+    iset_flg(ptDev->tFlgID, FROM_EVFBIT_POLL);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_GetTimeUs                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: 現在時刻取得(マイクロ秒)                                                        */
+/*              時刻取得関数未登録時はシステム時刻(ミリ秒単位)を換算する                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                            なし                                            */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : 現在時刻                                                                        */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_GetTimeUs(void)
+{
+SYSTIM tTim = { 0 };
+
+    if (l_tDrvInfo.pfnGetTime != NULL) {
+        return l_tDrvInfo.pfnGetTime();
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    get_tim(&tTim);
+
+    return tTim.ltime * FROM_TICK_US;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_EnterOctal                                                                */
+/*                                                                                              */
+/* DESCRIPTION: Octal DDRモード移行(デバイス種別がFLEXSPI_DEVICE_OCTAL_DDRの場合のみ)           */
+/*              拡張SPIモードでI/Oモード設定(揮発性構成レジスタ アドレス0)へ0xE7を書き込む      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 コマンド実行エラー                              */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_EnterOctal(FROM_DevInfo *ptDev)
+{
+uint32_t ulBase        = FlexSPI_GetDeviceBase(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect);
+int iRet               = FLEXSPI_E_SUCCESS;
+unsigned char ucMode   = 0xE7U;     /* Octal DDR(DQSあり) */
+
+    if (FlexSPI_GetDeviceType() != FLEXSPI_DEVICE_OCTAL_DDR) {
+        return FLEXSPI_E_SUCCESS;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* バス取得 */
+    wai_sem(l_tDrvInfo.tBusSemID);
+
+    /* 書き込み許可(拡張SPIモード) */
+    iRet = FlexSPI_ExecSequence(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_SPI_WRITE_ENABLE, ulBase, 0);  /* コマンド実行 */
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        /* I/Oモード設定 */
+        iRet = FlexSPI_WriteSequence(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_ENTER_OCTAL, &ucMode, ulBase, 1);
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* バス解放 */
+    sig_sem(l_tDrvInfo.tBusSemID);
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_ExitOctal                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: Octal DDRモード解除(デバイス種別がFLEXSPI_DEVICE_OCTAL_DDRの場合のみ)           */
+/*              Octal DDRモードでI/Oモード設定へ0xFF(拡張SPI)を書き込む                         */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 コマンド実行エラー                              */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_ExitOctal(FROM_DevInfo *ptDev)
+{
+uint32_t ulBase                = FlexSPI_GetDeviceBase(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect);
+int iRet                       = FLEXSPI_E_SUCCESS;
+unsigned char ucMode[2]        = { 0xFFU, 0xFFU };  /* 拡張SPI(DDR転送は2バイト単位) */
+
+    if (FlexSPI_GetDeviceType() != FLEXSPI_DEVICE_OCTAL_DDR) {
+        return FLEXSPI_E_SUCCESS;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* バス取得 */
+    wai_sem(l_tDrvInfo.tBusSemID);
+
+    /* 書き込み許可(Octal DDRモード) */
+    iRet = FlexSPI_ExecSequence(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_WRITE_ENABLE, ulBase, 0);  /* コマンド実行 */
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        /* I/Oモード設定 */
+        iRet = FlexSPI_WriteSequence(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_EXIT_OCTAL, ucMode, ulBase, sizeof(ucMode));
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* バス解放 */
+    sig_sem(l_tDrvInfo.tBusSemID);
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_BeginPgmErs                                                               */
+/*                                                                                              */
+/* DESCRIPTION: 書き込み・消去開始                                                              */
+/*              完了までの読み出しはAHB窓を使用せずIPコマンドで行う                             */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : uiAddress                       書き込み・消去するアドレス(デバイス内)          */
+/*            : uiLength                        書き込み・消去するデータ長                      */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : none                            なし                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_BeginPgmErs(FROM_DevInfo *ptDev, unsigned int uiAddress, unsigned int uiLength)
+{
+    ptDev->ulPgmErs = 1U;
+
+    /* 対象範囲の読み出しビューを無効化(開始時点で更新し、参照中のビューも無効と判定させる) */
+    _FROM_TouchGen(ptDev, uiAddress, uiLength);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_EndPgmErs                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: 書き込み・消去終了                                                              */
+/*              対象範囲のデータキャッシュ・AHB RXバッファを破棄し、                            */
+/*              AHB窓からの読み出しを再開する                                                   */
+/*              失敗時はデバイスの完了を確認できた場合のみ再開する                              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : uiAddress                       書き込み・消去したアドレス(デバイス内)          */
+/*            : uiLength                        書き込み・消去したデータ長                      */
+/*            : iResult                         書き込み・消去結果(FROM_SUCCESSは完了確認済み)  */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : none                            なし                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_EndPgmErs(FROM_DevInfo *ptDev, unsigned int uiAddress, unsigned int uiLength, int iResult)
+{
+uint32_t ulBase   = FlexSPI_GetDeviceBase(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect);
+uint32_t ulPolls  = 0;
+uint32_t ulResult = FROM_POLL_READY;
+
+    /* 失敗時はデバイスの完了を確認する(タイムアウト時は書き込み・消去が続いている場合がある) */
+    if (iResult != FROM_SUCCESS) {
+        ulResult = _FROM_PollStatus(ptDev, l_tDrvInfo.tPart.ulReadySeq, l_tDrvInfo.tPart.ucReadyMask,
+                                    l_tDrvInfo.tPart.ucReadyExpect, &ulPolls);
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* AHB読み出しデータ破棄(デバイスが実行中のまま、または破棄に失敗した場合はAHB窓を使用しない) */
+    wai_sem(l_tDrvInfo.tBusSemID);
+    if ((FlexSPI_InvalidateAHB(l_tDrvInfo.tpFlexSPIReg, ulBase + uiAddress, uiLength) == FLEXSPI_E_SUCCESS) &&
+        (ulResult == FROM_POLL_READY)) {
+        ptDev->ulPgmErs = 0U;
+    }
+    else {
+        ;   /* do nothing */
+    }
+    sig_sem(l_tDrvInfo.tBusSemID);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SetIoMode                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: I/Oモード切り替え(バス取得中に呼び出す)                                         */
+/*              デバイスのI/Oモードが指定と異なる場合のみQuadモード移行・解除コマンドを送信する */
+/*              Quadデバイス以外は何もしない                                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : ulMode                          FROM_IO_MODE_*                                  */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 コマンド実行エラー                              */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_SetIoMode(FROM_DevInfo *ptDev, uint32_t ulMode)
+{
+uint32_t ulBase = FlexSPI_GetDeviceBase(l_tDrvInfo.tpFlexSPIReg, ptDev->iChipSelect);
+int iRet        = FLEXSPI_E_SUCCESS;
+
+    if ((FlexSPI_GetDeviceType() != FLEXSPI_DEVICE_QUAD) || (ptDev->ulIoMode == ulMode)) {
+        return FLEXSPI_E_SUCCESS;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (ulMode == FROM_IO_MODE_QPI) {
+        /* Quadモード中はAHB読み出しシーケンスが使えないため、参照中の読み出しビューを無効化 */
+        _FROM_TouchGen(ptDev, 0, ptDev->ulSize);
+        iRet = FlexSPI_ExecSequence(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_ENTER_QUAD, ulBase, 0);  /* コマンド実行 */
+    }
+    else {
+        iRet = FlexSPI_ExecSequence(l_tDrvInfo.tpFlexSPIReg, FLEXSPI_SEQ_RESET_QUAD, ulBase, 0);  /* コマンド実行 */
+    }
+
+    /* 失敗時はモード不明のため更新せず、次回も切り替えを試みる */
+    if (iRet == FLEXSPI_E_SUCCESS) {
+        ptDev->ulIoMode = ulMode;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_IsMapped                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: AHB窓からの読み出し可否                                                         */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(FROM_DEV_*)                        */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : 0以外                             AHB窓から読み出す                             */
+/*              0                               IPコマンドで読み出す                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_IsMapped(uint32_t ulDev)
+{
+    /* IPコマンド指定 */
+    if (l_tDrvInfo.ulReadMode != FROM_READ_MODE_AHB) {
+        return 0;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* AHB窓に配置されていない(パラレルモード中のFROM_DEV_1) */
+    if (FROM_GetAhbAddress(ulDev) == 0U) {
+        return 0;
+    }
+    else {
+        return 1;
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_TouchGen                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: 読み出しビューの世代更新                                                        */
+/*              指定範囲を含む領域の最終更新世代を新しい世代とし、                              */
+/*              それ以前に取得したビューを無効とする                                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : ulAddress                       更新するアドレス(デバイス内)                    */
+/*            : ulLength                        更新するデータ長                                */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : none                            なし                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_TouchGen(FROM_DevInfo *ptDev, uint32_t ulAddress, uint32_t ulLength)
+{
+uint32_t ulRegion = ptDev->ulSize / FROM_GEN_REGION_NUM;
+uint32_t ulFirst  = ulAddress / ulRegion;
+uint32_t ulLast   = (ulLength == 0U) ? ulFirst : ((ulAddress + ulLength - 1U) / ulRegion);
+uint32_t ulGen    = 0;
+uint32_t i        = 0;
+
+    if (FROM_GEN_REGION_NUM <= ulLast) {
+        ulLast = FROM_GEN_REGION_NUM - 1U;
     }
     else {
-        iRet = FROM_SUCCESS;
+        ;   /* do nothing */
     }
-err_end:
-    return iRet;
+
+    /* 世代は全デバイス共通のため、他デバイスの更新と排他する */
+    loc_cpu();
+
+    /* 領域に新しい世代を記録してから世代を進める(ビュー取得と重なっても無効側に判定される) */
+    ulGen = l_tDrvInfo.ulGenSeq + 1U;
+    for (i = ulFirst; i <= ulLast; i++) {
+        ptDev->ulGen[i] = ulGen;
+    }
+    l_tDrvInfo.ulGenSeq = ulGen;
+
+    unl_cpu();
 }
 
 /************************************************************************************************/
-/* FUNCTION   : _FROM_BlockEraseCore                                                            */
+/* FUNCTION   : _FROM_TouchGenAll                                                               */
 /*                                                                                              */
-/* DESCRIPTION: ブロック消去処理                                                                */
+/* DESCRIPTION: 読み出しビューの世代更新(全デバイス・全領域)                                    */
+/*              AHB窓の配置・クロック等の構成変更時に、取得済みの全ビューを無効とする           */
 /*----------------------------------------------------------------------------------------------*/
-/* INPUT      : uiAddress                       消去を開始するアドレス                          */
-/*            : uiLength                        消去するバイト数                                */
+/* INPUT      : none                            なし                                            */
 /*                                                                                              */
 /* OUTPUT     : none                            なし                                            */
 /*                                                                                              */
-/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
-/*            : FROM_ERASE_ERROR                消去エラー                                      */
+/* RESULTS    : none                            なし                                            */
 /*                                                                                              */
 /************************************************************************************************/
-LOCAL int _FROM_BlockEraseCore(unsigned int uiAddress, unsigned int uiLength)
+LOCAL void _FROM_TouchGenAll(void)
 {
-FLGPTN tFlgPtn         = 0;
-int iRet               = FROM_ERASE_ERROR;
-uint32_t i             = 0;
-unsigned char ucStatus = 0x00;
+uint32_t i = 0;
 
-    /* 書き込み許可 */
-    FlexSPI_SetWriteEnableSequence(l_tDrvInfo.tpFlexSPIReg);    /* LUT設定 */
-    iRet = FlexSPI_ExecCommand(l_tDrvInfo.tpFlexSPIReg, 0, 0);  /* コマンド実行 */
-    if (iRet != FLEXSPI_E_SUCCESS) {
-        iRet = FROM_ERASE_ERROR;
-        goto err_end;
+    for (i = 0; i < FROM_DEV_NUM; i++) {
+        _FROM_TouchGen(&l_tDrvInfo.tDev[i], 0, l_tDrvInfo.tDev[i].ulSize);
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_LockDev                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: デバイスの排他                                                                  */
+/*              消去中断中は、中断中の消去範囲と重ならない読み書きのみ排他を取得できる          */
+/*              (他は消去再開後まで待ち行列に並び直す)                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : ulMode                          排他の種別(FROM_LOCK_*)                         */
+/*            : ulAddress                       読み書き開始アドレス(FROM_LOCK_IO時)            */
+/*            : ulLength                        読み書きデータ長(FROM_LOCK_IO時)                */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : none                            なし                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_LockDev(FROM_DevInfo *ptDev, uint32_t ulMode, uint32_t ulAddress, uint32_t ulLength)
+{
+FLGPTN tFlgPtn = 0;
+
+    /* 読み書き要求登録(消去完了待ちを起こし、消去を中断させる) */
+    if (ulMode == FROM_LOCK_IO) {
+        loc_cpu();
+        if (ptDev->ulIoReq == 0U) {
+            ptDev->ulIoAddr = ulAddress;
+            ptDev->ulIoEnd  = ulAddress + ulLength;
+        }
+        else {
+            ptDev->ulIoAddr = (ulAddress < ptDev->ulIoAddr) ? ulAddress : ptDev->ulIoAddr;
+            ptDev->ulIoEnd  = ((ulAddress + ulLength) > ptDev->ulIoEnd) ? (ulAddress + ulLength) : ptDev->ulIoEnd;
+        }
+        ptDev->ulIoReq++;
+        unl_cpu();
+        set_flg(ptDev->tFlgID, FROM_EVFBIT_SUSREQ);
     }
     else {
         ;   /* do nothing */
     }
 
-    /* ブロック消去 */
-    FlexSPI_SetErase32KBSectorSequence(l_tDrvInfo.tpFlexSPIReg);                /* LUT設定 */
-    iRet = FlexSPI_ExecCommand(l_tDrvInfo.tpFlexSPIReg, uiAddress, uiLength);   /* コマンド実行 */
-    if (iRet != FLEXSPI_E_SUCCESS) {
-        iRet = FROM_ERASE_ERROR;
-        goto err_end;
+    wai_sem(ptDev->tSemID);
+
+    /* 消去中断中は消去範囲と重ならない読み書きのみ実行する */
+    while ((ptDev->ulSuspended != 0U) &&
+           ((ulMode != FROM_LOCK_IO) ||
+            ((ulAddress < (ptDev->ulSusAddr + ptDev->ulSusLen)) && (ptDev->ulSusAddr < (ulAddress + ulLength))))) {
+        sig_sem(ptDev->tSemID);
+        twai_flg(ptDev->tFlgID, FROM_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, 1);
+        wai_sem(ptDev->tSemID);
+    }
+
+    /* 読み書き要求取り下げ */
+    if (ulMode == FROM_LOCK_IO) {
+        loc_cpu();
+        ptDev->ulIoReq--;
+        unl_cpu();
     }
     else {
         ;   /* do nothing */
     }
+}
 
-    /* 消去完了待ち */
-    FlexSPI_SetReadStatusSequence(l_tDrvInfo.tpFlexSPIReg);                     /* LUT設定 */
-    for (i = 0; i < 1000U; i++) {
-        /* ステータス読み出し */
-        ucStatus = FlexSPI_ExecCommandAndRead(l_tDrvInfo.tpFlexSPIReg, 0, 0);
-        if (ucStatus == 0xFF) {
-            iRet = FROM_ERASE_ERROR;
-            goto err_end;
+/************************************************************************************************/
+/* FUNCTION   : _FROM_LockAllDev                                                                */
+/*                                                                                              */
+/* DESCRIPTION: 全デバイスの排他(オープン中のデバイスの入出力完了を待ち、入出力中とする)        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                            なし                                            */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : none                            なし                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_LockAllDev(void)
+{
+uint32_t i = 0;
+
+    /* デッドロック防止のため常にデバイス番号順に取得する */
+    for (i = 0; i < FROM_DEV_NUM; i++) {
+        if ((l_tDrvInfo.ulOpenMask & (1UL << i)) != 0U) {
+            _FROM_LockDev(&l_tDrvInfo.tDev[i], FROM_LOCK_EXCL, 0U, 0U);
+            l_tDrvInfo.tDev[i].ulState = FROM_BUSY_STATE;
         }
         else {
             ;   /* do nothing */
         }
+    }
+}
 
-        /* ステータスチェック(b0:write in progress ビットが'0'なら完了) */
-        if ((ucStatus & 0x01) == 0) {
-            break;
+/************************************************************************************************/
+/* FUNCTION   : _FROM_UnlockAllDev                                                              */
+/*                                                                                              */
+/* DESCRIPTION: 全デバイスの排他解除                                                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                            なし                                            */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : none                            なし                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_UnlockAllDev(void)
+{
+uint32_t i = 0;
+
+    for (i = FROM_DEV_NUM; 0U < i; i--) {
+        if ((l_tDrvInfo.ulOpenMask & (1UL << (i - 1U))) != 0U) {
+            /* パラレルモード中のFROM_DEV_1はFROM_DEV_0と組で使用中のまま */
+            if ((l_tDrvInfo.ulParallel != FROM_PARALLEL_OFF) && ((i - 1U) == FROM_DEV_1)) {
+                l_tDrvInfo.tDev[i - 1U].ulState = FROM_BUSY_STATE;
+            }
+            else {
+                l_tDrvInfo.tDev[i - 1U].ulState = FROM_OPEN_STATE;
+            }
+            sig_sem(l_tDrvInfo.tDev[i - 1U].tSemID);
         }
         else {
-            /* ウエイト */
-            twai_flg(l_tDrvInfo.tFlgID, FROM_EVFBIT_WAIT, TWF_ORW, &tFlgPtn, 1);
+            ;   /* do nothing */
         }
     }
-    if (i == 1000U) {
-        iRet = FROM_ERASE_ERROR;
-        goto err_end;
-    }
-    else {
-        iRet = FROM_SUCCESS;
-    }
-err_end:
-    return iRet;
 }
 
-#ifdef _DEBUG
-/****************************************************************************/
-/*  デバッグ用                                                              */
-/****************************************************************************/
 /************************************************************************************************/
-/* FUNCTION   : FROM_GetDriverData                                                              */
+/* FUNCTION   : _FROM_SetGeometry                                                               */
 /*                                                                                              */
-/* DESCRIPTION: ドライバデータ取得                                                              */
+/* DESCRIPTION: アクセス単位設定                                                                */
+/*              パラレルモードではサイズ・消去単位が台数倍となる                                */
+/*              末尾のDLL校正予約領域(FROM_CAL_SECT_NUMセクタ)はアクセス可能サイズから除く      */
 /*----------------------------------------------------------------------------------------------*/
-/* INPUT      : none                                                                            */
+/* INPUT      : ptDev                           デバイス情報                                    */
+/*            : ulWidth                         同時アクセスするデバイス数                      */
 /*                                                                                              */
-/* OUTPUT     : none                                                                            */
+/* OUTPUT     : none                            なし                                            */
 /*                                                                                              */
-/* RESULTS    : ドライバデータ情報                                                              */
+/* RESULTS    : none                            なし                                            */
 /*                                                                                              */
 /************************************************************************************************/
-void * FROM_GetDriverData(void)
+LOCAL void _FROM_SetGeometry(FROM_DevInfo *ptDev, uint32_t ulWidth)
 {
-    return (void*)&l_tDrvInfo;
+    ptDev->ulSize     = (l_tDrvInfo.tPart.ulSize - (FROM_CAL_SECT_NUM * l_tDrvInfo.tPart.ulSectSize)) * ulWidth;
+    ptDev->ulSectSize = l_tDrvInfo.tPart.ulSectSize * ulWidth;
+    ptDev->ulBlkSize  = l_tDrvInfo.tPart.ulBlkSize * ulWidth;
+    ptDev->ulPageSize = l_tDrvInfo.tPart.ulPageSize * ulWidth;
+    ptDev->ulWidth    = ulWidth;
 }
 
-#endif  /* _DEBUG */
+/************************************************************************************************/
+/* FUNCTION   : _FROM_MakeConfig                                                                */
+/*                                                                                              */
+/* DESCRIPTION: デバイスコンフィギュレーション情報作成                                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulProfile                       クロックプロファイル(FROM_CLK_PROFILE_*)        */
+/*                                                                                              */
+/* OUTPUT     : ptConfig                        デバイスコンフィギュレーション情報              */
+/*                                                                                              */
+/* RESULTS    : none                            なし                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_MakeConfig(flexspi_device_config_t *ptConfig, uint32_t ulProfile)
+{
+    ptConfig->flexspiRootClk       = l_tClkProfile[ulProfile].ulRootClk;
+    ptConfig->isSck2Enabled        = false;
+    ptConfig->flashSize            = (uint32_t)FROM_SIZE / 1024U; /* 設定はKB単位 */
+    ptConfig->CSIntervalUnit       = kFLEXSPI_CsIntervalUnit1SckCycle;
+    ptConfig->CSInterval           = 3;
+    ptConfig->CSHoldTime           = 3;
+    ptConfig->CSSetupTime          = 3;
+    ptConfig->dataValidTime        = l_tClkProfile[ulProfile].ucDataValidTime;
+    ptConfig->columnspace          = 0;
+    ptConfig->enableWordAddress    = false;
+    ptConfig->AWRSeqIndex          = 0;
+    ptConfig->AWRSeqNumber         = 0;
+    ptConfig->ARDSeqIndex          = (uint8_t)l_tClkProfile[ulProfile].ulAhbReadSeq;    /* SDR/DTRはプロファイルで選択 */
+    ptConfig->ARDSeqNumber         = 1;
+    ptConfig->AHBWriteWaitUnit     = kFLEXSPI_AhbWriteWaitUnit2AhbCycle;
+    ptConfig->AHBWriteWaitInterval = 0;
+    ptConfig->enableWriteMask      = false;
+}
 
-/************************* 以下は、動作確認用の関数  正式版のドライバでは不要 **********/
+/************************************************************************************************/
+/* FUNCTION   : _FROM_GetRxClkSrc                                                               */
+/*                                                                                              */
+/* DESCRIPTION: RXサンプルクロックソース取得                                                    */
+/*              Octal DDRデバイスは読み出しデータに同期したDQSを出力するため、                  */
+/*              プロファイルに関わらずデバイスが出力するDQSでサンプリングする                   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulProfile                       クロックプロファイル(FROM_CLK_PROFILE_*)        */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_RXCLKSRC_*              RXサンプルクロックソース                        */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_GetRxClkSrc(uint32_t ulProfile)
+{
+    if (FlexSPI_GetDeviceType() == FLEXSPI_DEVICE_OCTAL_DDR) {
+        return FLEXSPI_RXCLKSRC_EXTERNAL_DQS;
+    }
+    else {
+        return l_tClkProfile[ulProfile].ulRxClkSrc;
+    }
+}
 
-#if 0
-/**
- * @fn FROM_ReadMap
- * @brief マイコンにMAPされたFROMのデータを読み出し
- * @param unsigned int uiAddress データ読み込みを開始するアドレス
- * @param unsinged int uiLength データを読み込む長さ（byte)
- * @param unsigned char *strReadData 読み込んだデータを格納する領域
- * @return int 読み込みの成功・失敗を区別できる戻り値
- * @note
- *
- */
-int FROM_ReadMap( unsigned int uiFlashAddress, unsigned int uiLength, unsigned int uiSdramAddress )
+/************************************************************************************************/
+/* FUNCTION   : _FROM_ApplyClockProfile                                                         */
+/*                                                                                              */
+/* DESCRIPTION: クロックプロファイル適用                                                        */
+/*              SCLK周波数・RXサンプルクロックソースを変更し、校正済みなら                      */
+/*              サンプリング点を上書きする                                                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulProfile                       クロックプロファイル(FROM_CLK_PROFILE_*)        */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_*                     FlexSPIドライバのエラー                         */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_ApplyClockProfile(uint32_t ulProfile)
 {
-    s_flexspi_reg->FLSHCR2[0] = 1;      // Flash Control Register 2 (FLSHA1CR2)に、シーケンス番号セット
+flexspi_device_config_t tConfig = { 0 };
+const FROM_CalEntry *ptEntry    = &l_tDrvInfo.tCalRecord.tEntry[ulProfile];
+uint32_t i                      = 0;
+int iRet                        = FLEXSPI_E_ERROR;
 
-    memcpy( (unsigned char *)uiSdramAddress, (0x08000000 + uiFlashAddress), uiLength );
+    /* クロック切り替え中のAHB読み出しは不定のため全ビューを無効化 */
+    _FROM_TouchGenAll();
 
-    return 0;
-}
+    /* SCLK周波数・DLL設定 */
+    _FROM_MakeConfig(&tConfig, ulProfile);
+    FlexSPI_SetRxClockSource(l_tDrvInfo.tpFlexSPIReg, _FROM_GetRxClkSrc(ulProfile));
+    iRet = FlexSPI_ChangeClock(l_tDrvInfo.tpFlexSPIReg, &tConfig);
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        goto err_end;
+    }
+    else {
+        /* IP読み出しシーケンス切り替え(SDR/DTR) */
+        l_tDrvInfo.ulReadSeq    = l_tClkProfile[ulProfile].ulReadSeq;
+        l_tDrvInfo.ulSpiReadSeq = l_tClkProfile[ulProfile].ulSpiReadSeq;
+    }
+
+    /* 校正済みならオープン中の全デバイスのサンプリング点を上書き */
+    if ((l_tDrvInfo.tCalRecord.ulMagic == FROM_CAL_MAGIC) &&
+        (ptEntry->ucValid != 0U)) {
+        for (i = 0; i < FROM_DEV_NUM; i++) {
+            if ((l_tDrvInfo.ulOpenMask & (1UL << i)) == 0U) {
+                continue;
+            }
+            else {
+                ;   /* do nothing */
+            }
+
+            iRet = FlexSPI_SetSampleDelay(l_tDrvInfo.tpFlexSPIReg, l_tDrvInfo.tDev[i].iChipSelect,
+                                          ptEntry->ucRxClkSrc, ptEntry->ucOvrdVal);
+            if (iRet != FLEXSPI_E_SUCCESS) {
+                goto err_end;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
 
+    l_tDrvInfo.ulClkProfile = ulProfile;
 
-void sil_wrw_mem(uint32_t *mem, uint32_t data)
-{
-    *((volatile uint32_t *) mem) = data;
-};
+err_end:
+    return iRet;
+}
 
+/************************************************************************************************/
+/* FUNCTION   : _FROM_LoadCalibration                                                           */
+/*                                                                                              */
+/* DESCRIPTION: DLL校正結果読み出し(未校正・破損時は全プロファイル未校正とする)                 */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                            なし                                            */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : none                            なし                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_LoadCalibration(void)
+{
+FROM_DevInfo *ptDev = &l_tDrvInfo.tDev[FROM_DEV_0];
 
+    /* 校正結果はFROM_DEV_0に保存する(FROM_DEV_0未オープン時は未校正扱い) */
+    if (((l_tDrvInfo.ulOpenMask & (1UL << FROM_DEV_0)) == 0U) ||
+        (_FROM_ReadCore(ptDev, FROM_CAL_RECORD_ADDR(ptDev->ulSize, ptDev->ulSectSize), (unsigned int)sizeof(FROM_CalRecord),
+                        (unsigned char *)&l_tDrvInfo.tCalRecord) != FROM_SUCCESS) ||
+        (FROM_CalCheckRecord(&l_tDrvInfo.tCalRecord) != FROM_SUCCESS)) {
+        memset(&l_tDrvInfo.tCalRecord, 0, sizeof(FROM_CalRecord));
+    }
+    else {
+        ;   /* do nothing */
+    }
+}
 
-int FROM_MapSet( void )
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SaveCalibration                                                           */
+/*                                                                                              */
+/* DESCRIPTION: DLL校正結果保存                                                                 */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                            なし                                            */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_SaveCalibration(void)
 {
-    int i;
+FROM_DevInfo *ptDev = &l_tDrvInfo.tDev[FROM_DEV_0];
+uint32_t ulAddr     = FROM_CAL_RECORD_ADDR(ptDev->ulSize, ptDev->ulSectSize);
+int iRet            = FROM_SUCCESS;
+
+    /* 書き込み・消去開始(完了までAHB窓は使用しない) */
+    _FROM_BeginPgmErs(ptDev, ulAddr, ptDev->ulSectSize);
 
-    printf( "SET SPI MAP\r\n" );
+    if (_FROM_EraseCore(ptDev, FROM_ERASE_4KB, ulAddr) != FROM_SUCCESS) {
+        iRet = FROM_ERASE_ERROR;
+    }
+    else if (_FROM_WriteCore(ptDev, ulAddr, (unsigned int)sizeof(FROM_CalRecord),
+                             (unsigned char *)&l_tDrvInfo.tCalRecord) != FROM_SUCCESS) {
+        iRet = FROM_WRITE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
 
-    // RXCLKSRCセット
-    s_flexspi_reg->MCR0 = (0x2 << FlexSPI_MCR0_RXCLKSRC_SHIFT);
-    do {
-        // レジスタの変化待ち
-    } while( (s_flexspi_reg->MCR0 & 0x01) != 0 );
+    /* 書き込み・消去終了 */
+    _FROM_EndPgmErs(ptDev, ulAddr, ptDev->ulSectSize, iRet);
 
-    fspi_module_disable(1);
+    return iRet;
+}
 
-    // AHBGRANTWAITとIPGRANTWAITに、デフォルト値をセット
-    s_flexspi_reg->MCR0 = 0xFFFF0000;
+/************************************************************************************************/
+/* FUNCTION   : _FROM_PrepareCalPattern                                                         */
+/*                                                                                              */
+/* DESCRIPTION: 校正パターン確認(未書き込み・不一致時は書き込む)                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                            なし                                            */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_CAL_ERROR                  書き込み後も一致しない                          */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_PrepareCalPattern(void)
+{
+FROM_DevInfo *ptDev = &l_tDrvInfo.tDev[FROM_DEV_0];
+uint32_t ulAddr     = FROM_CAL_PATTERN_ADDR(ptDev->ulSize, ptDev->ulSectSize);
+uint32_t ulOffset   = 0;
+uint32_t ulSize     = 0;
+int iRet            = FROM_SUCCESS;
 
-    // FLASHのサイズをセット(KB単位)
-    s_flexspi_reg->FLSHCR0[0] = FROM_CHIP_SIZE / 1024;  // FLSHA1CR0
-    // 接続しているFLASHは１個のみなので、FLSHA1CR0以外は0
-    s_flexspi_reg->FLSHCR0[1] = 0;                      // FLSHA2CR0
-    s_flexspi_reg->FLSHCR0[2] = 0;                      // FLSHB1CR0
-    s_flexspi_reg->FLSHCR0[3] = 0;                      // FLSHB2CR0
+    FROM_CalMakePattern(l_ucCalPattern, FROM_CAL_PATTERN_SIZE);
 
-    // LUTセット
-    FlexSPI_SetQuadOutFastRdSequence(s_flexspi_reg);
+    /* 書き込み済み */
+    if (_FROM_ReadCalPattern() == FROM_SUCCESS) {
+        return FROM_SUCCESS;
+    }
+    else {
+        ;   /* do nothing */
+    }
 
-    /******** fspi_init_ahb_read() *************/
+    /* 校正パターン書き込み */
+    _FROM_BeginPgmErs(ptDev, ulAddr, ptDev->ulSectSize);
+    if (_FROM_EraseCore(ptDev, FROM_ERASE_4KB, ulAddr) != FROM_SUCCESS) {
+        iRet = FROM_ERASE_ERROR;
+    }
+    else {
+        iRet = FROM_SUCCESS;
+    }
 
-    for(i=0; i<7; i++ ) {
-        s_flexspi_reg->AHBRXBUFCR0[i] = 0;
+    for (ulOffset = 0; (ulOffset < FROM_CAL_PATTERN_SIZE) && (iRet == FROM_SUCCESS); ulOffset += ulSize) {
+        ulSize = FROM_CAL_PATTERN_SIZE - ulOffset;
+        ulSize = (FLEXSPI_TX_BUFFER_SIZE < ulSize) ? FLEXSPI_TX_BUFFER_SIZE : ulSize;
+        if (_FROM_WriteCore(ptDev, ulAddr + ulOffset, ulSize, &l_ucCalPattern[ulOffset]) != FROM_SUCCESS) {
+            iRet = FROM_WRITE_ERROR;
+        }
+        else {
+            ;   /* do nothing */
+        }
     }
+    _FROM_EndPgmErs(ptDev, ulAddr, ptDev->ulSectSize, iRet);
 
-    //
-    s_flexspi_reg->AHBRXBUFCR0[7] = (FLEXSPI_AHB_BUFFER_SIZE / 8) | FlexSPI_AHBRXBUFCR0_PREFETCHEN_MASK;
+    if (iRet != FROM_SUCCESS) {
+        return iRet;
+    }
+    else {
+        ;   /* do nothing */
+    }
 
-    // AHB Read Prefetch Enable
-    s_flexspi_reg->AHBCR = FlexSPI_AHBCR_PREFETCHEN_MASK;
+    return _FROM_ReadCalPattern();
+}
 
-    s_flexspi_reg->FLSHCR2[0] = 1;      // Flash Control Register 2 (FLSHA1CR2)に、シーケンス番号セット
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SweepSampleDelay                                                          */
+/*                                                                                              */
+/* DESCRIPTION: DLL遅延セル数掃引(現在のSCLK周波数で校正パターンを読み出して判定)               */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulRxClkSrc                      RXサンプルクロックソース(FLEXSPI_RXCLKSRC_*)    */
+/*                                                                                              */
+/* OUTPUT     : pulCentre                       合格ウィンドウの中央                            */
+/*            : pulWidth                        合格ウィンドウ幅                                */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_CAL_ERROR                  合格範囲なし                                    */
+/*              FROM_CLOCK_ERROR                サンプリング点設定エラー                        */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_SweepSampleDelay(uint32_t ulRxClkSrc, uint32_t *pulCentre, uint32_t *pulWidth)
+{
+uint8_t ucPass[FROM_CAL_OVRDVAL_NUM] = { 0 };
+uint32_t i                           = 0;
 
-//  PRINT2("LUT[4]:0x%x  ", s_flexspi_reg->LUT[4] );
-//  PRINT2("LUT[5]:0x%x\r\n", s_flexspi_reg->LUT[5] );
+    for (i = 0; i < FROM_CAL_OVRDVAL_NUM; i++) {
+        if (FlexSPI_SetSampleDelay(l_tDrvInfo.tpFlexSPIReg, l_tDrvInfo.tDev[FROM_DEV_0].iChipSelect, ulRxClkSrc, i) != FLEXSPI_E_SUCCESS) {
+            return FROM_CLOCK_ERROR;
+        }
+        else {
+            ;   /* do nothing */
+        }
 
-    fspi_module_disable(0);
+        ucPass[i] = (_FROM_ReadCalPattern() == FROM_SUCCESS) ? 1U : 0U;
+    }
 
-    return 0;
+    return FROM_CalFindWindow(ucPass, FROM_CAL_OVRDVAL_NUM, pulCentre, pulWidth);
 }
 
-void fspi_module_disable( unsigned char disable )
+/************************************************************************************************/
+/* FUNCTION   : _FROM_ReadCalPattern                                                            */
+/*                                                                                              */
+/* DESCRIPTION: 校正パターン読み出し・比較                                                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                            なし                                            */
+/*                                                                                              */
+/* OUTPUT     : none                            なし                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    一致                                            */
+/*              FROM_CAL_ERROR                  読み出しエラーまたは不一致                      */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_ReadCalPattern(void)
 {
-    unsigned long mcr_val;
+FROM_DevInfo *ptDev = &l_tDrvInfo.tDev[FROM_DEV_0];
+uint32_t i          = 0;
+
+    /* 前回の読み出し結果で一致と判定しないよう反転値で埋める */
+    for (i = 0; i < FROM_CAL_PATTERN_SIZE; i++) {
+        l_ucCalBuf[i] = (unsigned char)~l_ucCalPattern[i];
+    }
 
-    mcr_val = s_flexspi_reg->MCR0;
-    if (disable != 0) {
-        mcr_val |= FlexSPI_MCR0_MDIS_MASK;
+    if ((_FROM_ReadCore(ptDev, FROM_CAL_PATTERN_ADDR(ptDev->ulSize, ptDev->ulSectSize), FROM_CAL_PATTERN_SIZE, l_ucCalBuf) != FROM_SUCCESS) ||
+        (memcmp(l_ucCalBuf, l_ucCalPattern, FROM_CAL_PATTERN_SIZE) != 0)) {
+        return FROM_CAL_ERROR;
     }
     else {
-        mcr_val &= ~FlexSPI_MCR0_MDIS_MASK;
+        ;   /* do nothing */
     }
 
-    s_flexspi_reg->MCR0 |= mcr_val;
+    return FROM_SUCCESS;
+}
+
+#ifdef _DEBUG
+/****************************************************************************/
+/*  デバッグ用                                                              */
+/****************************************************************************/
+/************************************************************************************************/
+/* FUNCTION   : FROM_GetDriverData                                                              */
+/*                                                                                              */
+/* DESCRIPTION: ドライバデータ取得                                                              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : ドライバデータ情報                                                              */
+/*                                                                                              */
+/************************************************************************************************/
+void * FROM_GetDriverData(void)
+{
+    return (void*)&l_tDrvInfo;
 }
-#endif
+
+#endif  /* _DEBUG */
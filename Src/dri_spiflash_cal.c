@@ -0,0 +1,221 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_spiflash_cal.c                                                      0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      NORドライバ DLL校正演算ソースファイル                                                   */
+/*      (ハードウェア・OSに依存しないため、ホスト環境でも単体で評価できる)                      */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/17  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "code_rules_def.h"
+#include "dri_spiflash.h"
+#include "dri_spiflash_local.h"
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+#define FROM_CAL_CRC32_POLY     (0xEDB88320U)       /* CRC-32(反転表現) */
+#define FROM_CAL_PATTERN_BLOCK  (32U)               /* パターン種別の切り替え単位 */
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_CalFindWindow                                                              */
+/*                                                                                              */
+/* DESCRIPTION: 合格ウィンドウ検索                                                              */
+/*              最も長く連続する合格範囲を求め、その中央を返す(同じ長さは先頭側を優先)          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pucPass                         判定結果(0:不合格、0以外:合格)                  */
+/*            : ulNum                           判定結果数                                      */
+/*                                                                                              */
+/* OUTPUT     : pulCentre                       合格ウィンドウの中央                            */
+/*            : pulWidth                        合格ウィンドウ幅                                */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_CAL_ERROR                  合格範囲なし                                    */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_CalFindWindow(const uint8_t *pucPass, uint32_t ulNum, uint32_t *pulCentre, uint32_t *pulWidth)
+{
+uint32_t i          = 0;
+uint32_t ulStart    = 0;
+uint32_t ulRun      = 0;
+uint32_t ulBestPos  = 0;
+uint32_t ulBestLen  = 0;
+
+    /* パラメータチェック */
+    if ((pucPass   == NULL) ||
+        (pulCentre == NULL) ||
+        (pulWidth  == NULL)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    for (i = 0; i < ulNum; i++) {
+        if (pucPass[i] != 0U) {
+            if (ulRun == 0U) {
+                ulStart = i;
+            }
+            else {
+                ;   /* do nothing */
+            }
+            ulRun++;
+            if (ulBestLen < ulRun) {
+                ulBestPos = ulStart;
+                ulBestLen = ulRun;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        else {
+            ulRun = 0;
+        }
+    }
+
+    *pulWidth = ulBestLen;
+    if (ulBestLen == 0U) {
+        *pulCentre = 0;
+        return FROM_CAL_ERROR;
+    }
+    else {
+        *pulCentre = ulBestPos + (ulBestLen / 2U);
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_CalMakePattern                                                             */
+/*                                                                                              */
+/* DESCRIPTION: 校正パターン作成                                                                */
+/*              0x00/0xFF交互、0x55/0xAA交互、ウォーキング1、擬似乱数を32バイト毎に繰り返す     */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulSize                          パターン長                                      */
+/*                                                                                              */
+/* OUTPUT     : pucBuf                          パターン格納バッファ                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+void FROM_CalMakePattern(unsigned char *pucBuf, uint32_t ulSize)
+{
+uint32_t i      = 0;
+uint32_t ulLfsr = 0xACE1U;
+
+    for (i = 0; i < ulSize; i++) {
+        switch ((i / FROM_CAL_PATTERN_BLOCK) % 4U) {
+        case 0:     /* 全ビット反転 */
+            pucBuf[i] = ((i & 1U) == 0U) ? 0x00U : 0xFFU;
+            break;
+        case 1:     /* 隣接ビット反転 */
+            pucBuf[i] = ((i & 1U) == 0U) ? 0x55U : 0xAAU;
+            break;
+        case 2:     /* ウォーキング1 */
+            pucBuf[i] = (unsigned char)(1U << (i % 8U));
+            break;
+        default:    /* 擬似乱数(16bit LFSR) */
+            ulLfsr    = (ulLfsr >> 1) ^ ((0U - (ulLfsr & 1U)) & 0xB400U);
+            pucBuf[i] = (unsigned char)ulLfsr;
+            break;
+        }
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_CalCrc32                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: CRC-32計算                                                                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pvData                          データ                                          */
+/*            : ulSize                          データ長                                        */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : CRC-32値                                                                        */
+/*                                                                                              */
+/************************************************************************************************/
+uint32_t FROM_CalCrc32(const void *pvData, uint32_t ulSize)
+{
+const uint8_t *pucData = (const uint8_t *)pvData;
+uint32_t ulCrc         = 0xFFFFFFFFU;
+uint32_t i             = 0;
+uint32_t j             = 0;
+
+    for (i = 0; i < ulSize; i++) {
+        ulCrc ^= pucData[i];
+        for (j = 0; j < 8U; j++) {
+            ulCrc = (ulCrc >> 1) ^ ((0U - (ulCrc & 1U)) & FROM_CAL_CRC32_POLY);
+        }
+    }
+
+    return ~ulCrc;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_CalSealRecord                                                              */
+/*                                                                                              */
+/* DESCRIPTION: 校正結果レコードの識別子・CRC設定                                               */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptRecord                        校正結果レコード                                */
+/*                                                                                              */
+/* OUTPUT     : ptRecord                        校正結果レコード                                */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+void FROM_CalSealRecord(FROM_CalRecord *ptRecord)
+{
+    ptRecord->ulMagic = FROM_CAL_MAGIC;
+    ptRecord->ulCrc   = FROM_CalCrc32(ptRecord, (uint32_t)offsetof(FROM_CalRecord, ulCrc));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_CalCheckRecord                                                             */
+/*                                                                                              */
+/* DESCRIPTION: 校正結果レコード検査                                                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptRecord                        校正結果レコード                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    有効なレコード                                  */
+/*              FROM_CAL_ERROR                  識別子・CRC不一致(未校正または破損)             */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_CalCheckRecord(const FROM_CalRecord *ptRecord)
+{
+    if ((ptRecord->ulMagic != FROM_CAL_MAGIC) ||
+        (ptRecord->ulCrc   != FROM_CalCrc32(ptRecord, (uint32_t)offsetof(FROM_CalRecord, ulCrc)))) {
+        return FROM_CAL_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return FROM_SUCCESS;
+}
@@ -0,0 +1,1012 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_spiflash_ftl.c                                                      0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      NORドライバ ログ構造FTLソースファイル                                                   */
+/*      (論理ページの更新を消去済みページへの追記とし、RAM上の対応表・GC・ウェアレベリングで    */
+/*       小さな書き換え毎の消去をなくす。OSに依存しないため、ホスト環境でも評価できる)          */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "code_rules_def.h"
+#include "dri_spiflash.h"
+#include "dri_spiflash_local.h"
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+#define FROM_FTL_MAGIC          (0x4C544657U)   /* ブロックヘッダ識別子("WFTL") */
+#define FROM_FTL_BAD_MAGIC      (0x00000000U)   /* 消去エラーブロックの識別子(ヘッダの上書きで記録する) */
+#define FROM_FTL_ERASE_RETRY    (3U)            /* 消去・ヘッダ書き込みエラー時の再試行回数 */
+#define FROM_FTL_NONE           (0xFFFFFFFFU)   /* 未割り当て(消去状態の値) */
+#define FROM_FTL_TAG_SIZE       (4U)            /* ページタグ(論理ページ番号)長 */
+
+/* ブロック状態 */
+#define FROM_FTL_BLK_FREE       (0U)            /* 消去済み(ヘッダのみ) */
+#define FROM_FTL_BLK_OPEN       (1U)            /* 追記中 */
+#define FROM_FTL_BLK_FULL       (2U)            /* 追記完了 */
+#define FROM_FTL_BLK_DIRTY      (3U)            /* 要消去(ヘッダ不正) */
+#define FROM_FTL_BLK_BAD        (4U)            /* 消去・書き込みエラー(以降使用しない) */
+
+/* アドレス算出 */
+#define FROM_FTL_BLK_ADDR(b)    (l_tFtl.tConfig.ulAddress + ((b) * l_tFtl.tConfig.ulBlkSize))
+#define FROM_FTL_PAGE_ADDR(b, p)    (FROM_FTL_BLK_ADDR(b) + (((p) + 1U) * l_tFtl.tConfig.ulPageSize))
+#define FROM_FTL_TAG_ADDR(b, p)     (FROM_FTL_BLK_ADDR(b) + FROM_FTL_HDR_SIZE + ((p) * FROM_FTL_TAG_SIZE))
+
+/****************************************************************************/
+/*  構造体定義                                                              */
+/****************************************************************************/
+
+/* ブロックヘッダ(消去直後に書き込み、ulSeqは追記開始時に書き込む) */
+typedef struct FROM_FtlBlkHdr_tag {
+    uint32_t        ulMagic;        /* FROM_FTL_MAGIC(FROM_FTL_BAD_MAGICは消去エラー) */
+    uint32_t        ulErase;        /* 消去回数 */
+    uint32_t        ulCheck;        /* ulEraseの反転(書き込み途中の電源断検出) */
+    uint32_t        ulSeq;          /* 追記開始順(FROM_FTL_NONEは未使用) */
+} FROM_FtlBlkHdr;
+
+/* FTL情報 */
+typedef struct FROM_FtlInfo_tag {
+    FROM_FtlConfig  tConfig;        /* 設定 */
+    uint32_t        ulMounted;      /* マウント済み(1) */
+    uint32_t        ulBlkNum;       /* ブロック数 */
+    uint32_t        ulPpb;          /* ブロックあたりのデータページ数 */
+    uint32_t        ulLpnNum;       /* 論理ページ数 */
+    uint32_t        ulFree;         /* 消去済みブロック数 */
+    uint32_t        ulSeq;          /* 次に追記を開始するブロックの順番 */
+    uint32_t        ulOpen;         /* 追記中ブロック(FROM_FTL_NONEはなし) */
+    uint32_t        ulWp;           /* 追記中ブロックの次のページ */
+    FROM_FtlStats   tStats;         /* 統計 */
+    uint32_t        ulMap[FROM_FTL_LPN_MAX];        /* 論理→物理ページ(ブロック番号×ulPpb＋ページ) */
+    uint32_t        ulErase[FROM_FTL_BLK_MAX];      /* ブロック毎の消去回数 */
+    uint32_t        ulBlkSeq[FROM_FTL_BLK_MAX];     /* ブロック毎の追記開始順 */
+    uint16_t        usValid[FROM_FTL_BLK_MAX];      /* ブロック毎の有効ページ数 */
+    uint8_t         ucState[FROM_FTL_BLK_MAX];      /* ブロック状態(FROM_FTL_BLK_*) */
+    unsigned char   ucBuf[FROM_FTL_PAGE_SIZE_MAX];  /* ページ移動・ページタグ読み出し用 */
+} FROM_FtlInfo;
+
+/****************************************************************************/
+/*  ローカルデータ                                                          */
+/****************************************************************************/
+
+DLOCAL FROM_FtlInfo l_tFtl;
+
+/****************************************************************************/
+/*  ローカル関数宣言                                                        */
+/****************************************************************************/
+
+/* マウント処理 */
+LOCAL int _FROM_FtlScan(void);
+LOCAL int _FROM_FtlLoadBlock(uint32_t ulBlk);
+
+/* 追記 */
+LOCAL int _FROM_FtlProgram(uint32_t ulLpn, unsigned char *pucData);
+LOCAL int _FROM_FtlPrepare(uint32_t ulForGc);
+LOCAL int _FROM_FtlOpenBlock(void);
+
+/* GC・静的ウェアレベリング */
+LOCAL int _FROM_FtlCollect(void);
+LOCAL int _FROM_FtlLevel(void);
+LOCAL int _FROM_FtlMove(uint32_t ulBlk, uint32_t *pulMoves);
+
+/* 消去 */
+LOCAL int _FROM_FtlEraseBlock(uint32_t ulBlk);
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_FtlMount                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: FTLマウント                                                                     */
+/*              管理領域の全ブロックのヘッダ・ページタグを読み出し、論理→物理ページの           */
+/*              対応表を作成する                                                                */
+/*              (未フォーマットのブロックは消去する、追記中だったブロックは追記完了として扱う)  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptConfig                        FTL設定                                         */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                マウント済み                                    */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*              FROM_EMPTY_ERROR                使用できるブロックが不足                        */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_FtlMount(const FROM_FtlConfig *ptConfig)
+{
+uint32_t ulBlkNum = 0;
+uint32_t ulPpb    = 0;
+int iRet          = FROM_SUCCESS;
+
+    /* パラメータチェック */
+    if ((ptConfig == NULL) || (ptConfig->ptOps == NULL) ||
+        (ptConfig->ptOps->pfnRead == NULL) || (ptConfig->ptOps->pfnWrite == NULL) || (ptConfig->ptOps->pfnErase == NULL) ||
+        (ptConfig->ulPageSize < (FROM_FTL_HDR_SIZE + FROM_FTL_TAG_SIZE)) || (FROM_FTL_PAGE_SIZE_MAX < ptConfig->ulPageSize) ||
+        (ptConfig->ulBlkSize == 0U) || ((ptConfig->ulBlkSize % ptConfig->ulPageSize) != 0U) ||
+        ((ptConfig->ulAddress % ptConfig->ulBlkSize) != 0U) ||
+        (ptConfig->ulSize == 0U) || ((ptConfig->ulSize % ptConfig->ulBlkSize) != 0U)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ulBlkNum = ptConfig->ulSize / ptConfig->ulBlkSize;
+        ulPpb    = (ptConfig->ulBlkSize / ptConfig->ulPageSize) - 1U;  /* 先頭ページはヘッダ */
+    }
+    if ((FROM_FTL_BLK_MAX < ulBlkNum) || (ulPpb == 0U) ||
+        (ptConfig->ulPageSize < (FROM_FTL_HDR_SIZE + (ulPpb * FROM_FTL_TAG_SIZE))) ||  /* ページタグがヘッダページに収まる */
+        (ptConfig->ulReserve < FROM_FTL_RESERVE_MIN) || (ulBlkNum <= ptConfig->ulReserve) ||
+        (FROM_FTL_LPN_MAX < ((ulBlkNum - ptConfig->ulReserve) * ulPpb))) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック */
+    if (l_tFtl.ulMounted != 0U) {
+        return FROM_STATE_ERROR;    /* マウント済み */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* FTL情報初期化(全論理ページ未割り当て) */
+    memset(&l_tFtl, 0, sizeof(l_tFtl));
+    memset(l_tFtl.ulMap, 0xFF, sizeof(l_tFtl.ulMap));
+    l_tFtl.tConfig  = *ptConfig;
+    l_tFtl.ulBlkNum = ulBlkNum;
+    l_tFtl.ulPpb    = ulPpb;
+    l_tFtl.ulLpnNum = (ulBlkNum - ptConfig->ulReserve) * ulPpb;
+    l_tFtl.ulOpen   = FROM_FTL_NONE;
+
+    /* ヘッダ・ページタグ読み出し */
+    iRet = _FROM_FtlScan();
+    if (iRet != FROM_SUCCESS) {
+        return iRet;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 予備ブロックが不足する場合は使用しない(消去・書き込みエラーで減少) */
+    if ((l_tFtl.ulBlkNum - l_tFtl.tStats.ulBadBlks) < (l_tFtl.ulLpnNum / l_tFtl.ulPpb) + FROM_FTL_RESERVE_MIN) {
+        return FROM_EMPTY_ERROR;
+    }
+    else {
+        l_tFtl.ulMounted = 1U;
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_FtlUnmount                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: FTLアンマウント                                                                 */
+/*              全ての書き込みは完了しているため、対応表を破棄するのみ                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_STATE_ERROR                マウントしていない                              */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_FtlUnmount(void)
+{
+    /* 動作状態チェック */
+    if (l_tFtl.ulMounted == 0U) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        l_tFtl.ulMounted = 0U;
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_FtlRead                                                                    */
+/*                                                                                              */
+/* DESCRIPTION: 論理ページ読み出し                                                              */
+/*              未書き込みの論理ページは0xFFを返す                                              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulLpn                           論理ページ番号                                  */
+/*                                                                                              */
+/* OUTPUT     : strReadData                     読み出しデータ格納バッファ(論理ページサイズ)    */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                マウントしていない                              */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_FtlRead(uint32_t ulLpn, unsigned char *strReadData)
+{
+uint32_t ulPpn = FROM_FTL_NONE;
+
+    /* パラメータチェック */
+    if (strReadData == NULL) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック */
+    if (l_tFtl.ulMounted == 0U) {
+        return FROM_STATE_ERROR;
+    }
+    else if (l_tFtl.ulLpnNum <= ulLpn) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ulPpn = l_tFtl.ulMap[ulLpn];
+    }
+
+    if (ulPpn == FROM_FTL_NONE) {
+        memset(strReadData, 0xFF, l_tFtl.tConfig.ulPageSize);
+        return FROM_SUCCESS;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (l_tFtl.tConfig.ptOps->pfnRead(l_tFtl.tConfig.ulDev,
+                                      FROM_FTL_PAGE_ADDR(ulPpn / l_tFtl.ulPpb, ulPpn % l_tFtl.ulPpb),
+                                      l_tFtl.tConfig.ulPageSize, strReadData) != FROM_SUCCESS) {
+        return FROM_READ_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_FtlWrite                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: 論理ページ書き込み                                                              */
+/*              追記中ブロックの次のページへ書き込み、対応表を更新する(旧ページは無効となる)    */
+/*              追記中ブロックが一杯で消去済みブロックが残り1つの場合は、先にGCを行う           */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulLpn                           論理ページ番号                                  */
+/*            : strWriteData                    書き込みデータ(論理ページサイズ)                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                マウントしていない                              */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_ERASE_ERROR                GCの消去エラー                                  */
+/*              FROM_EMPTY_ERROR                GCで空きページを作れない                        */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_FtlWrite(uint32_t ulLpn, unsigned char *strWriteData)
+{
+int iRet = FROM_SUCCESS;
+
+    /* パラメータチェック */
+    if (strWriteData == NULL) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック */
+    if (l_tFtl.ulMounted == 0U) {
+        return FROM_STATE_ERROR;
+    }
+    else if (l_tFtl.ulLpnNum <= ulLpn) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 追記先の確保(必要ならGC・静的ウェアレベリング) */
+    iRet = _FROM_FtlPrepare(0U);
+    if (iRet != FROM_SUCCESS) {
+        return iRet;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 追記 */
+    iRet = _FROM_FtlProgram(ulLpn, strWriteData);
+    if (iRet == FROM_SUCCESS) {
+        l_tFtl.tStats.ulHostWrites++;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_FtlGetStats                                                                */
+/*                                                                                              */
+/* DESCRIPTION: FTL統計取得                                                                     */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : ptStats                         FTL統計                                         */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                マウントしていない                              */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_FtlGetStats(FROM_FtlStats *ptStats)
+{
+uint32_t i = 0;
+
+    /* パラメータチェック */
+    if (ptStats == NULL) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック */
+    if (l_tFtl.ulMounted == 0U) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    *ptStats = l_tFtl.tStats;
+    ptStats->ulLpnNum   = l_tFtl.ulLpnNum;
+    ptStats->ulBlkNum   = l_tFtl.ulBlkNum;
+    ptStats->ulFreeBlks = l_tFtl.ulFree;
+    ptStats->ulEraseMin = FROM_FTL_NONE;
+    ptStats->ulEraseMax = 0U;
+    for (i = 0; i < l_tFtl.ulBlkNum; i++) {
+        if (l_tFtl.ucState[i] == FROM_FTL_BLK_BAD) {
+            continue;
+        }
+        else if (l_tFtl.ulErase[i] < ptStats->ulEraseMin) {
+            ptStats->ulEraseMin = l_tFtl.ulErase[i];
+        }
+        else {
+            ;   /* do nothing */
+        }
+        if (ptStats->ulEraseMax < l_tFtl.ulErase[i]) {
+            ptStats->ulEraseMax = l_tFtl.ulErase[i];
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    if (ptStats->ulEraseMin == FROM_FTL_NONE) {
+        ptStats->ulEraseMin = 0U;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 書き込み増幅率 */
+    if (ptStats->ulHostWrites != 0U) {
+        ptStats->ulWriteAmp = (uint32_t)(((uint64_t)ptStats->ulFlashWrites * 100U) / ptStats->ulHostWrites);
+    }
+    else {
+        ptStats->ulWriteAmp = 0U;
+    }
+
+    return FROM_SUCCESS;
+}
+
+/****************************************************************************/
+/*  ローカル関数                                                            */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlScan                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: 全ブロックのヘッダ読み出し・対応表作成                                          */
+/*              追記開始順の古いブロックから論理ページを登録し、新しい書き込みで上書きする      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_FtlScan(void)
+{
+FROM_FtlBlkHdr tHdr = { 0 };
+uint32_t ulMaxErase = 0;
+uint32_t ulBlk      = 0;
+uint32_t ulNext     = 0;
+uint32_t i          = 0;
+int iRet            = FROM_SUCCESS;
+
+    /* 1.ヘッダ読み出し */
+    for (i = 0; i < l_tFtl.ulBlkNum; i++) {
+        if (l_tFtl.tConfig.ptOps->pfnRead(l_tFtl.tConfig.ulDev, FROM_FTL_BLK_ADDR(i),
+                                          (unsigned int)sizeof(tHdr), (unsigned char *)&tHdr) != FROM_SUCCESS) {
+            return FROM_READ_ERROR;
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        if (tHdr.ulMagic == FROM_FTL_BAD_MAGIC) {
+            l_tFtl.ucState[i] = FROM_FTL_BLK_BAD;       /* 消去エラーを記録したブロック */
+            l_tFtl.tStats.ulBadBlks++;
+        }
+        else if ((tHdr.ulMagic != FROM_FTL_MAGIC) || (tHdr.ulCheck != ~tHdr.ulErase)) {
+            l_tFtl.ucState[i] = FROM_FTL_BLK_DIRTY;     /* 未フォーマット、またはヘッダ書き込み途中 */
+        }
+        else if (tHdr.ulSeq == FROM_FTL_NONE) {
+            l_tFtl.ucState[i] = FROM_FTL_BLK_FREE;
+            l_tFtl.ulErase[i] = tHdr.ulErase;
+            l_tFtl.ulFree++;
+        }
+        else {
+            l_tFtl.ucState[i]  = FROM_FTL_BLK_FULL;     /* 追記中だったブロックも追記完了とする */
+            l_tFtl.ulErase[i]  = tHdr.ulErase;
+            l_tFtl.ulBlkSeq[i] = tHdr.ulSeq;
+            if (l_tFtl.ulSeq <= tHdr.ulSeq) {
+                l_tFtl.ulSeq = tHdr.ulSeq + 1U;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        if ((l_tFtl.ucState[i] != FROM_FTL_BLK_DIRTY) && (ulMaxErase < l_tFtl.ulErase[i])) {
+            ulMaxErase = l_tFtl.ulErase[i];
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    /* 2.追記開始順にページタグを読み出して対応表に登録 */
+    for (ulNext = 0; ulNext < l_tFtl.ulSeq; ) {
+        ulBlk = FROM_FTL_NONE;
+        for (i = 0; i < l_tFtl.ulBlkNum; i++) {
+            if ((l_tFtl.ucState[i] == FROM_FTL_BLK_FULL) && (ulNext <= l_tFtl.ulBlkSeq[i]) &&
+                ((ulBlk == FROM_FTL_NONE) || (l_tFtl.ulBlkSeq[i] < l_tFtl.ulBlkSeq[ulBlk]))) {
+                ulBlk = i;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        if (ulBlk == FROM_FTL_NONE) {
+            break;
+        }
+        else {
+            ulNext = l_tFtl.ulBlkSeq[ulBlk] + 1U;
+        }
+
+        iRet = _FROM_FtlLoadBlock(ulBlk);
+        if (iRet != FROM_SUCCESS) {
+            return iRet;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    /* 3.ヘッダ不正のブロックを消去(消去回数は不明のため既知の最大値とする) */
+    for (i = 0; i < l_tFtl.ulBlkNum; i++) {
+        if (l_tFtl.ucState[i] == FROM_FTL_BLK_DIRTY) {
+            l_tFtl.ulErase[i] = ulMaxErase;
+            (void)_FROM_FtlEraseBlock(i);   /* エラー時はFROM_FTL_BLK_BAD */
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlLoadBlock                                                              */
+/*                                                                                              */
+/* DESCRIPTION: ブロックのページタグを対応表に登録                                              */
+/*              (ページタグはデータ書き込み後に書くため、ページタグのあるページは               */
+/*              書き込み完了している)                                                           */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulBlk                           ブロック番号                                    */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_FtlLoadBlock(uint32_t ulBlk)
+{
+uint32_t ulLpn = 0;
+uint32_t ulOld = 0;
+uint32_t i     = 0;
+
+    if (l_tFtl.tConfig.ptOps->pfnRead(l_tFtl.tConfig.ulDev, FROM_FTL_TAG_ADDR(ulBlk, 0U),
+                                      l_tFtl.ulPpb * FROM_FTL_TAG_SIZE, l_tFtl.ucBuf) != FROM_SUCCESS) {
+        return FROM_READ_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    for (i = 0; i < l_tFtl.ulPpb; i++) {
+        memcpy(&ulLpn, &l_tFtl.ucBuf[i * FROM_FTL_TAG_SIZE], sizeof(ulLpn));
+        if (l_tFtl.ulLpnNum <= ulLpn) {
+            continue;               /* 未書き込み(または範囲外) */
+        }
+        else {
+            ulOld = l_tFtl.ulMap[ulLpn];
+        }
+
+        /* 旧ページを無効化して登録 */
+        if (ulOld != FROM_FTL_NONE) {
+            l_tFtl.usValid[ulOld / l_tFtl.ulPpb]--;
+        }
+        else {
+            ;   /* do nothing */
+        }
+        l_tFtl.ulMap[ulLpn] = (ulBlk * l_tFtl.ulPpb) + i;
+        l_tFtl.usValid[ulBlk]++;
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlProgram                                                                */
+/*                                                                                              */
+/* DESCRIPTION: 1ページ追記                                                                     */
+/*              データ書き込み後にページタグを書き込み、対応表を更新する                        */
+/*              (追記先は確保済みであること)                                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulLpn                           論理ページ番号                                  */
+/*            : pucData                         書き込みデータ                                  */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_FtlProgram(uint32_t ulLpn, unsigned char *pucData)
+{
+uint32_t ulBlk = l_tFtl.ulOpen;
+uint32_t ulPg  = l_tFtl.ulWp;
+uint32_t ulOld = l_tFtl.ulMap[ulLpn];
+uint32_t ulTag = ulLpn;
+
+    /* ページは書き込みの成否によらず消費する */
+    l_tFtl.ulWp++;
+    l_tFtl.tStats.ulFlashWrites++;
+
+    /* 1.データ→2.ページタグ(電源断時はページタグのないページを無視する) */
+    if ((l_tFtl.tConfig.ptOps->pfnWrite(l_tFtl.tConfig.ulDev, FROM_FTL_PAGE_ADDR(ulBlk, ulPg),
+                                        l_tFtl.tConfig.ulPageSize, pucData) != FROM_SUCCESS) ||
+        (l_tFtl.tConfig.ptOps->pfnWrite(l_tFtl.tConfig.ulDev, FROM_FTL_TAG_ADDR(ulBlk, ulPg),
+                                        FROM_FTL_TAG_SIZE, (unsigned char *)&ulTag) != FROM_SUCCESS)) {
+        return FROM_WRITE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 3.対応表更新 */
+    if (ulOld != FROM_FTL_NONE) {
+        l_tFtl.usValid[ulOld / l_tFtl.ulPpb]--;
+    }
+    else {
+        ;   /* do nothing */
+    }
+    l_tFtl.ulMap[ulLpn] = (ulBlk * l_tFtl.ulPpb) + ulPg;
+    l_tFtl.usValid[ulBlk]++;
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlPrepare                                                                */
+/*                                                                                              */
+/* DESCRIPTION: 追記先の確保                                                                    */
+/*              静的ウェアレベリングの後、追記中ブロックに空きがなければ                        */
+/*              新しいブロックで追記を開始する                                                  */
+/*              書き込みは最後の消去済みブロックをGCの移動先として残し、不足時はGCを行う        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulForGc                         GC・静的ウェアレベリングの移動(1)               */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*              FROM_EMPTY_ERROR                空きページを作れない                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_FtlPrepare(uint32_t ulForGc)
+{
+int iRet = FROM_SUCCESS;
+
+    /* 静的ウェアレベリング(書き込み時のみ、移動先の消去済みブロックがある場合) */
+    /* (1ブロック分の移動は消去済みブロック1つで足り、移動元の消去で元に戻る) */
+    if ((ulForGc == 0U) && (l_tFtl.tConfig.ulWearDelta != 0U) && (0U < l_tFtl.ulFree)) {
+        iRet = _FROM_FtlLevel();
+    }
+    else {
+        ;   /* do nothing */
+    }
+    if (iRet != FROM_SUCCESS) {
+        return iRet;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    while ((l_tFtl.ulOpen == FROM_FTL_NONE) || (l_tFtl.ulPpb <= l_tFtl.ulWp)) {
+        /* 追記完了 */
+        if (l_tFtl.ulOpen != FROM_FTL_NONE) {
+            l_tFtl.ucState[l_tFtl.ulOpen] = FROM_FTL_BLK_FULL;
+            l_tFtl.ulOpen = FROM_FTL_NONE;
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        if ((ulForGc != 0U) || (1U < l_tFtl.ulFree)) {
+            /* 新しいブロックで追記開始 */
+            iRet = _FROM_FtlOpenBlock();
+        }
+        else {
+            /* GC(移動先として最後の消去済みブロックを使用し、空きページのある追記中ブロックが残る) */
+            iRet = _FROM_FtlCollect();
+        }
+        if (iRet != FROM_SUCCESS) {
+            return iRet;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlOpenBlock                                                              */
+/*                                                                                              */
+/* DESCRIPTION: 追記開始                                                                        */
+/*              消去済みブロックのうち消去回数が最小のものを選ぶ(動的ウェアレベリング)          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_WRITE_ERROR                ヘッダ書き込みエラー                            */
+/*              FROM_EMPTY_ERROR                消去済みブロックなし                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_FtlOpenBlock(void)
+{
+uint32_t ulBlk = FROM_FTL_NONE;
+uint32_t ulSeq = 0;
+uint32_t i     = 0;
+
+    /* 1.ブロック選択 */
+    for (i = 0; i < l_tFtl.ulBlkNum; i++) {
+        if ((l_tFtl.ucState[i] == FROM_FTL_BLK_FREE) &&
+            ((ulBlk == FROM_FTL_NONE) || (l_tFtl.ulErase[i] < l_tFtl.ulErase[ulBlk]))) {
+            ulBlk = i;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    if (ulBlk == FROM_FTL_NONE) {
+        return FROM_EMPTY_ERROR;
+    }
+    else {
+        l_tFtl.ulFree--;
+    }
+
+    /* 2.追記開始順書き込み(以降、マウント時にページタグを読み出す) */
+    ulSeq = l_tFtl.ulSeq;
+    if (l_tFtl.tConfig.ptOps->pfnWrite(l_tFtl.tConfig.ulDev,
+                                       FROM_FTL_BLK_ADDR(ulBlk) + (uint32_t)offsetof(FROM_FtlBlkHdr, ulSeq),
+                                       (unsigned int)sizeof(ulSeq), (unsigned char *)&ulSeq) != FROM_SUCCESS) {
+        l_tFtl.ucState[ulBlk] = FROM_FTL_BLK_BAD;
+        l_tFtl.tStats.ulBadBlks++;
+        return FROM_WRITE_ERROR;
+    }
+    else {
+        l_tFtl.ulSeq++;
+    }
+
+    l_tFtl.ucState[ulBlk]  = FROM_FTL_BLK_OPEN;
+    l_tFtl.ulBlkSeq[ulBlk] = ulSeq;
+    l_tFtl.usValid[ulBlk]  = 0U;
+    l_tFtl.ulOpen          = ulBlk;
+    l_tFtl.ulWp            = 0U;
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlCollect                                                                */
+/*                                                                                              */
+/* DESCRIPTION: GC                                                                              */
+/*              有効ページ数が最小(同数なら消去回数が最小)の追記完了ブロックを選び、            */
+/*              有効ページを追記中ブロックへ移動して消去する                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*              FROM_EMPTY_ERROR                無効ページのあるブロックなし                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_FtlCollect(void)
+{
+uint32_t ulBlk   = FROM_FTL_NONE;
+uint32_t ulMoves = 0;
+uint32_t i       = 0;
+int iRet         = FROM_SUCCESS;
+
+    /* 1.対象ブロック選択 */
+    for (i = 0; i < l_tFtl.ulBlkNum; i++) {
+        if ((l_tFtl.ucState[i] == FROM_FTL_BLK_FULL) &&
+            ((ulBlk == FROM_FTL_NONE) ||
+             (l_tFtl.usValid[i] < l_tFtl.usValid[ulBlk]) ||
+             ((l_tFtl.usValid[i] == l_tFtl.usValid[ulBlk]) && (l_tFtl.ulErase[i] < l_tFtl.ulErase[ulBlk])))) {
+            ulBlk = i;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    if ((ulBlk == FROM_FTL_NONE) || (l_tFtl.ulPpb <= l_tFtl.usValid[ulBlk])) {
+        return FROM_EMPTY_ERROR;    /* 空きを作れない */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 2.有効ページ移動・消去 */
+    iRet = _FROM_FtlMove(ulBlk, &ulMoves);
+    l_tFtl.tStats.ulGcCount++;
+    l_tFtl.tStats.ulGcMoves += ulMoves;
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlLevel                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: 静的ウェアレベリング                                                            */
+/*              消去回数の差がulWearDeltaを超えたら、消去回数が最小の追記完了ブロック           */
+/*              (更新されないデータ)を移動して消去し、動的ウェアレベリングで再使用させる        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了(移動不要を含む)                        */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_FtlLevel(void)
+{
+uint32_t ulCold  = FROM_FTL_NONE;
+uint32_t ulMax   = 0;
+uint32_t ulMoves = 0;
+uint32_t i       = 0;
+int iRet         = FROM_SUCCESS;
+
+    /* 1.消去回数の最大と、消去回数が最小の追記完了ブロック */
+    for (i = 0; i < l_tFtl.ulBlkNum; i++) {
+        if (l_tFtl.ucState[i] == FROM_FTL_BLK_BAD) {
+            continue;
+        }
+        else if (ulMax < l_tFtl.ulErase[i]) {
+            ulMax = l_tFtl.ulErase[i];
+        }
+        else {
+            ;   /* do nothing */
+        }
+        if ((l_tFtl.ucState[i] == FROM_FTL_BLK_FULL) &&
+            ((ulCold == FROM_FTL_NONE) || (l_tFtl.ulErase[i] < l_tFtl.ulErase[ulCold]))) {
+            ulCold = i;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    if ((ulCold == FROM_FTL_NONE) || ((ulMax - l_tFtl.ulErase[ulCold]) <= l_tFtl.tConfig.ulWearDelta)) {
+        return FROM_SUCCESS;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 2.有効ページ移動・消去 */
+    iRet = _FROM_FtlMove(ulCold, &ulMoves);
+    l_tFtl.tStats.ulWlCount++;
+    l_tFtl.tStats.ulWlMoves += ulMoves;
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlMove                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: ブロックの有効ページ移動・消去                                                  */
+/*              対応表が指しているページのみ追記中ブロックへ移動し、消去する                    */
+/*              (消去前に電源断となっても、追記開始順の新しい移動先が優先される)                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulBlk                           ブロック番号                                    */
+/*                                                                                              */
+/* OUTPUT     : pulMoves                        移動したページ数                                */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_FtlMove(uint32_t ulBlk, uint32_t *pulMoves)
+{
+uint32_t ulTag[FROM_FTL_PAGE_SIZE_MAX / FROM_FTL_TAG_SIZE];
+uint32_t ulPpn = 0;
+uint32_t i     = 0;
+int iRet       = FROM_SUCCESS;
+
+    *pulMoves = 0U;
+
+    /* 1.ページタグ読み出し */
+    if (l_tFtl.tConfig.ptOps->pfnRead(l_tFtl.tConfig.ulDev, FROM_FTL_TAG_ADDR(ulBlk, 0U),
+                                      l_tFtl.ulPpb * FROM_FTL_TAG_SIZE, (unsigned char *)ulTag) != FROM_SUCCESS) {
+        return FROM_READ_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 2.有効ページ移動 */
+    for (i = 0; (i < l_tFtl.ulPpb) && (l_tFtl.usValid[ulBlk] != 0U); i++) {
+        ulPpn = (ulBlk * l_tFtl.ulPpb) + i;
+        if ((l_tFtl.ulLpnNum <= ulTag[i]) || (l_tFtl.ulMap[ulTag[i]] != ulPpn)) {
+            continue;               /* 無効ページ */
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        if (l_tFtl.tConfig.ptOps->pfnRead(l_tFtl.tConfig.ulDev, FROM_FTL_PAGE_ADDR(ulBlk, i),
+                                          l_tFtl.tConfig.ulPageSize, l_tFtl.ucBuf) != FROM_SUCCESS) {
+            return FROM_READ_ERROR;
+        }
+        else {
+            iRet = _FROM_FtlPrepare(1U);
+        }
+        if (iRet == FROM_SUCCESS) {
+            iRet = _FROM_FtlProgram(ulTag[i], l_tFtl.ucBuf);
+        }
+        else {
+            ;   /* do nothing */
+        }
+        if (iRet != FROM_SUCCESS) {
+            return iRet;
+        }
+        else {
+            (*pulMoves)++;
+        }
+    }
+
+    /* 3.消去 */
+    return _FROM_FtlEraseBlock(ulBlk);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlEraseBlock                                                             */
+/*                                                                                              */
+/* DESCRIPTION: ブロック消去                                                                    */
+/*              消去後に消去回数を含むヘッダを書き込み、消去済みとする                          */
+/*              (FROM_FTL_ERASE_RETRY回失敗したら消去エラーをヘッダに記録し、以降使用しない)    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulBlk                           ブロック番号                                    */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_ERASE_ERROR                消去・ヘッダ書き込みエラー                      */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_FtlEraseBlock(uint32_t ulBlk)
+{
+FROM_FtlBlkHdr tHdr = { 0 };
+uint32_t ulBad      = FROM_FTL_BAD_MAGIC;
+uint32_t i          = 0;
+int iRet            = FROM_ERASE_ERROR;
+
+    if (l_tFtl.ucState[ulBlk] == FROM_FTL_BLK_FREE) {
+        l_tFtl.ulFree--;
+    }
+    else {
+        ;   /* do nothing */
+    }
+    l_tFtl.ulErase[ulBlk]++;
+    l_tFtl.usValid[ulBlk] = 0U;
+
+    /* ヘッダ(ulSeqは追記開始時に書き込むため消去状態のまま) */
+    tHdr.ulMagic = FROM_FTL_MAGIC;
+    tHdr.ulErase = l_tFtl.ulErase[ulBlk];
+    tHdr.ulCheck = ~tHdr.ulErase;
+    tHdr.ulSeq   = FROM_FTL_NONE;
+
+    /* 消去・ヘッダ書き込み(一時的なエラーは再試行する) */
+    for (i = 0; (i < FROM_FTL_ERASE_RETRY) && (iRet != FROM_SUCCESS); i++) {
+        l_tFtl.tStats.ulErases++;
+        if ((l_tFtl.tConfig.ptOps->pfnErase(l_tFtl.tConfig.ulDev, FROM_FTL_BLK_ADDR(ulBlk),
+                                            l_tFtl.tConfig.ulBlkSize) == FROM_SUCCESS) &&
+            (l_tFtl.tConfig.ptOps->pfnWrite(l_tFtl.tConfig.ulDev, FROM_FTL_BLK_ADDR(ulBlk),
+                                            (unsigned int)offsetof(FROM_FtlBlkHdr, ulSeq), (unsigned char *)&tHdr) == FROM_SUCCESS)) {
+            iRet = FROM_SUCCESS;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    if (iRet != FROM_SUCCESS) {
+        /* 識別子を上書きして再マウント後も使用しない(書き込めなければ再マウント時に消去し直す) */
+        (void)l_tFtl.tConfig.ptOps->pfnWrite(l_tFtl.tConfig.ulDev, FROM_FTL_BLK_ADDR(ulBlk),
+                                             (unsigned int)sizeof(ulBad), (unsigned char *)&ulBad);
+        l_tFtl.ucState[ulBlk] = FROM_FTL_BLK_BAD;
+        l_tFtl.tStats.ulBadBlks++;
+        return FROM_ERASE_ERROR;
+    }
+    else {
+        l_tFtl.ucState[ulBlk] = FROM_FTL_BLK_FREE;
+        l_tFtl.ulFree++;
+    }
+
+    return FROM_SUCCESS;
+}
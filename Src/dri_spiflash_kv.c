@@ -0,0 +1,1252 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_spiflash_kv.c                                                       0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      NORドライバ キー・バリューストアソースファイル                                          */
+/*      (CRC付きレコードをセクタ単位のページに追記し、RAM上のハッシュ索引で参照する。           */
+/*       値の更新はページプログラムのみで、消去はページが一杯になった時のコンパクションで行う)  */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "code_rules_def.h"
+#include "dri_spiflash.h"
+#include "dri_spiflash_local.h"
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+#define FROM_KV_MAGIC           (0x3153564BU)   /* ページヘッダ識別子("KVS1") */
+#define FROM_KV_NONE            (0xFFFFFFFFU)   /* 未使用(消去状態の値) */
+#define FROM_KV_HDR_SIZE        (16U)           /* ページヘッダ長 */
+#define FROM_KV_CHECK_SIZE      (64U)           /* 消去済み判定・値の比較の読み出し単位 */
+
+/* レコード */
+#define FROM_KV_REC_MAGIC       (0xA55AU)       /* レコード識別子 */
+#define FROM_KV_REC_HDR_SIZE    (12U)           /* レコードヘッダ長 */
+#define FROM_KV_REC_MAX         ((FROM_KV_REC_HDR_SIZE + FROM_KV_KEY_MAX + FROM_KV_VALUE_MAX + 3U) & ~3U)
+#define FROM_KV_REC_LEN(k, v)   ((FROM_KV_REC_HDR_SIZE + (k) + (v) + 3U) & ~3U)     /* 4バイト境界に揃える */
+#define FROM_KV_FLAG_DELETE     (0x01U)         /* 削除(キーのみ) */
+
+/* レコード読み出し結果 */
+#define FROM_KV_REC_OK          (0U)            /* 正常 */
+#define FROM_KV_REC_END         (1U)            /* 追記終端(消去状態) */
+#define FROM_KV_REC_BAD         (2U)            /* 不正(書き込み途中の電源断) */
+#define FROM_KV_REC_ERROR       (3U)            /* 読み出しエラー */
+
+/* ハッシュ索引(オープンアドレス法、サイズは2のべき乗) */
+#define FROM_KV_HASH_SIZE       (FROM_KV_ENTRY_MAX * 2U)
+#define FROM_KV_SLOT_EMPTY      (0U)            /* 未使用 */
+#define FROM_KV_SLOT_USED       (1U)            /* 登録中 */
+#define FROM_KV_SLOT_DELETED    (2U)            /* 削除済み(探索は継続する) */
+
+/* アドレス算出 */
+#define FROM_KV_SECT_ADDR(n)    (l_tKv.tConfig.ulAddress + ((n) * l_tKv.tConfig.ulSectSize))
+
+/****************************************************************************/
+/*  構造体定義                                                              */
+/****************************************************************************/
+
+/* ページヘッダ(消去後、追記開始時に書き込む) */
+typedef struct FROM_KvSectHdr_tag {
+    uint32_t        ulMagic;        /* FROM_KV_MAGIC */
+    uint32_t        ulSeq;          /* 追記開始順 */
+    uint32_t        ulCheck;        /* ulSeqの反転(書き込み途中の電源断検出) */
+    uint32_t        ulReserved;     /* 予約(消去状態のまま) */
+} FROM_KvSectHdr;
+
+/* レコードヘッダ(以降にキー・値が続く) */
+typedef struct FROM_KvRecHdr_tag {
+    uint32_t        ulCrc;          /* usMagic以降(キー・値を含む)のCRC-32 */
+    uint16_t        usMagic;        /* FROM_KV_REC_MAGIC(消去状態は追記終端) */
+    uint8_t         ucKeyLen;       /* キー長 */
+    uint8_t         ucFlags;        /* FROM_KV_FLAG_* */
+    uint16_t        usValLen;       /* 値の長さ */
+    uint16_t        usReserved;     /* 予約 */
+} FROM_KvRecHdr;
+
+/* 索引エントリ */
+typedef struct FROM_KvEntry_tag {
+    char            cKey[FROM_KV_KEY_MAX + 1U];     /* キー */
+    uint32_t        ulAddr;         /* 最新レコードのアドレス */
+    uint16_t        usValLen;       /* 値の長さ */
+    uint8_t         ucKeyLen;       /* キー長 */
+    uint8_t         ucState;        /* FROM_KV_SLOT_* */
+} FROM_KvEntry;
+
+/* キー・バリューストア情報 */
+typedef struct FROM_KvInfo_tag {
+    FROM_KvConfig   tConfig;        /* 設定 */
+    uint32_t        ulMounted;      /* マウント済み(1) */
+    uint32_t        ulSectNum;      /* ページ数 */
+    uint32_t        ulActive;       /* 追記中ページ(FROM_KV_NONEはなし) */
+    uint32_t        ulWp;           /* 追記中ページの次の書き込み位置(ページ内) */
+    uint32_t        ulSeq;          /* 次に追記を開始するページの順番 */
+    uint32_t        ulSectSeq[FROM_KV_SECT_MAX];    /* ページ毎の追記開始順(FROM_KV_NONEは消去済み) */
+    FROM_KvStatus   tStatus;        /* 状態(回数) */
+    FROM_KvEntry    tEntry[FROM_KV_HASH_SIZE];      /* ハッシュ索引 */
+    unsigned char   ucRec[FROM_KV_REC_MAX];         /* レコード作成・読み出し用 */
+    unsigned char   ucChk[FROM_KV_CHECK_SIZE];      /* 消去済み判定・値の比較用 */
+} FROM_KvInfo;
+
+/****************************************************************************/
+/*  ローカルデータ                                                          */
+/****************************************************************************/
+
+DLOCAL FROM_KvInfo l_tKv;
+
+/****************************************************************************/
+/*  ローカル関数宣言                                                        */
+/****************************************************************************/
+
+/* 索引 */
+LOCAL uint32_t _FROM_KvKeyLen(const char *pcKey);
+LOCAL uint32_t _FROM_KvLookup(const char *pcKey, uint32_t ulKeyLen, uint32_t ulInsert);
+LOCAL int _FROM_KvApply(uint32_t ulAddr);
+
+/* レコード */
+LOCAL uint32_t _FROM_KvReadRecord(uint32_t ulAddr, uint32_t ulEnd, uint32_t *pulLen);
+LOCAL uint32_t _FROM_KvMakeRecord(const char *pcKey, uint32_t ulKeyLen, uint8_t ucFlags,
+                                  const unsigned char *pucValue, uint32_t ulLength);
+LOCAL int _FROM_KvAppend(uint32_t ulLen);
+
+/* ページ管理 */
+LOCAL int _FROM_KvReserve(uint32_t ulLen);
+LOCAL int _FROM_KvRotate(void);
+LOCAL int _FROM_KvCompact(uint32_t ulSect);
+LOCAL int _FROM_KvReplay(uint32_t ulSect);
+LOCAL int _FROM_KvEraseSector(uint32_t ulSect);
+LOCAL int _FROM_KvIsBlank(uint32_t ulSect);
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_KvMount                                                                    */
+/*                                                                                              */
+/* DESCRIPTION: キー・バリューストアマウント                                                    */
+/*              全ページのヘッダを読み出し、追記開始順の古いページから                          */
+/*              レコードを読んで索引を作成する(ヘッダのないページは消去済みでなければ消去し、   */
+/*              コンパクション途中の電源断は再実行する)                                         */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptConfig                        キー・バリューストア設定                        */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                マウント済み、デバイス未オープン                */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*              FROM_EMPTY_ERROR                索引・ページの空きなし                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_KvMount(const FROM_KvConfig *ptConfig)
+{
+FROM_KvSectHdr tHdr = { 0 };
+uint32_t ulSectSize = 0;
+uint32_t ulSect     = 0;
+uint32_t ulNext     = 0;
+uint32_t ulFree     = 0;
+uint32_t i          = 0;
+int iRet            = FROM_SUCCESS;
+
+    /* パラメータチェック */
+    if ((ptConfig == NULL) || (FROM_DEV_NUM <= ptConfig->ulDev)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ulSectSize = FROM_GetSectSize(ptConfig->ulDev);
+    }
+
+    /* デバイスのセクタサイズはSFDP・パラレルモードで決まるため、オープン後にマウントする */
+    if (ulSectSize == 0U) {
+        return FROM_STATE_ERROR;    /* デバイス未オープン */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if ((ptConfig->ptOps == NULL) ||
+        (ptConfig->ptOps->pfnRead == NULL) || (ptConfig->ptOps->pfnWrite == NULL) || (ptConfig->ptOps->pfnErase == NULL) ||
+        (ptConfig->ulSectSize == 0U) || ((ptConfig->ulSectSize % ulSectSize) != 0U) ||
+        ((ptConfig->ulAddress % ptConfig->ulSectSize) != 0U) || ((ptConfig->ulSize % ptConfig->ulSectSize) != 0U) ||
+        ((ptConfig->ulSize / ptConfig->ulSectSize) < 2U) || (FROM_KV_SECT_MAX < (ptConfig->ulSize / ptConfig->ulSectSize))) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック */
+    if (l_tKv.ulMounted != 0U) {
+        return FROM_STATE_ERROR;    /* マウント済み */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* キー・バリューストア情報初期化(索引は空) */
+    memset(&l_tKv, 0, sizeof(l_tKv));
+    l_tKv.tConfig   = *ptConfig;
+    l_tKv.ulSectNum = ptConfig->ulSize / ptConfig->ulSectSize;
+    l_tKv.ulActive  = FROM_KV_NONE;
+
+    /* 1.ページヘッダ読み出し */
+    for (i = 0; i < l_tKv.ulSectNum; i++) {
+        if (l_tKv.tConfig.ptOps->pfnRead(l_tKv.tConfig.ulDev, FROM_KV_SECT_ADDR(i),
+                                         (unsigned int)sizeof(tHdr), (unsigned char *)&tHdr) != FROM_SUCCESS) {
+            return FROM_READ_ERROR;
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        if ((tHdr.ulMagic == FROM_KV_MAGIC) && (tHdr.ulCheck == ~tHdr.ulSeq) && (tHdr.ulSeq != FROM_KV_NONE)) {
+            l_tKv.ulSectSeq[i] = tHdr.ulSeq;
+            if (l_tKv.ulSeq <= tHdr.ulSeq) {
+                l_tKv.ulSeq = tHdr.ulSeq + 1U;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        else {
+            /* 消去済み(消去途中の電源断に備え、消去済みでなければ消去する) */
+            l_tKv.ulSectSeq[i] = FROM_KV_NONE;
+            iRet = _FROM_KvIsBlank(i);
+            if (iRet == FROM_EMPTY_ERROR) {
+                iRet = _FROM_KvEraseSector(i);
+            }
+            else {
+                ;   /* do nothing */
+            }
+            if (iRet != FROM_SUCCESS) {
+                return iRet;
+            }
+            else {
+                ulFree++;
+            }
+        }
+    }
+
+    /* 2.追記開始順にレコードを読み出して索引に登録(最後のページが追記中ページ) */
+    for (ulNext = 0; ; ) {
+        ulSect = FROM_KV_NONE;
+        for (i = 0; i < l_tKv.ulSectNum; i++) {
+            if ((l_tKv.ulSectSeq[i] != FROM_KV_NONE) && (ulNext <= l_tKv.ulSectSeq[i]) &&
+                ((ulSect == FROM_KV_NONE) || (l_tKv.ulSectSeq[i] < l_tKv.ulSectSeq[ulSect]))) {
+                ulSect = i;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        if (ulSect == FROM_KV_NONE) {
+            break;
+        }
+        else {
+            ulNext = l_tKv.ulSectSeq[ulSect] + 1U;
+        }
+
+        iRet = _FROM_KvReplay(ulSect);
+        if (iRet != FROM_SUCCESS) {
+            return iRet;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    /* 3.消去済みページがなければコンパクションを再実行(常に1ページ空けておく) */
+    if ((ulFree == 0U) && (l_tKv.ulActive != FROM_KV_NONE)) {
+        ulSect = FROM_KV_NONE;
+        for (i = 0; i < l_tKv.ulSectNum; i++) {
+            if ((i != l_tKv.ulActive) &&
+                ((ulSect == FROM_KV_NONE) || (l_tKv.ulSectSeq[i] < l_tKv.ulSectSeq[ulSect]))) {
+                ulSect = i;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        iRet = _FROM_KvCompact(ulSect);
+        if (iRet != FROM_SUCCESS) {
+            return iRet;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    l_tKv.ulMounted = 1U;
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_KvUnmount                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: キー・バリューストアアンマウント                                                */
+/*              全ての書き込みは完了しているため、索引を破棄するのみ                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_STATE_ERROR                マウントしていない                              */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_KvUnmount(void)
+{
+    /* 動作状態チェック */
+    if (l_tKv.ulMounted == 0U) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        l_tKv.ulMounted = 0U;
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_KvGet                                                                      */
+/*                                                                                              */
+/* DESCRIPTION: 値の読み出し                                                                    */
+/*              索引から最新レコードの位置を求め、値のみ読み出す                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pcKey                           キー(終端文字付き)                              */
+/*            : ulSize                          読み出しデータ格納バッファのサイズ              */
+/*                                                                                              */
+/* OUTPUT     : strReadData                     読み出しデータ格納バッファ                      */
+/*            : pulLength                       値の長さ(NULL可、バッファ不足時も設定する)      */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある(バッファ不足を含む)      */
+/*              FROM_STATE_ERROR                マウントしていない                              */
+/*              FROM_NOENT_ERROR                キーが登録されていない                          */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_KvGet(const char *pcKey, unsigned char *strReadData, uint32_t ulSize, uint32_t *pulLength)
+{
+const FROM_KvEntry *ptEntry = NULL;
+uint32_t ulKeyLen           = _FROM_KvKeyLen(pcKey);
+uint32_t ulSlot             = FROM_KV_NONE;
+
+    /* パラメータチェック */
+    if ((ulKeyLen == 0U) || ((strReadData == NULL) && (ulSize != 0U))) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック */
+    if (l_tKv.ulMounted == 0U) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        ulSlot = _FROM_KvLookup(pcKey, ulKeyLen, 0U);
+    }
+
+    if (ulSlot == FROM_KV_NONE) {
+        return FROM_NOENT_ERROR;
+    }
+    else {
+        ptEntry = &l_tKv.tEntry[ulSlot];
+    }
+    if (pulLength != NULL) {
+        *pulLength = ptEntry->usValLen;
+    }
+    else {
+        ;   /* do nothing */
+    }
+    if (ulSize < ptEntry->usValLen) {
+        return FROM_PARAM_ERROR;    /* バッファ不足 */
+    }
+    else if (ptEntry->usValLen == 0U) {
+        return FROM_SUCCESS;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (l_tKv.tConfig.ptOps->pfnRead(l_tKv.tConfig.ulDev, ptEntry->ulAddr + FROM_KV_REC_HDR_SIZE + ptEntry->ucKeyLen,
+                                     ptEntry->usValLen, strReadData) != FROM_SUCCESS) {
+        return FROM_READ_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_KvSet                                                                      */
+/*                                                                                              */
+/* DESCRIPTION: 値の書き込み                                                                    */
+/*              レコードを追記中ページに追記する(値が同じ場合は書き込まない)                    */
+/*              追記中ページに入らなければ次のページへ移り、                                    */
+/*              必要なら最も古いページをコンパクションする                                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pcKey                           キー(終端文字付き、FROM_KV_KEY_MAX文字まで)     */
+/*            : strWriteData                    値                                              */
+/*            : ulLength                        値の長さ(FROM_KV_VALUE_MAXまで)                 */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                マウントしていない                              */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*              FROM_EMPTY_ERROR                索引・ページの空きなし                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_KvSet(const char *pcKey, unsigned char *strWriteData, uint32_t ulLength)
+{
+const FROM_KvEntry *ptEntry = NULL;
+uint32_t ulKeyLen           = _FROM_KvKeyLen(pcKey);
+uint32_t ulSlot             = FROM_KV_NONE;
+uint32_t ulOffset           = 0;
+uint32_t ulSize             = 0;
+int iRet                    = FROM_SUCCESS;
+
+    /* パラメータチェック */
+    if ((ulKeyLen == 0U) || (FROM_KV_VALUE_MAX < ulLength) || ((strWriteData == NULL) && (ulLength != 0U))) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック */
+    if (l_tKv.ulMounted == 0U) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        ulSlot = _FROM_KvLookup(pcKey, ulKeyLen, 0U);
+    }
+
+    /* 1.値が同じなら書き込まない(起動毎の同じ値の設定で追記しない) */
+    if (ulSlot == FROM_KV_NONE) {
+        if (FROM_KV_ENTRY_MAX <= l_tKv.tStatus.ulKeys) {
+            return FROM_EMPTY_ERROR;    /* 索引の空きなし */
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    else if (l_tKv.tEntry[ulSlot].usValLen == ulLength) {
+        ptEntry = &l_tKv.tEntry[ulSlot];
+        for (ulOffset = 0; ulOffset < ulLength; ulOffset += ulSize) {
+            ulSize = ulLength - ulOffset;
+            ulSize = (FROM_KV_CHECK_SIZE < ulSize) ? FROM_KV_CHECK_SIZE : ulSize;
+            if (l_tKv.tConfig.ptOps->pfnRead(l_tKv.tConfig.ulDev,
+                                             ptEntry->ulAddr + FROM_KV_REC_HDR_SIZE + ptEntry->ucKeyLen + ulOffset,
+                                             ulSize, l_tKv.ucChk) != FROM_SUCCESS) {
+                return FROM_READ_ERROR;
+            }
+            else if (memcmp(l_tKv.ucChk, &strWriteData[ulOffset], ulSize) != 0) {
+                break;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        if (ulLength <= ulOffset) {
+            l_tKv.tStatus.ulSkips++;
+            return FROM_SUCCESS;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 2.追記先の確保(コンパクションでレコードバッファを使用するため、先に行う) */
+    iRet = _FROM_KvReserve(FROM_KV_REC_LEN(ulKeyLen, ulLength));
+    if (iRet != FROM_SUCCESS) {
+        return iRet;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 3.追記 */
+    iRet = _FROM_KvAppend(_FROM_KvMakeRecord(pcKey, ulKeyLen, 0U, strWriteData, ulLength));
+    if (iRet == FROM_SUCCESS) {
+        l_tKv.tStatus.ulWrites++;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_KvDelete                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: キーの削除                                                                      */
+/*              削除レコード(キーのみ)を追記する                                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pcKey                           キー(終端文字付き)                              */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                マウントしていない                              */
+/*              FROM_NOENT_ERROR                キーが登録されていない                          */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*              FROM_EMPTY_ERROR                ページの空きなし                                */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_KvDelete(const char *pcKey)
+{
+uint32_t ulKeyLen = _FROM_KvKeyLen(pcKey);
+int iRet          = FROM_SUCCESS;
+
+    /* パラメータチェック */
+    if (ulKeyLen == 0U) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック */
+    if (l_tKv.ulMounted == 0U) {
+        return FROM_STATE_ERROR;
+    }
+    else if (_FROM_KvLookup(pcKey, ulKeyLen, 0U) == FROM_KV_NONE) {
+        return FROM_NOENT_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 追記先の確保・追記 */
+    iRet = _FROM_KvReserve(FROM_KV_REC_LEN(ulKeyLen, 0U));
+    if (iRet == FROM_SUCCESS) {
+        iRet = _FROM_KvAppend(_FROM_KvMakeRecord(pcKey, ulKeyLen, FROM_KV_FLAG_DELETE, NULL, 0U));
+    }
+    else {
+        ;   /* do nothing */
+    }
+    if (iRet == FROM_SUCCESS) {
+        l_tKv.tStatus.ulWrites++;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_KvGetStatus                                                                */
+/*                                                                                              */
+/* DESCRIPTION: キー・バリューストア状態取得                                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : ptStatus                        キー・バリューストア状態                        */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                マウントしていない                              */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_KvGetStatus(FROM_KvStatus *ptStatus)
+{
+uint32_t i = 0;
+
+    /* パラメータチェック */
+    if (ptStatus == NULL) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック */
+    if (l_tKv.ulMounted == 0U) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    *ptStatus = l_tKv.tStatus;
+    ptStatus->ulSectNum   = l_tKv.ulSectNum;
+    ptStatus->ulFreeSects = 0U;
+    for (i = 0; i < l_tKv.ulSectNum; i++) {
+        if (l_tKv.ulSectSeq[i] == FROM_KV_NONE) {
+            ptStatus->ulFreeSects++;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    ptStatus->ulFreeBytes = (l_tKv.ulActive != FROM_KV_NONE) ? (l_tKv.tConfig.ulSectSize - l_tKv.ulWp) : 0U;
+
+    return FROM_SUCCESS;
+}
+
+/****************************************************************************/
+/*  ローカル関数                                                            */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvKeyLen                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: キー長取得                                                                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pcKey                           キー                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : キー長                             0はNULL・空・FROM_KV_KEY_MAX超過             */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_KvKeyLen(const char *pcKey)
+{
+uint32_t ulLen = 0;
+
+    if (pcKey == NULL) {
+        return 0U;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    while ((ulLen <= FROM_KV_KEY_MAX) && (pcKey[ulLen] != '\0')) {
+        ulLen++;
+    }
+
+    return (ulLen <= FROM_KV_KEY_MAX) ? ulLen : 0U;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvLookup                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: 索引検索                                                                        */
+/*              キーのハッシュ値(FNV-1a)の位置から線形探索する                                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pcKey                           キー                                            */
+/*            : ulKeyLen                        キー長                                          */
+/*            : ulInsert                        未登録時に登録先を返す(1)                       */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 索引位置                                                                        */
+/*              FROM_KV_NONE                    未登録(ulInsert=1の場合は索引の空きなし)        */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_KvLookup(const char *pcKey, uint32_t ulKeyLen, uint32_t ulInsert)
+{
+const FROM_KvEntry *ptEntry = NULL;
+uint32_t ulHash             = 0x811C9DC5U;      /* FNV-1a(32bit) */
+uint32_t ulFree             = FROM_KV_NONE;
+uint32_t ulSlot             = 0;
+uint32_t i                  = 0;
+
+    for (i = 0; i < ulKeyLen; i++) {
+        ulHash = (ulHash ^ (uint8_t)pcKey[i]) * 0x01000193U;
+    }
+
+    ulSlot = ulHash & (FROM_KV_HASH_SIZE - 1U);
+    for (i = 0; i < FROM_KV_HASH_SIZE; i++) {
+        ptEntry = &l_tKv.tEntry[ulSlot];
+        if (ptEntry->ucState == FROM_KV_SLOT_EMPTY) {
+            ulFree = (ulFree == FROM_KV_NONE) ? ulSlot : ulFree;
+            break;
+        }
+        else if (ptEntry->ucState == FROM_KV_SLOT_DELETED) {
+            ulFree = (ulFree == FROM_KV_NONE) ? ulSlot : ulFree;
+        }
+        else if ((ptEntry->ucKeyLen == ulKeyLen) && (memcmp(ptEntry->cKey, pcKey, ulKeyLen) == 0)) {
+            return ulSlot;
+        }
+        else {
+            ;   /* do nothing */
+        }
+        ulSlot = (ulSlot + 1U) & (FROM_KV_HASH_SIZE - 1U);
+    }
+
+    return (ulInsert != 0U) ? ulFree : FROM_KV_NONE;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvApply                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: レコードを索引に反映                                                            */
+/*              レコードバッファ上のレコードで登録・削除する                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulAddr                          レコードのアドレス                              */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_EMPTY_ERROR                索引の空きなし                                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_KvApply(uint32_t ulAddr)
+{
+FROM_KvRecHdr tRec   = { 0 };
+FROM_KvEntry *ptEntry = NULL;
+const char *pcKey    = (const char *)&l_tKv.ucRec[FROM_KV_REC_HDR_SIZE];
+uint32_t ulSlot      = FROM_KV_NONE;
+
+    memcpy(&tRec, l_tKv.ucRec, sizeof(tRec));
+
+    /* 削除 */
+    if ((tRec.ucFlags & FROM_KV_FLAG_DELETE) != 0U) {
+        ulSlot = _FROM_KvLookup(pcKey, tRec.ucKeyLen, 0U);
+        if (ulSlot != FROM_KV_NONE) {
+            l_tKv.tEntry[ulSlot].ucState = FROM_KV_SLOT_DELETED;
+            l_tKv.tStatus.ulKeys--;
+        }
+        else {
+            ;   /* do nothing */
+        }
+        return FROM_SUCCESS;
+    }
+    else {
+        ulSlot = _FROM_KvLookup(pcKey, tRec.ucKeyLen, 1U);
+    }
+
+    /* 登録・更新 */
+    if (ulSlot == FROM_KV_NONE) {
+        return FROM_EMPTY_ERROR;
+    }
+    else {
+        ptEntry = &l_tKv.tEntry[ulSlot];
+    }
+    if (ptEntry->ucState != FROM_KV_SLOT_USED) {
+        if (FROM_KV_ENTRY_MAX <= l_tKv.tStatus.ulKeys) {
+            return FROM_EMPTY_ERROR;
+        }
+        else {
+            memset(ptEntry->cKey, 0, sizeof(ptEntry->cKey));
+            memcpy(ptEntry->cKey, pcKey, tRec.ucKeyLen);
+            ptEntry->ucKeyLen = tRec.ucKeyLen;
+            ptEntry->ucState  = FROM_KV_SLOT_USED;
+            l_tKv.tStatus.ulKeys++;
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+    ptEntry->ulAddr   = ulAddr;
+    ptEntry->usValLen = tRec.usValLen;
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvReadRecord                                                              */
+/*                                                                                              */
+/* DESCRIPTION: レコード読み出し・検査                                                          */
+/*              レコードバッファに読み出し、識別子・長さ・CRCを検査する                         */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulAddr                          レコードのアドレス                              */
+/*            : ulEnd                           ページ終端のアドレス                            */
+/*                                                                                              */
+/* OUTPUT     : pulLen                          レコード長(4バイト境界)                         */
+/*                                                                                              */
+/* RESULTS    : FROM_KV_REC_OK                  正常                                            */
+/*              FROM_KV_REC_END                 追記終端(ヘッダが消去状態、またはページ終端)    */
+/*              FROM_KV_REC_BAD                 不正(書き込み途中の電源断)                      */
+/*              FROM_KV_REC_ERROR               読み出しエラー                                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_KvReadRecord(uint32_t ulAddr, uint32_t ulEnd, uint32_t *pulLen)
+{
+FROM_KvRecHdr tRec = { 0 };
+uint32_t ulLen     = 0;
+uint32_t i         = 0;
+
+    /* 1.ヘッダ */
+    if ((ulEnd - ulAddr) < FROM_KV_REC_HDR_SIZE) {
+        return FROM_KV_REC_END;     /* ページ終端 */
+    }
+    else if (l_tKv.tConfig.ptOps->pfnRead(l_tKv.tConfig.ulDev, ulAddr, FROM_KV_REC_HDR_SIZE, l_tKv.ucRec) != FROM_SUCCESS) {
+        return FROM_KV_REC_ERROR;
+    }
+    else {
+        memcpy(&tRec, l_tKv.ucRec, sizeof(tRec));
+    }
+
+    /* 消去状態なら追記終端(一部でも書き込まれていれば不正) */
+    for (i = 0; (i < FROM_KV_REC_HDR_SIZE) && (l_tKv.ucRec[i] == 0xFFU); i++) {
+        ;   /* do nothing */
+    }
+    if (i == FROM_KV_REC_HDR_SIZE) {
+        return FROM_KV_REC_END;
+    }
+    else {
+        ulLen = FROM_KV_REC_LEN(tRec.ucKeyLen, tRec.usValLen);
+    }
+
+    if ((tRec.usMagic != FROM_KV_REC_MAGIC) ||
+        (tRec.ucKeyLen == 0U) || (FROM_KV_KEY_MAX < tRec.ucKeyLen) || (FROM_KV_VALUE_MAX < tRec.usValLen) ||
+        ((ulEnd - ulAddr) < ulLen)) {
+        return FROM_KV_REC_BAD;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 2.キー・値、CRC検査 */
+    if (l_tKv.tConfig.ptOps->pfnRead(l_tKv.tConfig.ulDev, ulAddr + FROM_KV_REC_HDR_SIZE,
+                                     ulLen - FROM_KV_REC_HDR_SIZE, &l_tKv.ucRec[FROM_KV_REC_HDR_SIZE]) != FROM_SUCCESS) {
+        return FROM_KV_REC_ERROR;
+    }
+    else if (FROM_CalCrc32(&l_tKv.ucRec[sizeof(tRec.ulCrc)],
+                           (FROM_KV_REC_HDR_SIZE - (uint32_t)sizeof(tRec.ulCrc)) + tRec.ucKeyLen + tRec.usValLen) != tRec.ulCrc) {
+        return FROM_KV_REC_BAD;
+    }
+    else {
+        *pulLen = ulLen;
+    }
+
+    return FROM_KV_REC_OK;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvMakeRecord                                                              */
+/*                                                                                              */
+/* DESCRIPTION: レコード作成(レコードバッファ、4バイト境界までの余りは消去状態とする)           */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pcKey                           キー                                            */
+/*            : ulKeyLen                        キー長                                          */
+/*            : ucFlags                         FROM_KV_FLAG_*                                  */
+/*            : pucValue                        値                                              */
+/*            : ulLength                        値の長さ                                        */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : レコード長                           4バイト境界                                */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_KvMakeRecord(const char *pcKey, uint32_t ulKeyLen, uint8_t ucFlags,
+                                  const unsigned char *pucValue, uint32_t ulLength)
+{
+FROM_KvRecHdr tRec = { 0 };
+uint32_t ulLen     = FROM_KV_REC_LEN(ulKeyLen, ulLength);
+
+    memset(l_tKv.ucRec, 0xFF, ulLen);
+    memcpy(&l_tKv.ucRec[FROM_KV_REC_HDR_SIZE], pcKey, ulKeyLen);
+    if (ulLength != 0U) {
+        memcpy(&l_tKv.ucRec[FROM_KV_REC_HDR_SIZE + ulKeyLen], pucValue, ulLength);
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    tRec.usMagic    = FROM_KV_REC_MAGIC;
+    tRec.ucKeyLen   = (uint8_t)ulKeyLen;
+    tRec.ucFlags    = ucFlags;
+    tRec.usValLen   = (uint16_t)ulLength;
+    tRec.usReserved = 0xFFFFU;
+    memcpy(l_tKv.ucRec, &tRec, sizeof(tRec));
+    tRec.ulCrc = FROM_CalCrc32(&l_tKv.ucRec[sizeof(tRec.ulCrc)],
+                               (FROM_KV_REC_HDR_SIZE - (uint32_t)sizeof(tRec.ulCrc)) + ulKeyLen + ulLength);
+    memcpy(l_tKv.ucRec, &tRec.ulCrc, sizeof(tRec.ulCrc));
+
+    return ulLen;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvAppend                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: レコード追記                                                                    */
+/*              レコードバッファを追記中ページへ書き込み、索引に反映する                        */
+/*              (追記先は確保済みであること)                                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulLen                           レコード長                                      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_EMPTY_ERROR                索引の空きなし                                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_KvAppend(uint32_t ulLen)
+{
+uint32_t ulAddr = FROM_KV_SECT_ADDR(l_tKv.ulActive) + l_tKv.ulWp;
+
+    /* 書き込み(1回の書き込みで、途中の電源断はCRCで検出する) */
+    l_tKv.ulWp += ulLen;
+    if (l_tKv.tConfig.ptOps->pfnWrite(l_tKv.tConfig.ulDev, ulAddr, ulLen, l_tKv.ucRec) != FROM_SUCCESS) {
+        l_tKv.ulWp = l_tKv.tConfig.ulSectSize;  /* 以降このページには追記しない */
+        return FROM_WRITE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return _FROM_KvApply(ulAddr);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvReserve                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: 追記先の確保                                                                    */
+/*              追記中ページに入らなければ次のページへ移る                                      */
+/*              (全ページを一巡しても入らなければ空きなし)                                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulLen                           レコード長                                      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*              FROM_EMPTY_ERROR                ページの空きなし                                */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_KvReserve(uint32_t ulLen)
+{
+uint32_t i = 0;
+int iRet   = FROM_SUCCESS;
+
+    for (i = 0; i <= l_tKv.ulSectNum; i++) {
+        if ((l_tKv.ulActive != FROM_KV_NONE) && (ulLen <= (l_tKv.tConfig.ulSectSize - l_tKv.ulWp))) {
+            return FROM_SUCCESS;
+        }
+        else {
+            iRet = _FROM_KvRotate();
+        }
+        if (iRet != FROM_SUCCESS) {
+            return iRet;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    return FROM_EMPTY_ERROR;        /* 有効なレコードで全ページが一杯 */
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvRotate                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: 追記ページの切り替え                                                            */
+/*              追記中ページの次の消去済みページで追記を開始し、消去済みページが残っていなければ*/
+/*              最も古いページをコンパクションする                                              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*              FROM_EMPTY_ERROR                消去済みページなし                              */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_KvRotate(void)
+{
+FROM_KvSectHdr tHdr = { 0 };
+uint32_t ulSect     = FROM_KV_NONE;
+uint32_t ulOld      = FROM_KV_NONE;
+uint32_t ulStart    = (l_tKv.ulActive == FROM_KV_NONE) ? 0U : (l_tKv.ulActive + 1U);
+uint32_t i          = 0;
+
+    /* 1.消去済みページ選択(追記中ページの次から順に探し、ページを均等に使う) */
+    for (i = 0; i < l_tKv.ulSectNum; i++) {
+        if (l_tKv.ulSectSeq[(ulStart + i) % l_tKv.ulSectNum] == FROM_KV_NONE) {
+            ulSect = (ulStart + i) % l_tKv.ulSectNum;
+            break;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    if (ulSect == FROM_KV_NONE) {
+        return FROM_EMPTY_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 2.ページヘッダ書き込み(以降、マウント時にレコードを読み出す) */
+    tHdr.ulMagic    = FROM_KV_MAGIC;
+    tHdr.ulSeq      = l_tKv.ulSeq;
+    tHdr.ulCheck    = ~tHdr.ulSeq;
+    tHdr.ulReserved = FROM_KV_NONE;
+    if (l_tKv.tConfig.ptOps->pfnWrite(l_tKv.tConfig.ulDev, FROM_KV_SECT_ADDR(ulSect),
+                                      (unsigned int)sizeof(tHdr), (unsigned char *)&tHdr) != FROM_SUCCESS) {
+        return FROM_WRITE_ERROR;
+    }
+    else {
+        l_tKv.ulSectSeq[ulSect] = l_tKv.ulSeq;
+        l_tKv.ulSeq++;
+        l_tKv.ulActive = ulSect;
+        l_tKv.ulWp     = FROM_KV_HDR_SIZE;
+    }
+
+    /* 3.消去済みページが残っていなければ最も古いページをコンパクション */
+    for (i = 0; i < l_tKv.ulSectNum; i++) {
+        if (l_tKv.ulSectSeq[i] == FROM_KV_NONE) {
+            return FROM_SUCCESS;
+        }
+        else if ((i != l_tKv.ulActive) &&
+                 ((ulOld == FROM_KV_NONE) || (l_tKv.ulSectSeq[i] < l_tKv.ulSectSeq[ulOld]))) {
+            ulOld = i;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    return _FROM_KvCompact(ulOld);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvCompact                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: コンパクション                                                                  */
+/*              索引が指しているレコードのみ追記中ページへ移して消去する                        */
+/*              (最も古いページのため、削除レコードは移さない。                                 */
+/*               消去前の電源断はマウント時に再実行する。読み出しエラー、または索引が指す       */
+/*               レコードが残っていれば、全レコードを移していないため消去しない)                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulSect                          ページ番号                                      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*              FROM_WRITE_ERROR                書き込みエラー                                  */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*              FROM_EMPTY_ERROR                追記中ページに入らない                          */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_KvCompact(uint32_t ulSect)
+{
+FROM_KvRecHdr tRec = { 0 };
+uint32_t ulAddr    = FROM_KV_SECT_ADDR(ulSect) + FROM_KV_HDR_SIZE;
+uint32_t ulEnd     = FROM_KV_SECT_ADDR(ulSect) + l_tKv.tConfig.ulSectSize;
+uint32_t ulLen     = 0;
+uint32_t ulSlot    = FROM_KV_NONE;
+uint32_t ulRet     = FROM_KV_REC_OK;
+uint32_t i         = 0;
+int iRet           = FROM_SUCCESS;
+
+    /* 1.有効レコード移動(CRCはアドレスに依存しないため、そのまま書き込む) */
+    for ( ;; ) {
+        ulRet = _FROM_KvReadRecord(ulAddr, ulEnd, &ulLen);
+        if (ulRet == FROM_KV_REC_END) {
+            break;
+        }
+        else if (ulRet == FROM_KV_REC_ERROR) {
+            return FROM_READ_ERROR;     /* 読んでいないレコードが残るため消去しない */
+        }
+        else if (ulRet == FROM_KV_REC_BAD) {
+            /* マウント時と同じく、1レコードの最大長だけ進めて読み直す */
+            ulLen = ((ulEnd - ulAddr) < FROM_KV_REC_MAX) ? (ulEnd - ulAddr) : FROM_KV_REC_MAX;
+        }
+        else {
+            memcpy(&tRec, l_tKv.ucRec, sizeof(tRec));
+            ulSlot = _FROM_KvLookup((const char *)&l_tKv.ucRec[FROM_KV_REC_HDR_SIZE], tRec.ucKeyLen, 0U);
+            if (((tRec.ucFlags & FROM_KV_FLAG_DELETE) == 0U) &&
+                (ulSlot != FROM_KV_NONE) && (l_tKv.tEntry[ulSlot].ulAddr == ulAddr)) {
+                if ((l_tKv.tConfig.ulSectSize - l_tKv.ulWp) < ulLen) {
+                    return FROM_EMPTY_ERROR;
+                }
+                else {
+                    iRet = _FROM_KvAppend(ulLen);
+                }
+                if (iRet != FROM_SUCCESS) {
+                    return iRet;
+                }
+                else {
+                    l_tKv.tStatus.ulCompactMoves++;
+                }
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        ulAddr += ulLen;
+    }
+
+    /* 2.索引が指すレコードが残っていれば消去しない(読み直し位置がずれた不正なレコードの後ろ等) */
+    for (i = 0; i < FROM_KV_HASH_SIZE; i++) {
+        if ((l_tKv.tEntry[i].ucState == FROM_KV_SLOT_USED) &&
+            (FROM_KV_SECT_ADDR(ulSect) <= l_tKv.tEntry[i].ulAddr) && (l_tKv.tEntry[i].ulAddr < ulEnd)) {
+            return FROM_READ_ERROR;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    /* 3.消去 */
+    l_tKv.tStatus.ulCompactions++;
+
+    return _FROM_KvEraseSector(ulSect);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvReplay                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: ページのレコードを索引に登録(マウント時)                                        */
+/*              書き込み途中の電源断で不正なレコードは、1レコードの最大長だけ進めて読み直す     */
+/*              (読み出しエラーは索引が不完全になるため中止する)                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulSect                          ページ番号                                      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*              FROM_EMPTY_ERROR                索引の空きなし                                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_KvReplay(uint32_t ulSect)
+{
+uint32_t ulAddr = FROM_KV_SECT_ADDR(ulSect) + FROM_KV_HDR_SIZE;
+uint32_t ulEnd  = FROM_KV_SECT_ADDR(ulSect) + l_tKv.tConfig.ulSectSize;
+uint32_t ulLen  = 0;
+uint32_t ulRet  = FROM_KV_REC_OK;
+int iRet        = FROM_SUCCESS;
+
+    for ( ;; ) {
+        ulRet = _FROM_KvReadRecord(ulAddr, ulEnd, &ulLen);
+        if (ulRet == FROM_KV_REC_END) {
+            break;
+        }
+        else if (ulRet == FROM_KV_REC_ERROR) {
+            return FROM_READ_ERROR;     /* 索引が不完全になるためマウントを中止する */
+        }
+        else if (ulRet == FROM_KV_REC_BAD) {
+            /* 途中まで書き込まれたのは1レコード分以内のため、最大長だけ進めて読み直す */
+            ulLen = ((ulEnd - ulAddr) < FROM_KV_REC_MAX) ? (ulEnd - ulAddr) : FROM_KV_REC_MAX;
+        }
+        else {
+            iRet = _FROM_KvApply(ulAddr);
+            if (iRet != FROM_SUCCESS) {
+                return iRet;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        ulAddr += ulLen;
+    }
+
+    /* 追記開始順の新しいページを追記中ページとする(不正なレコードがあれば、その読み直し位置から追記) */
+    l_tKv.ulActive = ulSect;
+    l_tKv.ulWp     = ulAddr - FROM_KV_SECT_ADDR(ulSect);
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvEraseSector                                                             */
+/*                                                                                              */
+/* DESCRIPTION: ページ消去(消去済みページとする)                                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulSect                          ページ番号                                      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_ERASE_ERROR                消去エラー                                      */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_KvEraseSector(uint32_t ulSect)
+{
+    l_tKv.tStatus.ulErases++;
+    if (l_tKv.tConfig.ptOps->pfnErase(l_tKv.tConfig.ulDev, FROM_KV_SECT_ADDR(ulSect),
+                                      l_tKv.tConfig.ulSectSize) != FROM_SUCCESS) {
+        return FROM_ERASE_ERROR;
+    }
+    else {
+        l_tKv.ulSectSeq[ulSect] = FROM_KV_NONE;
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvIsBlank                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: 消去済み判定                                                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulSect                          ページ番号                                      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    消去済み                                        */
+/*              FROM_EMPTY_ERROR                消去されていない                                */
+/*              FROM_READ_ERROR                 読み出しエラー                                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_KvIsBlank(uint32_t ulSect)
+{
+uint32_t ulOffset = 0;
+uint32_t i        = 0;
+
+    for (ulOffset = 0; ulOffset < l_tKv.tConfig.ulSectSize; ulOffset += FROM_KV_CHECK_SIZE) {
+        if (l_tKv.tConfig.ptOps->pfnRead(l_tKv.tConfig.ulDev, FROM_KV_SECT_ADDR(ulSect) + ulOffset,
+                                         FROM_KV_CHECK_SIZE, l_tKv.ucChk) != FROM_SUCCESS) {
+            return FROM_READ_ERROR;
+        }
+        else {
+            ;   /* do nothing */
+        }
+        for (i = 0; i < FROM_KV_CHECK_SIZE; i++) {
+            if (l_tKv.ucChk[i] != 0xFFU) {
+                return FROM_EMPTY_ERROR;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+    }
+
+    return FROM_SUCCESS;
+}
@@ -0,0 +1,407 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_spiflash_local.h                                                    0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      NORドライバヘッダファイル(ローカル定義)                                                 */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/17  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+#ifndef _DRI_SPIFLASH_LOCAL_H_
+#define _DRI_SPIFLASH_LOCAL_H_
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+/* 戻り値(dri_spiflash.hの定義に追加) */
+#define FROM_PARAM_ERROR            (-100)  /* パラメータに誤りがある */
+#define FROM_STATE_ERROR            (-101)  /* 動作状態が不正 */
+#define FROM_CLOCK_ERROR            (-102)  /* クロック変更エラー */
+#define FROM_CAL_ERROR              (-103)  /* DLL校正エラー(有効なサンプリング点なし) */
+#define FROM_EMPTY_ERROR            (-104)  /* 消去済みブロックなし */
+#define FROM_SFDP_ERROR             (-105)  /* SFDPなし、または対応できない構成 */
+#define FROM_NOENT_ERROR            (-106)  /* キーが登録されていない */
+
+/* デバイス番号(FROM_*Devの第1引数、従来のFROM_*はFROM_DEV_0に対する操作) */
+#define FROM_DEV_0                  (0U)    /* ポートA1 */
+#define FROM_DEV_1                  (1U)    /* ポートB1 */
+#define FROM_DEV_NUM                (2U)
+
+/* パラレルモード(FROM_DEV_0とFROM_DEV_1を1つのデバイスとしてFROM_DEV_0でアクセスする) */
+#define FROM_PARALLEL_OFF           (0U)    /* 個別アクセス */
+#define FROM_PARALLEL_ON            (1U)    /* 2台同時アクセス(偶数バイトをFROM_DEV_0、奇数バイトをFROM_DEV_1に格納) */
+
+/* デバイス種別(FROM_SetDeviceTypeの引数、オープン前に設定する) */
+#define FROM_DEVICE_QUAD            (0U)    /* Quad SPI(既定) */
+#define FROM_DEVICE_OCTAL_SDR       (1U)    /* Octal SPI SDR(1-8-8) */
+#define FROM_DEVICE_OCTAL_DDR       (2U)    /* Octal SPI DDR(8D-8D-8D) */
+
+/* I/Oモードポリシー(FROM_SetIoModeの引数、オープン前に設定する、Quadデバイスのみ有効) */
+#define FROM_IO_MODE_SPI            (0U)    /* 拡張SPIモードのまま1-4-4で読み出す(既定、モード切り替えなし) */
+#define FROM_IO_MODE_QPI            (1U)    /* Quadモード(4-4-4)で読み出す(書き込み・消去・AHB読み出し時のみ拡張SPIへ戻す) */
+
+/* 読み出し方式(FROM_SetReadModeの引数) */
+#define FROM_READ_MODE_IP           (0U)    /* IPコマンド＋RX FIFO */
+#define FROM_READ_MODE_AHB          (1U)    /* AHB窓からのメモリマップド読み出し(既定、書き込み・消去中はIPコマンド) */
+
+/* 読み出しビューの世代管理(デバイスをこの数の領域に分けて書き込み・消去を記録する) */
+#define FROM_GEN_REGION_NUM         (64U)
+
+/* 完了待ち種別(FROM_GetWaitStatsの引数) */
+#define FROM_WAIT_OP_PROGRAM        (0U)    /* ページプログラム(1ページ以内の書き込み1回毎) */
+#define FROM_WAIT_OP_ERASE_4KB      (1U)    /* セクタ消去 */
+#define FROM_WAIT_OP_ERASE_64KB     (2U)    /* ブロック消去 */
+#define FROM_WAIT_OP_ERASE_32KB     (3U)    /* 32KBブロック消去 */
+#define FROM_WAIT_OP_ERASE_CHIP     (4U)    /* チップ消去 */
+#define FROM_WAIT_OP_NUM            (5U)
+
+/* ページプログラム単位(1デバイスあたり、書き込みはページ境界で分割する) */
+#define FROM_PAGE_SIZE              (256U)
+
+/* 32KBブロック消去単位(1デバイスあたり、FROM_SECT_SIZEとFROM_BLK_SIZEの中間) */
+#define FROM_BLK32_SIZE             (0x8000U)
+
+/* ページ分割書き込み */
+#define FROM_SPLIT_WIDTH_MAX        (2U)    /* 最大インターリーブ単位(パラレルモードのデバイス数) */
+
+/* クロックプロファイル(SCLK周波数) */
+#define FROM_CLK_PROFILE_40MHZ      (0U)    /* 40MHz(内部ループバック) */
+#define FROM_CLK_PROFILE_80MHZ      (1U)    /* 80MHz(DQSループバック、DLL遅延固定) */
+#define FROM_CLK_PROFILE_133MHZ     (2U)    /* 133MHz(DQSループバック、DLL自動調整) */
+#define FROM_CLK_PROFILE_166MHZ     (3U)    /* 166MHz(DQSループバック、DLL自動調整) */
+#define FROM_CLK_PROFILE_50MHZ_DDR  (4U)    /* 50MHz DTR読み出し(DQSループバック、DLL自動調整) */
+#define FROM_CLK_PROFILE_80MHZ_DDR  (5U)    /* 80MHz DTR読み出し(DQSループバック、DLL自動調整) */
+#define FROM_CLK_PROFILE_NUM        (6U)    /* プロファイル数 */
+#define FROM_CLK_PROFILE_DEFAULT    (FROM_CLK_PROFILE_40MHZ)
+
+/* DLL校正(末尾FROM_CAL_SECT_NUMセクタを予約領域とし、アクセス可能サイズから除く) */
+/* (引数はアクセス可能サイズ・セクタ消去単位、パラレルモードでは台数倍の値) */
+#define FROM_CAL_SECT_NUM           (2U)            /* 予約セクタ数 */
+#define FROM_CAL_PATTERN_ADDR(size, sect)   ((uint32_t)(size))                          /* 校正パターン */
+#define FROM_CAL_RECORD_ADDR(size, sect)    ((uint32_t)(size) + (uint32_t)(sect))       /* 校正結果 */
+#define FROM_CAL_PATTERN_SIZE       (128U)          /* 校正パターン長(1回のIP読み出しで取得できる長さ) */
+#define FROM_CAL_MAGIC              (0x324C4143U)   /* 校正結果識別子("CAL2"、プロファイル数変更時は更新する) */
+#define FROM_CAL_OVRDVAL_NUM        (64U)           /* 掃引するDLL遅延セル数(DLLCR.OVRDVAL 0 - 63) */
+#define FROM_CAL_WINDOW_MIN         (3U)            /* 採用する合格ウィンドウの最小幅 */
+
+/* SFDP(JESD216) */
+#define FROM_SFDP_SIGNATURE         (0x50444653U)   /* "SFDP"(リトルエンディアン) */
+#define FROM_SFDP_HDR_SIZE          (8U)            /* SFDPヘッダ長 */
+#define FROM_SFDP_PHDR_SIZE         (8U)            /* パラメータヘッダ長 */
+#define FROM_SFDP_PHDR_MAX          (8U)            /* 検索するパラメータヘッダ数 */
+#define FROM_SFDP_ID_BFPT           (0xFF00U)       /* Basic Flash Parameter Table */
+#define FROM_SFDP_ID_4BAIT          (0xFF84U)       /* 4-Byte Address Instruction Table */
+#define FROM_SFDP_BFPT_DW_MIN       (9U)            /* BFPTの必須DWORD数(JESD216) */
+#define FROM_SFDP_BFPT_DW_MAX       (20U)           /* 解析するBFPTのDWORD数(JESD216D) */
+#define FROM_SFDP_4BAIT_DW_NUM      (2U)            /* 4-Byte Address Instruction TableのDWORD数 */
+
+/* SFDPの消去単位(FROM_SfdpInfoの添字) */
+#define FROM_SFDP_ERASE_4KB         (0U)
+#define FROM_SFDP_ERASE_32KB        (1U)
+#define FROM_SFDP_ERASE_64KB        (2U)
+#define FROM_SFDP_ERASE_NUM         (3U)
+
+/* 消去済みブロックプール */
+#define FROM_POOL_BLK_MAX           (1024U)         /* 管理できる最大ブロック数 */
+
+/* ログ構造FTL(ブロック先頭ページをヘッダ・ページタグとし、以降のページにデータを追記する) */
+#define FROM_FTL_BLK_MAX            (256U)          /* 管理できる最大ブロック数 */
+#define FROM_FTL_LPN_MAX            (4096U)         /* 最大論理ページ数 */
+#define FROM_FTL_PAGE_SIZE_MAX      (1024U)         /* 最大論理ページサイズ */
+#define FROM_FTL_HDR_SIZE           (16U)           /* ブロックヘッダ長(以降にページ毎の論理ページ番号を置く) */
+#define FROM_FTL_RESERVE_MIN        (2U)            /* 予備ブロック数の最小値(GCの移動先1ブロックを含む) */
+
+/* キー・バリューストア(セクタ単位のページにレコードを追記する) */
+#define FROM_KV_SECT_MAX            (16U)           /* 管理できる最大ページ数 */
+#define FROM_KV_KEY_MAX             (15U)           /* キーの最大長(終端文字を除く) */
+#define FROM_KV_VALUE_MAX           (256U)          /* 値の最大長 */
+#define FROM_KV_ENTRY_MAX           (128U)          /* 最大キー数 */
+
+/****************************************************************************/
+/*  構造体定義                                                              */
+/****************************************************************************/
+
+/* 読み出しビュー(AHB窓上のデータを複写せずに参照する) */
+typedef struct FROM_View_tag {
+    const unsigned char *pucData;   /* データ先頭(AHB窓上) */
+    uint32_t        ulLength;       /* データ長 */
+    uint32_t        ulDev;          /* デバイス番号(FROM_DEV_*) */
+    uint32_t        ulAddress;      /* デバイス内アドレス */
+    uint32_t        ulGeneration;   /* 取得時の世代 */
+} FROM_View;
+
+/* 完了待ち統計(完了待ち種別毎、時間はマイクロ秒) */
+typedef struct FROM_WaitStats_tag {
+    uint32_t        ulCount;        /* 完了回数 */
+    uint32_t        ulPredUs;       /* 予測完了時間(実測の移動平均、初期値はデータシート標準値) */
+    uint32_t        ulLastUs;       /* 直近の実測busy時間 */
+    uint32_t        ulMinUs;        /* 最小busy時間 */
+    uint32_t        ulMaxUs;        /* 最大busy時間 */
+    uint32_t        ulPolls;        /* ステータス読み出し回数(累計) */
+    uint32_t        ulTimeouts;     /* タイムアウト回数 */
+    uint32_t        ulSuspends;     /* 読み書きのための中断回数 */
+} FROM_WaitStats;
+
+/* 時刻取得関数(プラットフォーム側で用意する、マイクロ秒単位のフリーランカウンタ値を返す) */
+typedef uint32_t (*FROM_GetTimeFunc)(void);
+
+/* 消去済みブロックプール設定(FROM_PoolCreateの引数) */
+typedef struct FROM_PoolConfig_tag {
+    uint32_t        ulDev;          /* デバイス番号(FROM_DEV_*) */
+    uint32_t        ulAddress;      /* 管理領域の先頭(ブロック境界) */
+    uint32_t        ulSize;         /* 管理領域のサイズ(ブロックサイズの倍数) */
+    uint32_t        ulBlkSize;      /* ブロックサイズ(割り当て・消去単位、セクタの倍数) */
+    uint32_t        ulTskPri;       /* 消去タスクの優先度(書き込みを行うタスクより低くする) */
+    uint32_t        ulStkSize;      /* 消去タスクのスタックサイズ */
+} FROM_PoolConfig;
+
+/* 消去済みブロックプール状態 */
+typedef struct FROM_PoolStatus_tag {
+    uint32_t        ulBlkNum;       /* ブロック数 */
+    uint32_t        ulErased;       /* 消去済み(割り当て可能) */
+    uint32_t        ulDirty;        /* 消去待ち(消去中を含む) */
+    uint32_t        ulUsed;         /* 割り当て中 */
+    uint32_t        ulBad;          /* 消去エラー(以降使用しない) */
+    uint32_t        ulErases;       /* 消去回数(累計) */
+    uint32_t        ulBlankSkips;   /* 消去済みのため消去を省略した回数(累計) */
+} FROM_PoolStatus;
+
+/* FTL・キー・バリューストアのフラッシュ操作(対象機ではFROM_ReadDev・FROM_WriteDev・FROM_EraseDevを指定する) */
+typedef struct FROM_FtlFlashOps_tag {
+    int (*pfnRead)(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strReadData);
+    int (*pfnWrite)(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData);
+    int (*pfnErase)(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength);
+} FROM_FtlFlashOps;
+
+/* FTL設定(FROM_FtlMountの引数) */
+typedef struct FROM_FtlConfig_tag {
+    const FROM_FtlFlashOps *ptOps;  /* フラッシュ操作 */
+    uint32_t        ulDev;          /* デバイス番号(FROM_DEV_*) */
+    uint32_t        ulAddress;      /* 管理領域の先頭(ブロック境界) */
+    uint32_t        ulSize;         /* 管理領域のサイズ(ブロックサイズの倍数) */
+    uint32_t        ulBlkSize;      /* ブロックサイズ(消去単位、セクタの倍数) */
+    uint32_t        ulPageSize;     /* 論理ページサイズ(読み書き単位、ページプログラム単位の約数または倍数) */
+    uint32_t        ulReserve;      /* 予備ブロック数(論理容量に含めない、FROM_FTL_RESERVE_MIN以上) */
+    uint32_t        ulWearDelta;    /* 静的ウェアレベリングを行う消去回数の差(0は行わない) */
+} FROM_FtlConfig;
+
+/* FTL統計 */
+typedef struct FROM_FtlStats_tag {
+    uint32_t        ulLpnNum;       /* 論理ページ数 */
+    uint32_t        ulBlkNum;       /* ブロック数 */
+    uint32_t        ulFreeBlks;     /* 消去済みブロック数 */
+    uint32_t        ulBadBlks;      /* 消去・書き込みエラーブロック数 */
+    uint32_t        ulHostWrites;   /* 論理ページ書き込み回数 */
+    uint32_t        ulFlashWrites;  /* 物理ページ書き込み回数(GC・静的ウェアレベリングの移動を含む) */
+    uint32_t        ulGcCount;      /* GC回数 */
+    uint32_t        ulGcMoves;      /* GCで移動したページ数 */
+    uint32_t        ulWlCount;      /* 静的ウェアレベリング回数 */
+    uint32_t        ulWlMoves;      /* 静的ウェアレベリングで移動したページ数 */
+    uint32_t        ulErases;       /* 消去回数(マウント後の累計) */
+    uint32_t        ulEraseMin;     /* ブロック毎の消去回数の最小(ヘッダに保存した累計) */
+    uint32_t        ulEraseMax;     /* ブロック毎の消去回数の最大 */
+    uint32_t        ulWriteAmp;     /* 書き込み増幅率(ulFlashWrites / ulHostWritesの100倍) */
+} FROM_FtlStats;
+
+/* キー・バリューストア設定(FROM_KvMountの引数) */
+typedef struct FROM_KvConfig_tag {
+    const FROM_FtlFlashOps *ptOps;  /* フラッシュ操作 */
+    uint32_t        ulDev;          /* デバイス番号(FROM_DEV_*) */
+    uint32_t        ulAddress;      /* 管理領域の先頭(ページ境界) */
+    uint32_t        ulSize;         /* 管理領域のサイズ(ページサイズの倍数、2ページ以上) */
+    uint32_t        ulSectSize;     /* ページサイズ(追記・コンパクション単位、セクタの倍数) */
+} FROM_KvConfig;
+
+/* キー・バリューストア状態 */
+typedef struct FROM_KvStatus_tag {
+    uint32_t        ulKeys;         /* 登録キー数 */
+    uint32_t        ulSectNum;      /* ページ数 */
+    uint32_t        ulFreeSects;    /* 消去済みページ数 */
+    uint32_t        ulFreeBytes;    /* 追記中ページの空き */
+    uint32_t        ulWrites;       /* レコード書き込み回数(コンパクションを除く) */
+    uint32_t        ulSkips;        /* 値が同じため書き込みを省略した回数 */
+    uint32_t        ulCompactions;  /* コンパクション回数 */
+    uint32_t        ulCompactMoves; /* コンパクションで移動したレコード数 */
+    uint32_t        ulErases;       /* 消去回数 */
+} FROM_KvStatus;
+
+/* DLL校正結果(クロックプロファイル毎) */
+typedef struct FROM_CalEntry_tag {
+    uint8_t         ucValid;        /* 有効(1)/無効(0) */
+    uint8_t         ucRxClkSrc;     /* RXサンプルクロックソース(FLEXSPI_RXCLKSRC_*) */
+    uint8_t         ucOvrdVal;      /* DLL遅延セル数(合格ウィンドウの中央) */
+    uint8_t         ucWindow;       /* 合格ウィンドウ幅 */
+} FROM_CalEntry;
+
+/* SFDPパラメータテーブル位置 */
+typedef struct FROM_SfdpTable_tag {
+    uint32_t        ulAddr;         /* テーブル先頭(SFDPアドレス) */
+    uint32_t        ulDwNum;        /* DWORD数(0はテーブルなし) */
+} FROM_SfdpTable;
+
+/* SFDP読み出し命令 */
+typedef struct FROM_SfdpRead_tag {
+    uint8_t         ucOpcode;       /* 命令コード(0は非対応) */
+    uint8_t         ucAddrLines;    /* アドレスの線数 */
+    uint8_t         ucDataLines;    /* データの線数 */
+    uint8_t         ucDummy;        /* ダミーサイクル(モードクロックを含む) */
+} FROM_SfdpRead;
+
+/* SFDP解析結果(1デバイスあたり) */
+typedef struct FROM_SfdpInfo_tag {
+    uint32_t        ulSize;         /* 容量(バイト) */
+    uint32_t        ulPageSize;     /* ページプログラム単位 */
+    uint32_t        ulAddrBytes;    /* 命令のアドレス長(3または4バイト) */
+    uint32_t        ulEraseSize[FROM_SFDP_ERASE_NUM];   /* 消去単位(FROM_SFDP_ERASE_*順、0は非対応) */
+    uint8_t         ucEraseOp[FROM_SFDP_ERASE_NUM];     /* 消去命令 */
+    FROM_SfdpRead   tRead;          /* 拡張SPIモードで最速の読み出し */
+    FROM_SfdpRead   tQpiRead;       /* Quadモード(4-4-4)の読み出し */
+    uint8_t         ucEnterQpiOp;   /* Quadモード移行 */
+    uint8_t         ucExitQpiOp;    /* Quadモード解除 */
+    uint8_t         ucProgramOp;    /* ページプログラム */
+    uint8_t         ucProgramLines; /* ページプログラムのデータの線数 */
+    uint8_t         ucSuspendOp;    /* 消去中断(0は非対応) */
+    uint8_t         ucResumeOp;     /* 消去再開 */
+    uint8_t         ucFlagStatus;   /* 完了判定にFlag Status Register(70h)を使用(1) */
+} FROM_SfdpInfo;
+
+/* DLL校正結果レコード(FROM_CAL_RECORD_ADDRに保存) */
+typedef struct FROM_CalRecord_tag {
+    uint32_t        ulMagic;                        /* FROM_CAL_MAGIC */
+    FROM_CalEntry   tEntry[FROM_CLK_PROFILE_NUM];   /* プロファイル毎の校正結果 */
+    uint32_t        ulCrc;                          /* ulMagic - tEntryのCRC-32 */
+} FROM_CalRecord;
+
+/* ページ分割書き込み設定(FROM_SplitWriteの引数) */
+typedef struct FROM_SplitConfig_tag {
+    uint32_t        ulDev;          /* デバイス番号(pfnWriteへ渡す) */
+    uint32_t        ulPageSize;     /* ページプログラム単位(パラレルモードは全デバイス分) */
+    uint32_t        ulWidth;        /* インターリーブ単位(1 - FROM_SPLIT_WIDTH_MAX) */
+    uint32_t        ulChunkMax;     /* 1回の書き込みの最大長(TX FIFO容量) */
+    /* 1回の書き込み(ページ境界を跨がず、アドレス・長さはインターリーブ単位の倍数) */
+    int (*pfnWrite)(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData);
+} FROM_SplitConfig;
+
+/****************************************************************************/
+/*  関数宣言                                                                */
+/****************************************************************************/
+
+/* デバイス指定版(FROM_DEV_*) */
+int FROM_OpenDev(uint32_t ulDev);
+int FROM_CloseDev(uint32_t ulDev);
+int FROM_WriteDev(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData);
+int FROM_ReadDev(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strReadData);
+int FROM_SectorEraseDev(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength);
+int FROM_BlockEraseDev(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength);
+int FROM_EraseDev(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength);
+int FROM_getStateDev(uint32_t ulDev);
+
+/* 消去(FROM_DEV_0、範囲を覆う最少の4KB/32KB/64KB/チップ消去の組み合わせで消去する) */
+int FROM_Erase(unsigned int uiAddress, unsigned int uiLength);
+
+/* AHB窓の先頭アドレス取得(デバイスのメモリマップド読み出し用) */
+uint32_t FROM_GetAhbAddress(uint32_t ulDev);
+
+/* セクタサイズ取得(消去の最小単位、SFDP・パラレルモードで決まる) */
+uint32_t FROM_GetSectSize(uint32_t ulDev);
+
+/* クロックプロファイル設定(全デバイス共通) */
+int FROM_SetClockProfile(uint32_t ulProfile);
+
+/* クロックプロファイル取得 */
+uint32_t FROM_GetClockProfile(void);
+
+/* DLL校正(FROM_DEV_0で掃引し、結果を保存してオープン中の全デバイスに適用する) */
+int FROM_Calibrate(uint32_t ulProfile);
+
+/* パラレルモード設定(FROM_DEV_0・FROM_DEV_1ともにオープン中であること) */
+int FROM_SetParallelMode(uint32_t ulMode);
+
+/* デバイス種別設定(全デバイスがクローズ中であること、Octal時はFROM_DEV_0のみ使用可能) */
+int FROM_SetDeviceType(uint32_t ulType);
+
+/* I/Oモードポリシー設定(全デバイス共通、次回のオープンから有効) */
+int FROM_SetIoMode(uint32_t ulMode);
+
+/* 読み出し方式設定(全デバイス共通) */
+int FROM_SetReadMode(uint32_t ulMode);
+
+/* 読み出しビュー取得(AHB窓上のデータを複写せずに参照する) */
+int FROM_ReadPtr(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, FROM_View *ptView);
+
+/* 読み出しビュー有効判定(参照後に呼び出し、無効なら取得し直すこと) */
+int FROM_IsViewValid(const FROM_View *ptView);
+
+/* 時刻取得関数登録(完了待ち時間の計測に使用、未登録時はシステム時刻(ミリ秒単位)) */
+int FROM_SetTimeHook(FROM_GetTimeFunc pfnGetTime);
+
+/* 完了待ち統計取得 */
+int FROM_GetWaitStats(uint32_t ulOp, FROM_WaitStats *ptStats);
+
+/* 完了待ち統計クリア */
+void FROM_ClearWaitStats(void);
+
+/* SFDP解析結果取得(最初にオープンしたデバイスから読み出した構成、全デバイスに適用する) */
+int FROM_GetSfdpInfo(FROM_SfdpInfo *ptInfo);
+
+/* 校正演算(dri_spiflash_cal.c、ハードウェア・OSに依存しない) */
+int FROM_CalFindWindow(const uint8_t *pucPass, uint32_t ulNum, uint32_t *pulCentre, uint32_t *pulWidth);
+void FROM_CalMakePattern(unsigned char *pucBuf, uint32_t ulSize);
+uint32_t FROM_CalCrc32(const void *pvData, uint32_t ulSize);
+void FROM_CalSealRecord(FROM_CalRecord *ptRecord);
+int FROM_CalCheckRecord(const FROM_CalRecord *ptRecord);
+
+/* SFDP解析(dri_spiflash_sfdp.c、ハードウェア・OSに依存しない) */
+int FROM_SfdpParseHeader(const unsigned char *pucHdr, uint32_t ulLen, FROM_SfdpTable *ptBfpt, FROM_SfdpTable *pt4bait);
+int FROM_SfdpParse(const unsigned char *pucBfpt, uint32_t ulBfptDw,
+                   const unsigned char *puc4bait, uint32_t ul4baitDw, FROM_SfdpInfo *ptInfo);
+
+/* 消去済みブロックプール(dri_spiflash_pool.c、低優先度タスクで解放済みブロックを事前消去する) */
+int FROM_PoolCreate(const FROM_PoolConfig *ptConfig);
+int FROM_PoolReserve(uint32_t ulAddress);
+int FROM_PoolStart(void);
+int FROM_PoolAlloc(uint32_t *pulAddress, int32_t lTmout);
+int FROM_PoolFree(uint32_t ulAddress);
+int FROM_PoolGetStatus(FROM_PoolStatus *ptStatus);
+
+/* ログ構造FTL(dri_spiflash_ftl.c、OSに依存しない、排他は呼び出し側で行う) */
+int FROM_FtlMount(const FROM_FtlConfig *ptConfig);
+int FROM_FtlUnmount(void);
+int FROM_FtlRead(uint32_t ulLpn, unsigned char *strReadData);
+int FROM_FtlWrite(uint32_t ulLpn, unsigned char *strWriteData);
+int FROM_FtlGetStats(FROM_FtlStats *ptStats);
+
+/* キー・バリューストア(dri_spiflash_kv.c、OSに依存しない、排他は呼び出し側で行う) */
+int FROM_KvMount(const FROM_KvConfig *ptConfig);
+int FROM_KvUnmount(void);
+int FROM_KvGet(const char *pcKey, unsigned char *strReadData, uint32_t ulSize, uint32_t *pulLength);
+int FROM_KvSet(const char *pcKey, unsigned char *strWriteData, uint32_t ulLength);
+int FROM_KvDelete(const char *pcKey);
+int FROM_KvGetStatus(FROM_KvStatus *ptStatus);
+
+/* ページ分割書き込み(dri_spiflash_xfer.c、OSに依存しない) */
+int FROM_SplitWrite(const FROM_SplitConfig *ptConfig, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif /* _DRI_SPIFLASH_LOCAL_H_ */
@@ -0,0 +1,681 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_spiflash_pool.c                                                     0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      NORドライバ 消去済みブロックプールソースファイル                                        */
+/*      (低優先度タスクで解放済みブロックを事前に消去し、書き込み時は消去済みブロックを         */
+/*       割り当てる)                                                                            */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/17  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "itron.h"
+#include "kernel.h"
+
+#include "code_rules_def.h"
+#include "dri_spiflash.h"
+#include "dri_spiflash_local.h"
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+/* イベントフラグビット */
+#define FROM_POOL_EVFBIT_DIRTY  (0x00000001U)   /* 消去待ちブロック追加 */
+
+/* ブロック状態 */
+#define FROM_POOL_BLK_DIRTY     (0U)            /* 消去待ち */
+#define FROM_POOL_BLK_ERASING   (1U)            /* 消去中 */
+#define FROM_POOL_BLK_ERASED    (2U)            /* 消去済み(割り当て可能) */
+#define FROM_POOL_BLK_USED      (3U)            /* 割り当て中 */
+#define FROM_POOL_BLK_BAD       (4U)            /* 消去エラー */
+
+#define FROM_POOL_CHECK_SIZE    (256U)          /* 消去済み判定の読み出し単位 */
+#define FROM_POOL_ERASE_RETRY   (3U)            /* 消去エラー時の再試行回数(超えたら消去エラーとする) */
+#define FROM_POOL_RETRY_WAIT    (100)           /* 未オープン時の消去再開待ち時間[ms] */
+
+/****************************************************************************/
+/*  構造体定義                                                              */
+/****************************************************************************/
+
+/* 消去済みブロックプール情報 */
+typedef struct FROM_PoolInfo_tag {
+    FROM_PoolConfig tConfig;        /* 設定 */
+    uint32_t        ulCreated;      /* 作成済み(1) */
+    uint32_t        ulStarted;      /* 消去タスク起動済み(1) */
+    ID              tTskID;         /* 消去タスクID */
+    ID              tFlgID;         /* イベントフラグID(消去タスクの起床) */
+    ID              tSemID;         /* セマフォID(資源数は消去済みブロック数) */
+    uint32_t        ulBlkNum;       /* ブロック数 */
+    uint32_t        ulNext;         /* 次に割り当てを探すブロック(消耗の平準化) */
+    uint32_t        ulErases;       /* 消去回数 */
+    uint32_t        ulBlankSkips;   /* 消去省略回数 */
+    volatile uint8_t ucState[FROM_POOL_BLK_MAX];    /* ブロック状態(FROM_POOL_BLK_*) */
+    unsigned char   ucBuf[FROM_POOL_CHECK_SIZE];    /* 消去済み判定用バッファ(消去タスク専用) */
+} FROM_PoolInfo;
+
+/****************************************************************************/
+/*  ローカルデータ                                                          */
+/****************************************************************************/
+
+DLOCAL FROM_PoolInfo l_tPool;
+
+/****************************************************************************/
+/*  ローカル関数宣言                                                        */
+/****************************************************************************/
+
+/* 消去タスク */
+LOCAL void _FROM_PoolTask(VP_INT exinf);
+
+/* 消去待ちブロック選択 */
+LOCAL int _FROM_PoolTakeDirty(uint32_t *pulBlk);
+
+/* ブロック消去 */
+LOCAL uint8_t _FROM_PoolErase(uint32_t ulAddress);
+
+/* 消去済み判定 */
+LOCAL int _FROM_PoolIsBlank(uint32_t ulAddress);
+
+/* アドレス→ブロック番号変換 */
+LOCAL int _FROM_PoolGetBlock(uint32_t ulAddress, uint32_t *pulBlk);
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_PoolCreate                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: 消去済みブロックプール作成                                                      */
+/*              管理領域の全ブロックを消去待ちとし、消去タスクを作成する(起動はFROM_PoolStart)  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptConfig                        プール設定                                      */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                作成済み、デバイス未オープン、OS資源の作成失敗  */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_PoolCreate(const FROM_PoolConfig *ptConfig)
+{
+T_CTSK tCTsk        = { 0 };
+T_CFLG tCFlg        = { 0 };
+T_CSEM tCSem        = { 0 };
+uint32_t ulSectSize = 0;
+
+    /* パラメータチェック */
+    if ((ptConfig == NULL) || (FROM_DEV_NUM <= ptConfig->ulDev)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ulSectSize = FROM_GetSectSize(ptConfig->ulDev);
+    }
+
+    /* デバイスのセクタサイズはSFDP・パラレルモードで決まるため、オープン後に作成する */
+    if (ulSectSize == 0U) {
+        return FROM_STATE_ERROR;    /* デバイス未オープン */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if ((ptConfig->ulBlkSize == 0U) || ((ptConfig->ulBlkSize % ulSectSize) != 0U) ||
+        ((ptConfig->ulAddress % ptConfig->ulBlkSize) != 0U) ||
+        (ptConfig->ulSize == 0U) || ((ptConfig->ulSize % ptConfig->ulBlkSize) != 0U) ||
+        ((ptConfig->ulSize / ptConfig->ulBlkSize) > FROM_POOL_BLK_MAX)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック */
+    if (l_tPool.ulCreated != 0U) {
+        return FROM_STATE_ERROR;    /* 作成済み */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* プール情報初期化(全ブロック消去待ち) */
+    memset(&l_tPool, 0, sizeof(l_tPool));
+    l_tPool.tConfig  = *ptConfig;
+    l_tPool.ulBlkNum = ptConfig->ulSize / ptConfig->ulBlkSize;
+
+    /* イベントフラグ作成 */
+    tCFlg.flgatr  = (TA_TFIFO | TA_WMUL);
+    tCFlg.iflgptn = 0;
+    tCFlg.name    = "FROM Pool Eventflag";
+    l_tPool.tFlgID = acre_flg(&tCFlg);
+    if (l_tPool.tFlgID < E_OK) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* セマフォ作成(資源数は消去済みブロック数) */
+    tCSem.sematr  = (TA_HLNG | TA_TFIFO);
+    tCSem.isemcnt = 0;
+    tCSem.maxsem  = FROM_POOL_BLK_MAX;
+    tCSem.name    = "FROM Pool Semaphore";
+    l_tPool.tSemID = acre_sem(&tCSem);
+    if (l_tPool.tSemID < E_OK) {
+        del_flg(l_tPool.tFlgID);
+        return FROM_STATE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 消去タスク作成(FROM_PoolStartで起動する) */
+    tCTsk.tskatr  = TA_HLNG;
+    tCTsk.exinf   = 0;
+    tCTsk.task    = (FP)_FROM_PoolTask;
+    tCTsk.itskpri = (PRI)ptConfig->ulTskPri;
+    tCTsk.stksz   = ptConfig->ulStkSize;
+    tCTsk.stk     = NULL;
+    tCTsk.name    = "FROM Pool Task";
+    l_tPool.tTskID = acre_tsk(&tCTsk);
+    if (l_tPool.tTskID < E_OK) {
+        del_sem(l_tPool.tSemID);
+        del_flg(l_tPool.tFlgID);
+        return FROM_STATE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    l_tPool.ulCreated = 1U;
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_PoolReserve                                                                */
+/*                                                                                              */
+/* DESCRIPTION: 使用中ブロック登録(FROM_PoolStart前に呼び出す)                                  */
+/*              再起動前から有効なデータを保持しているブロックを割り当て中とし、消去させない    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulAddress                       ブロック内のアドレス                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                管理領域外                                      */
+/*              FROM_STATE_ERROR                未作成、または消去タスク起動済み                */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_PoolReserve(uint32_t ulAddress)
+{
+uint32_t ulBlk = 0;
+
+    /* 動作状態チェック */
+    if ((l_tPool.ulCreated == 0U) || (l_tPool.ulStarted != 0U)) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (_FROM_PoolGetBlock(ulAddress, &ulBlk) != FROM_SUCCESS) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        l_tPool.ucState[ulBlk] = FROM_POOL_BLK_USED;
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_PoolStart                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: 消去タスク起動(消去待ちブロックの事前消去を開始する)                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_STATE_ERROR                未作成、または起動済み                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_PoolStart(void)
+{
+    /* 動作状態チェック */
+    if ((l_tPool.ulCreated == 0U) || (l_tPool.ulStarted != 0U)) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (act_tsk(l_tPool.tTskID) != E_OK) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        l_tPool.ulStarted = 1U;
+    }
+
+    /* 消去待ちブロックの消去開始 */
+    set_flg(l_tPool.tFlgID, FROM_POOL_EVFBIT_DIRTY);
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_PoolAlloc                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: 消去済みブロック割り当て                                                        */
+/*              前回割り当てたブロックの次から探し、消耗を管理領域全体に分散させる              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : lTmout                          空きなし時の待ち時間(TMO_POL/TMO_FEVR可)        */
+/*                                                                                              */
+/* OUTPUT     : pulAddress                      割り当てたブロックの先頭アドレス                */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                未作成                                          */
+/*              FROM_EMPTY_ERROR                消去済みブロックなし(待ち時間経過)              */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_PoolAlloc(uint32_t *pulAddress, int32_t lTmout)
+{
+uint32_t ulBlk = 0;
+uint32_t i     = 0;
+
+    /* パラメータチェック */
+    if (pulAddress == NULL) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック */
+    if (l_tPool.ulCreated == 0U) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 消去済みブロック確保(セマフォの資源数と消去済みブロック数は一致する) */
+    if (twai_sem(l_tPool.tSemID, (TMO)lTmout) != E_OK) {
+        return FROM_EMPTY_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    loc_cpu();
+    for (i = 0; i < l_tPool.ulBlkNum; i++) {
+        ulBlk = (l_tPool.ulNext + i) % l_tPool.ulBlkNum;
+        if (l_tPool.ucState[ulBlk] == FROM_POOL_BLK_ERASED) {
+            l_tPool.ucState[ulBlk] = FROM_POOL_BLK_USED;
+            l_tPool.ulNext         = (ulBlk + 1U) % l_tPool.ulBlkNum;
+            break;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    unl_cpu();
+
+    *pulAddress = l_tPool.tConfig.ulAddress + (ulBlk * l_tPool.tConfig.ulBlkSize);
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_PoolFree                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: ブロック解放(消去待ちとし、消去タスクを起こす)                                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulAddress                       ブロック内のアドレス                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                管理領域外、または割り当て中でない              */
+/*              FROM_STATE_ERROR                未作成                                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_PoolFree(uint32_t ulAddress)
+{
+uint32_t ulBlk = 0;
+int iRet       = FROM_PARAM_ERROR;
+
+    /* 動作状態チェック */
+    if (l_tPool.ulCreated == 0U) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    if (_FROM_PoolGetBlock(ulAddress, &ulBlk) != FROM_SUCCESS) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    loc_cpu();
+    if (l_tPool.ucState[ulBlk] == FROM_POOL_BLK_USED) {
+        l_tPool.ucState[ulBlk] = FROM_POOL_BLK_DIRTY;
+        iRet = FROM_SUCCESS;
+    }
+    else {
+        iRet = FROM_PARAM_ERROR;    /* 割り当て中でない */
+    }
+    unl_cpu();
+
+    if ((iRet == FROM_SUCCESS) && (l_tPool.ulStarted != 0U)) {
+        set_flg(l_tPool.tFlgID, FROM_POOL_EVFBIT_DIRTY);
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_PoolGetStatus                                                              */
+/*                                                                                              */
+/* DESCRIPTION: 消去済みブロックプール状態取得                                                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : ptStatus                        プール状態                                      */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_STATE_ERROR                未作成                                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_PoolGetStatus(FROM_PoolStatus *ptStatus)
+{
+uint32_t i = 0;
+
+    /* パラメータチェック */
+    if (ptStatus == NULL) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 動作状態チェック */
+    if (l_tPool.ulCreated == 0U) {
+        return FROM_STATE_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    memset(ptStatus, 0, sizeof(*ptStatus));
+    ptStatus->ulBlkNum = l_tPool.ulBlkNum;
+
+    loc_cpu();
+    for (i = 0; i < l_tPool.ulBlkNum; i++) {
+        switch (l_tPool.ucState[i]) {
+        case FROM_POOL_BLK_ERASED:
+            ptStatus->ulErased++;
+            break;
+        case FROM_POOL_BLK_USED:
+            ptStatus->ulUsed++;
+            break;
+        case FROM_POOL_BLK_BAD:
+            ptStatus->ulBad++;
+            break;
+        default:
+            ptStatus->ulDirty++;    /* 消去待ち・消去中 */
+            break;
+        }
+    }
+    ptStatus->ulErases     = l_tPool.ulErases;
+    ptStatus->ulBlankSkips = l_tPool.ulBlankSkips;
+    unl_cpu();
+
+    return FROM_SUCCESS;
+}
+
+/****************************************************************************/
+/*  ローカル関数                                                            */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_PoolTask                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: 消去タスク                                                                      */
+/*              消去待ちブロックを1つずつ消去し、消去済みとしてセマフォに返す                   */
+/*              (消去済みのブロックは消去を省略する、消去中の読み書きは消去を中断して実行される)*/
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : exinf                           拡張情報(未使用)                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_PoolTask(VP_INT exinf)
+{
+FLGPTN tFlgPtn    = 0;
+TMO tTmout        = TMO_FEVR;
+uint32_t ulBlk    = 0;
+uint32_t ulAddr   = 0;
+uint8_t ucState   = FROM_POOL_BLK_BAD;
+uint32_t ulErased = 0;
+
+    (void)exinf;
+
+    for ( ;; ) {
+        /* 消去待ちブロック追加待ち(消去を見送ったブロックがあれば待ち時間経過後に再開する) */
+        (void)twai_flg(l_tPool.tFlgID, FROM_POOL_EVFBIT_DIRTY, TWF_ORW, &tFlgPtn, tTmout);
+        clr_flg(l_tPool.tFlgID, ~FROM_POOL_EVFBIT_DIRTY);
+        tTmout = TMO_FEVR;
+
+        /* 消去待ちブロックがなくなるまで消去 */
+        while (_FROM_PoolTakeDirty(&ulBlk) == FROM_SUCCESS) {
+            ulAddr   = l_tPool.tConfig.ulAddress + (ulBlk * l_tPool.tConfig.ulBlkSize);
+            ulErased = 0U;
+
+            if (_FROM_PoolIsBlank(ulAddr) != 0) {
+                ucState  = FROM_POOL_BLK_ERASED;
+                ulErased = 0U;
+            }
+            else {
+                ucState  = _FROM_PoolErase(ulAddr);
+                ulErased = 1U;
+            }
+
+            loc_cpu();
+            l_tPool.ucState[ulBlk] = ucState;
+            if (ucState == FROM_POOL_BLK_DIRTY) {
+                ;   /* do nothing */
+            }
+            else if (ulErased != 0U) {
+                l_tPool.ulErases++;
+            }
+            else {
+                l_tPool.ulBlankSkips++;
+            }
+            unl_cpu();
+
+            if (ucState == FROM_POOL_BLK_ERASED) {
+                sig_sem(l_tPool.tSemID);
+            }
+            else if (ucState == FROM_POOL_BLK_DIRTY) {
+                tTmout = FROM_POOL_RETRY_WAIT;  /* デバイスがオープン中に戻るまで見送る */
+                break;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_PoolTakeDirty                                                             */
+/*                                                                                              */
+/* DESCRIPTION: 消去待ちブロック選択(消去中とする)                                              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : pulBlk                          ブロック番号                                    */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_EMPTY_ERROR                消去待ちブロックなし                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_PoolTakeDirty(uint32_t *pulBlk)
+{
+uint32_t i = 0;
+int iRet   = FROM_EMPTY_ERROR;
+
+    loc_cpu();
+    for (i = 0; i < l_tPool.ulBlkNum; i++) {
+        if (l_tPool.ucState[i] == FROM_POOL_BLK_DIRTY) {
+            l_tPool.ucState[i] = FROM_POOL_BLK_ERASING;
+            *pulBlk = i;
+            iRet    = FROM_SUCCESS;
+            break;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    unl_cpu();
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_PoolErase                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: ブロック消去                                                                    */
+/*              消去エラーはFROM_POOL_ERASE_RETRY回まで再試行する                               */
+/*              (デバイスがオープン中でない場合は消去待ちに戻し、後で再試行する)                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulAddress                       ブロックの先頭アドレス                          */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_POOL_BLK_ERASED            消去済み                                        */
+/*              FROM_POOL_BLK_DIRTY             消去待ち(デバイスがオープン中でない)            */
+/*              FROM_POOL_BLK_BAD               消去エラー(以降は割り当てない)                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint8_t _FROM_PoolErase(uint32_t ulAddress)
+{
+uint32_t i = 0;
+int iState = FROM_NONE_STATE;
+
+    for (i = 0; i < FROM_POOL_ERASE_RETRY; i++) {
+        /* 入出力中のデバイスは消去APIが完了を待つため、失敗はクローズ中・消去エラーのみ */
+        if (FROM_EraseDev(l_tPool.tConfig.ulDev, ulAddress, l_tPool.tConfig.ulBlkSize) == FROM_SUCCESS) {
+            return FROM_POOL_BLK_ERASED;
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        iState = FROM_getStateDev(l_tPool.tConfig.ulDev);
+        if ((iState != FROM_OPEN_STATE) && (iState != FROM_BUSY_STATE)) {
+            return FROM_POOL_BLK_DIRTY;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    return FROM_POOL_BLK_BAD;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_PoolIsBlank                                                               */
+/*                                                                                              */
+/* DESCRIPTION: 消去済み判定(ブロック全体が0xFFなら消去済み)                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulAddress                       ブロックの先頭アドレス                          */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 1                               消去済み                                        */
+/*              0                               消去されていない、または読み出しエラー          */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_PoolIsBlank(uint32_t ulAddress)
+{
+uint32_t ulOffset = 0;
+uint32_t i        = 0;
+
+    for (ulOffset = 0; ulOffset < l_tPool.tConfig.ulBlkSize; ulOffset += FROM_POOL_CHECK_SIZE) {
+        if (FROM_ReadDev(l_tPool.tConfig.ulDev, ulAddress + ulOffset, FROM_POOL_CHECK_SIZE, l_tPool.ucBuf) != FROM_SUCCESS) {
+            return 0;
+        }
+        else {
+            ;   /* do nothing */
+        }
+        for (i = 0; i < FROM_POOL_CHECK_SIZE; i++) {
+            if (l_tPool.ucBuf[i] != 0xFFU) {
+                return 0;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+    }
+
+    return 1;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_PoolGetBlock                                                              */
+/*                                                                                              */
+/* DESCRIPTION: アドレス→ブロック番号変換                                                       */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulAddress                       ブロック内のアドレス                            */
+/*                                                                                              */
+/* OUTPUT     : pulBlk                          ブロック番号                                    */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                管理領域外                                      */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_PoolGetBlock(uint32_t ulAddress, uint32_t *pulBlk)
+{
+    if ((ulAddress < l_tPool.tConfig.ulAddress) ||
+        ((l_tPool.tConfig.ulAddress + l_tPool.tConfig.ulSize) <= ulAddress)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        *pulBlk = (ulAddress - l_tPool.tConfig.ulAddress) / l_tPool.tConfig.ulBlkSize;
+    }
+
+    return FROM_SUCCESS;
+}
@@ -0,0 +1,539 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_spiflash_sfdp.c                                                     0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      NORドライバ SFDP(JESD216)解析ソースファイル                                             */
+/*      (ハードウェア・OSに依存しないため、ホスト環境でも単体で評価できる)                      */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "code_rules_def.h"
+#include "dri_spiflash.h"
+#include "dri_spiflash_local.h"
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+#define FROM_SFDP_ADDR_BYTES_3      (0U)        /* BFPT 1st DWORD[18:17] 3バイトアドレスのみ */
+#define FROM_SFDP_ADDR_BYTES_3OR4   (1U)        /* BFPT 1st DWORD[18:17] 3・4バイトアドレス(既定は3バイト) */
+#define FROM_SFDP_ADDR_3BYTE_MAX    (0x1000000U)    /* 3バイトアドレスで扱える容量 */
+#define FROM_SFDP_ERASE_TYPE_NUM    (4U)        /* BFPTの消去種別数 */
+#define FROM_SFDP_FAST_READ_DUMMY   (8U)        /* Fast Read(1-1-1)のダミーサイクル */
+#define FROM_SFDP_PAGE_DEFAULT      (256U)      /* ページサイズ(JESD216Aより前のBFPT) */
+
+/* 1-1-1 Fast Read */
+#define FROM_SFDP_CMD_FAST_READ     (0x0BU)
+#define FROM_SFDP_4BCMD_FAST_READ   (0x0CU)
+#define FROM_SFDP_4BAIT_FAST_READ   (1U)        /* 4-Byte Address Instruction Table 1st DWORDの対応ビット */
+
+/* ページプログラム */
+#define FROM_SFDP_CMD_PP            (0x02U)     /* Page Program(1-1-1) */
+#define FROM_SFDP_4BCMD_PP          (0x12U)     /* 4-Byte Page Program(1-1-1) */
+#define FROM_SFDP_4BCMD_PP_114      (0x34U)     /* 4-Byte Quad Input Fast Program(1-1-4) */
+#define FROM_SFDP_4BAIT_PP          (6U)
+#define FROM_SFDP_4BAIT_PP_114      (7U)
+#define FROM_SFDP_4BAIT_ERASE_TYPE1 (9U)        /* 消去種別1 - 4の対応ビット(連続) */
+
+/* Quadモード(4-4-4) */
+#define FROM_SFDP_4BCMD_QPI_READ    (0xECU)     /* 4-Byte Quad Input/Output Fast Read */
+#define FROM_SFDP_4BAIT_QPI_READ    (5U)
+#define FROM_SFDP_CMD_ENTER_QPI_38  (0x38U)
+#define FROM_SFDP_CMD_ENTER_QPI_35  (0x35U)
+#define FROM_SFDP_CMD_EXIT_QPI_FF   (0xFFU)
+#define FROM_SFDP_CMD_EXIT_QPI_F5   (0xF5U)
+
+/* n番目(1始まり、JESD216の表記)のDWORD */
+#define FROM_SFDP_DW(p, n)          (_FROM_SfdpGetDw((p), (n)))
+
+/****************************************************************************/
+/*  構造体定義                                                              */
+/****************************************************************************/
+
+/* 読み出し命令候補 */
+typedef struct FROM_SfdpReadCand_tag {
+    uint8_t         ucAddrLines;    /* アドレスの線数 */
+    uint8_t         ucDataLines;    /* データの線数 */
+    uint8_t         ucSupBit;       /* BFPT 1st DWORDの対応ビット */
+    uint8_t         ucParamDw;      /* 命令・ダミーサイクルを格納するBFPTのDWORD */
+    uint8_t         ucParamShift;   /* 同ビット位置(0または16) */
+    uint8_t         uc4bBit;        /* 4-Byte Address Instruction Table 1st DWORDの対応ビット */
+    uint8_t         uc4bOp;         /* 4バイトアドレス命令 */
+} FROM_SfdpReadCand;
+
+/****************************************************************************/
+/*  ローカルデータ                                                          */
+/****************************************************************************/
+
+/* 読み出し命令候補(速い順、いずれも非対応ならFast Read(1-1-1)) */
+DLOCAL const FROM_SfdpReadCand l_tSfdpReadCand[] = {
+    { 4U, 4U, 21U, 3U,  0U, 5U, 0xECU },    /* 1-4-4 */
+    { 1U, 4U, 22U, 3U, 16U, 4U, 0x6CU },    /* 1-1-4 */
+    { 2U, 2U, 20U, 4U, 16U, 3U, 0xBCU },    /* 1-2-2 */
+    { 1U, 2U, 16U, 4U,  0U, 2U, 0x3CU },    /* 1-1-2 */
+};
+
+/****************************************************************************/
+/*  ローカル関数宣言                                                        */
+/****************************************************************************/
+
+/* DWORD取得 */
+LOCAL uint32_t _FROM_SfdpGetDw(const unsigned char *pucTbl, uint32_t ulNo);
+
+/* 読み出し命令設定 */
+LOCAL void _FROM_SfdpSetRead(FROM_SfdpRead *ptRead, uint32_t ulParam, uint8_t ucOpcode,
+                             uint8_t ucAddrLines, uint8_t ucDataLines);
+
+/* 容量・消去単位・ページサイズ取得 */
+LOCAL int _FROM_SfdpParseGeometry(const unsigned char *pucBfpt, uint32_t ulBfptDw,
+                                  const unsigned char *puc4bait, FROM_SfdpInfo *ptInfo);
+
+/* 読み出し命令取得 */
+LOCAL void _FROM_SfdpParseRead(const unsigned char *pucBfpt, uint32_t ulBfptDw,
+                               const unsigned char *puc4bait, FROM_SfdpInfo *ptInfo);
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_SfdpParseHeader                                                            */
+/*                                                                                              */
+/* DESCRIPTION: SFDPヘッダ解析                                                                  */
+/*              BFPT(Basic Flash Parameter Table)と4BAIT(4-Byte Address                         */
+/*              Instruction Table)の位置を求める                                                */
+/*              (BFPTが複数ある場合はDWORD数の多いものを採用する)                               */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pucHdr                          SFDPヘッダ＋パラメータヘッダ(SFDPアドレス0から) */
+/*            : ulLen                           pucHdrの長さ                                    */
+/*                                                                                              */
+/* OUTPUT     : ptBfpt                          BFPTの位置                                      */
+/*            : pt4bait                         4BAITの位置(なければulDwNum=0)                  */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_SFDP_ERROR                 SFDPなし、またはBFPTが短い                      */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_SfdpParseHeader(const unsigned char *pucHdr, uint32_t ulLen, FROM_SfdpTable *ptBfpt, FROM_SfdpTable *pt4bait)
+{
+const unsigned char *pucPhdr = NULL;
+uint32_t ulNum               = 0;
+uint32_t ulId                = 0;
+uint32_t ulDwNum             = 0;
+uint32_t ulAddr              = 0;
+uint32_t i                   = 0;
+
+    /* パラメータチェック */
+    if ((pucHdr  == NULL) ||
+        (ptBfpt  == NULL) ||
+        (pt4bait == NULL) ||
+        (ulLen < (FROM_SFDP_HDR_SIZE + FROM_SFDP_PHDR_SIZE))) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        memset(ptBfpt, 0, sizeof(*ptBfpt));
+        memset(pt4bait, 0, sizeof(*pt4bait));
+    }
+
+    /* 1.シグネチャ・メジャーリビジョン確認 */
+    if ((FROM_SFDP_DW(pucHdr, 1U) != FROM_SFDP_SIGNATURE) || (pucHdr[5] != 1U)) {
+        return FROM_SFDP_ERROR;
+    }
+    else {
+        ulNum = (uint32_t)pucHdr[6] + 1U;   /* パラメータヘッダ数(NPH + 1) */
+    }
+
+    /* 2.パラメータヘッダ検索 */
+    for (i = 0; (i < ulNum) && (i < FROM_SFDP_PHDR_MAX); i++) {
+        if (ulLen < (FROM_SFDP_HDR_SIZE + ((i + 1U) * FROM_SFDP_PHDR_SIZE))) {
+            break;
+        }
+        else {
+            pucPhdr = &pucHdr[FROM_SFDP_HDR_SIZE + (i * FROM_SFDP_PHDR_SIZE)];
+        }
+
+        ulId    = ((uint32_t)pucPhdr[7] << 8) | (uint32_t)pucPhdr[0];
+        ulDwNum = (uint32_t)pucPhdr[3];
+        ulAddr  = ((uint32_t)pucPhdr[6] << 16) | ((uint32_t)pucPhdr[5] << 8) | (uint32_t)pucPhdr[4];
+
+        if ((ulId == FROM_SFDP_ID_BFPT) && (pucPhdr[2] == 1U) && (ptBfpt->ulDwNum < ulDwNum)) {
+            ptBfpt->ulAddr  = ulAddr;
+            ptBfpt->ulDwNum = ulDwNum;
+        }
+        else if ((ulId == FROM_SFDP_ID_4BAIT) && (FROM_SFDP_4BAIT_DW_NUM <= ulDwNum)) {
+            pt4bait->ulAddr  = ulAddr;
+            pt4bait->ulDwNum = FROM_SFDP_4BAIT_DW_NUM;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    /* 3.BFPT必須(容量・消去単位の記述まで) */
+    if (ptBfpt->ulDwNum < FROM_SFDP_BFPT_DW_MIN) {
+        return FROM_SFDP_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_SfdpParse                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: SFDPパラメータテーブル解析                                                      */
+/*              容量・消去単位・ページサイズ、拡張SPIモードで最速の読み出し命令、               */
+/*              Quadモード(4-4-4)の読み出し・移行・解除命令、プログラム命令、                   */
+/*              消去中断命令、完了判定方法を求める                                              */
+/*              4BAITがあれば4バイトアドレス命令、なければ3バイトアドレス命令                   */
+/*              (16MB以下のデバイスのみ)を使用する                                              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pucBfpt                         BFPT                                            */
+/*            : ulBfptDw                        BFPTのDWORD数                                   */
+/*            : puc4bait                        4BAIT(なければNULL)                             */
+/*            : ul4baitDw                       同DWORD数                                       */
+/*                                                                                              */
+/* OUTPUT     : ptInfo                          解析結果                                        */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              FROM_SFDP_ERROR                 対応できない構成(4KB消去なし等)                 */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_SfdpParse(const unsigned char *pucBfpt, uint32_t ulBfptDw,
+                   const unsigned char *puc4bait, uint32_t ul4baitDw, FROM_SfdpInfo *ptInfo)
+{
+uint32_t ul4bSup = 0;
+int iRet         = FROM_SFDP_ERROR;
+
+    /* パラメータチェック */
+    if ((pucBfpt == NULL) ||
+        (ptInfo  == NULL) ||
+        (ulBfptDw < FROM_SFDP_BFPT_DW_MIN)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        memset(ptInfo, 0, sizeof(*ptInfo));
+    }
+
+    if ((puc4bait == NULL) || (ul4baitDw < FROM_SFDP_4BAIT_DW_NUM)) {
+        puc4bait = NULL;
+    }
+    else {
+        ul4bSup = FROM_SFDP_DW(puc4bait, 1U);
+    }
+
+    /* 1.容量・消去単位・ページサイズ */
+    iRet = _FROM_SfdpParseGeometry(pucBfpt, ulBfptDw, puc4bait, ptInfo);
+    if (iRet != FROM_SUCCESS) {
+        return iRet;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 2.ページプログラム(4バイトアドレス命令は1-1-4を優先する) */
+    if (puc4bait == NULL) {
+        ptInfo->ucProgramOp    = FROM_SFDP_CMD_PP;
+        ptInfo->ucProgramLines = 1U;
+    }
+    else if ((ul4bSup & (1UL << FROM_SFDP_4BAIT_PP_114)) != 0U) {
+        ptInfo->ucProgramOp    = FROM_SFDP_4BCMD_PP_114;
+        ptInfo->ucProgramLines = 4U;
+    }
+    else if ((ul4bSup & (1UL << FROM_SFDP_4BAIT_PP)) != 0U) {
+        ptInfo->ucProgramOp    = FROM_SFDP_4BCMD_PP;
+        ptInfo->ucProgramLines = 1U;
+    }
+    else {
+        return FROM_SFDP_ERROR;     /* 4バイトアドレスのプログラム命令なし */
+    }
+
+    /* 3.読み出し命令 */
+    _FROM_SfdpParseRead(pucBfpt, ulBfptDw, puc4bait, ptInfo);
+
+    /* 4.消去中断・再開命令(JESD216A以降、12th DWORD[31]=0で対応) */
+    if ((13U <= ulBfptDw) && ((FROM_SFDP_DW(pucBfpt, 12U) & 0x80000000UL) == 0U)) {
+        ptInfo->ucSuspendOp = (uint8_t)(FROM_SFDP_DW(pucBfpt, 13U) >> 24);
+        ptInfo->ucResumeOp  = (uint8_t)(FROM_SFDP_DW(pucBfpt, 13U) >> 16);
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 5.完了判定(14th DWORD[3]=1ならFlag Status Register、それ以外はStatus RegisterのWIP) */
+    if ((14U <= ulBfptDw) && ((FROM_SFDP_DW(pucBfpt, 14U) & 0x00000008UL) != 0U)) {
+        ptInfo->ucFlagStatus = 1U;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return FROM_SUCCESS;
+}
+
+/****************************************************************************/
+/*  ローカル関数                                                            */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SfdpGetDw                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: DWORD取得(リトルエンディアン)                                                   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pucTbl                          パラメータテーブル                              */
+/*            : ulNo                            DWORD番号(1始まり)                              */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : uint32_t                        DWORD値                                         */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_SfdpGetDw(const unsigned char *pucTbl, uint32_t ulNo)
+{
+const unsigned char *p = &pucTbl[(ulNo - 1U) * 4U];
+
+    return ((uint32_t)p[3] << 24) | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | (uint32_t)p[0];
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SfdpSetRead                                                               */
+/*                                                                                              */
+/* DESCRIPTION: 読み出し命令設定                                                                */
+/*              ダミーサイクルはウェイトステート[4:0]とモードクロック[7:5]の和                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulParam                         BFPTの読み出しパラメータ(16bit)                 */
+/*            : ucOpcode                        命令コード(0はulParam[15:8]を使用)              */
+/*            : ucAddrLines                     アドレスの線数                                  */
+/*            : ucDataLines                     データの線数                                    */
+/*                                                                                              */
+/* OUTPUT     : ptRead                          読み出し命令                                    */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_SfdpSetRead(FROM_SfdpRead *ptRead, uint32_t ulParam, uint8_t ucOpcode,
+                             uint8_t ucAddrLines, uint8_t ucDataLines)
+{
+    ptRead->ucOpcode    = (ucOpcode != 0U) ? ucOpcode : (uint8_t)((ulParam >> 8) & 0xFFU);
+    ptRead->ucAddrLines = ucAddrLines;
+    ptRead->ucDataLines = ucDataLines;
+    ptRead->ucDummy     = (uint8_t)((ulParam & 0x1FU) + ((ulParam >> 5) & 0x07U));
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SfdpParseGeometry                                                         */
+/*                                                                                              */
+/* DESCRIPTION: 容量・消去単位・ページサイズ取得                                                */
+/*              4KB消去は必須、32KB/64KB消去はあれば使用する                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pucBfpt                         BFPT                                            */
+/*            : ulBfptDw                        BFPTのDWORD数                                   */
+/*            : puc4bait                        4BAIT(なければNULL)                             */
+/*                                                                                              */
+/* OUTPUT     : ptInfo                          解析結果                                        */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_SFDP_ERROR                 対応できない構成                                */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_SfdpParseGeometry(const unsigned char *pucBfpt, uint32_t ulBfptDw,
+                                  const unsigned char *puc4bait, FROM_SfdpInfo *ptInfo)
+{
+uint32_t ulDensity  = FROM_SFDP_DW(pucBfpt, 2U);
+uint32_t ulAddrMode = (FROM_SFDP_DW(pucBfpt, 1U) >> 17) & 0x03U;
+uint32_t ulExp      = 0;
+uint32_t ulType     = 0;
+uint32_t ulIdx      = 0;
+uint32_t ulOp       = 0;
+uint32_t i          = 0;
+
+    /* 1.容量(2nd DWORD[31]=1は2^N bit、0は(N+1) bit) */
+    if ((ulDensity & 0x80000000UL) != 0U) {
+        ulExp = ulDensity & 0x7FFFFFFFUL;
+        if ((ulExp < 3U) || (35U <= ulExp)) {
+            return FROM_SFDP_ERROR;
+        }
+        else {
+            ptInfo->ulSize = 1UL << (ulExp - 3U);
+        }
+    }
+    else {
+        ptInfo->ulSize = (ulDensity >> 3) + 1U;
+    }
+
+    /* 2.アドレス長(4-Byte Address Instruction Tableがなければ3バイトアドレス命令で扱える容量のみ) */
+    if (puc4bait != NULL) {
+        ptInfo->ulAddrBytes = 4U;
+    }
+    else if (((ulAddrMode == FROM_SFDP_ADDR_BYTES_3) || (ulAddrMode == FROM_SFDP_ADDR_BYTES_3OR4)) &&
+             (ptInfo->ulSize <= FROM_SFDP_ADDR_3BYTE_MAX)) {
+        ptInfo->ulAddrBytes = 3U;
+    }
+    else {
+        return FROM_SFDP_ERROR;     /* 4バイトアドレス命令が特定できない */
+    }
+
+    /* 3.消去単位(8th・9th DWORDの消去種別1 - 4、サイズは2^N) */
+    for (i = 0; i < FROM_SFDP_ERASE_TYPE_NUM; i++) {
+        ulType = FROM_SFDP_DW(pucBfpt, 8U + (i / 2U)) >> ((i % 2U) * 16U);
+        ulExp  = ulType & 0xFFU;
+        if (ulExp == 12U) {
+            ulIdx = FROM_SFDP_ERASE_4KB;
+        }
+        else if (ulExp == 15U) {
+            ulIdx = FROM_SFDP_ERASE_32KB;
+        }
+        else if (ulExp == 16U) {
+            ulIdx = FROM_SFDP_ERASE_64KB;
+        }
+        else {
+            continue;               /* 未定義、または使用しないサイズ */
+        }
+
+        if (puc4bait == NULL) {
+            ulOp = (ulType >> 8) & 0xFFU;
+        }
+        else if ((FROM_SFDP_DW(puc4bait, 1U) & (1UL << (FROM_SFDP_4BAIT_ERASE_TYPE1 + i))) != 0U) {
+            ulOp = (FROM_SFDP_DW(puc4bait, 2U) >> (i * 8U)) & 0xFFU;
+        }
+        else {
+            continue;               /* 4バイトアドレス命令なし */
+        }
+
+        ptInfo->ulEraseSize[ulIdx] = 1UL << ulExp;
+        ptInfo->ucEraseOp[ulIdx]   = (uint8_t)ulOp;
+    }
+
+    if (ptInfo->ulEraseSize[FROM_SFDP_ERASE_4KB] == 0U) {
+        return FROM_SFDP_ERROR;     /* セクタ消去なし */
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 4.ページサイズ(JESD216A以降、11th DWORD[7:4]=N で2^N) */
+    if (11U <= ulBfptDw) {
+        ptInfo->ulPageSize = 1UL << ((FROM_SFDP_DW(pucBfpt, 11U) >> 4) & 0x0FU);
+    }
+    else {
+        ptInfo->ulPageSize = FROM_SFDP_PAGE_DEFAULT;
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SfdpParseRead                                                             */
+/*                                                                                              */
+/* DESCRIPTION: 読み出し命令取得                                                                */
+/*              拡張SPIモードは1-4-4、1-1-4、1-2-2、1-1-2、1-1-1の順に対応しているものを選ぶ    */
+/*              Quadモード(4-4-4)は移行・解除が単一命令のデバイスのみ使用する                   */
+/*              (QEビットの設定は行わない)                                                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : pucBfpt                         BFPT                                            */
+/*            : ulBfptDw                        BFPTのDWORD数                                   */
+/*            : puc4bait                        4BAIT(なければNULL)                             */
+/*                                                                                              */
+/* OUTPUT     : ptInfo                          解析結果                                        */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_SfdpParseRead(const unsigned char *pucBfpt, uint32_t ulBfptDw,
+                               const unsigned char *puc4bait, FROM_SfdpInfo *ptInfo)
+{
+const FROM_SfdpReadCand *ptCand = NULL;
+uint32_t ulSup                  = FROM_SFDP_DW(pucBfpt, 1U);
+uint32_t ul4bSup                = (puc4bait != NULL) ? FROM_SFDP_DW(puc4bait, 1U) : 0U;
+uint32_t ulParam                = 0;
+uint32_t ulQpi                  = 0;
+uint32_t i                      = 0;
+
+    /* 1.拡張SPIモード(速い順に検索) */
+    for (i = 0; i < (sizeof(l_tSfdpReadCand) / sizeof(l_tSfdpReadCand[0])); i++) {
+        ptCand = &l_tSfdpReadCand[i];
+        if (((ulSup & (1UL << ptCand->ucSupBit)) != 0U) &&
+            ((puc4bait == NULL) || ((ul4bSup & (1UL << ptCand->uc4bBit)) != 0U))) {
+            ulParam = FROM_SFDP_DW(pucBfpt, ptCand->ucParamDw) >> ptCand->ucParamShift;
+            _FROM_SfdpSetRead(&ptInfo->tRead, ulParam, (puc4bait != NULL) ? ptCand->uc4bOp : 0U,
+                              ptCand->ucAddrLines, ptCand->ucDataLines);
+            break;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    if (ptInfo->tRead.ucOpcode == 0U) {
+        /* Fast Read(1-1-1、ダミーサイクル固定) */
+        ptInfo->tRead.ucOpcode    = (puc4bait != NULL) ? FROM_SFDP_4BCMD_FAST_READ : FROM_SFDP_CMD_FAST_READ;
+        ptInfo->tRead.ucAddrLines = 1U;
+        ptInfo->tRead.ucDataLines = 1U;
+        ptInfo->tRead.ucDummy     = FROM_SFDP_FAST_READ_DUMMY;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 2.Quadモード(5th DWORD[4]で対応、移行・解除命令は15th DWORD) */
+    if ((15U <= ulBfptDw) && ((FROM_SFDP_DW(pucBfpt, 5U) & 0x00000010UL) != 0U) &&
+        ((puc4bait == NULL) || ((ul4bSup & (1UL << FROM_SFDP_4BAIT_QPI_READ)) != 0U))) {
+        ulQpi = FROM_SFDP_DW(pucBfpt, 15U);
+
+        /* 移行([8:4]、bit5:38h bit6:35h) */
+        if ((ulQpi & 0x00000040UL) != 0U) {
+            ptInfo->ucEnterQpiOp = FROM_SFDP_CMD_ENTER_QPI_35;
+        }
+        else if ((ulQpi & 0x00000020UL) != 0U) {
+            ptInfo->ucEnterQpiOp = FROM_SFDP_CMD_ENTER_QPI_38;
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        /* 解除([3:0]、bit0:FFh bit1:F5h) */
+        if ((ulQpi & 0x00000002UL) != 0U) {
+            ptInfo->ucExitQpiOp = FROM_SFDP_CMD_EXIT_QPI_F5;
+        }
+        else if ((ulQpi & 0x00000001UL) != 0U) {
+            ptInfo->ucExitQpiOp = FROM_SFDP_CMD_EXIT_QPI_FF;
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        if ((ptInfo->ucEnterQpiOp != 0U) && (ptInfo->ucExitQpiOp != 0U)) {
+            _FROM_SfdpSetRead(&ptInfo->tQpiRead, FROM_SFDP_DW(pucBfpt, 7U) >> 16,
+                              (puc4bait != NULL) ? FROM_SFDP_4BCMD_QPI_READ : 0U, 4U, 4U);
+        }
+        else {
+            ptInfo->ucEnterQpiOp = 0U;
+            ptInfo->ucExitQpiOp  = 0U;
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+}
@@ -0,0 +1,108 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_spiflash_xfer.c                                                     0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      NORドライバ 書き込み分割ソースファイル                                                  */
+/*      (書き込みをページ境界・インターリーブ単位・TX FIFO容量で分割する。                      */
+/*       OSに依存しないため、ホスト環境でRAMモデルに対して照合できる)                           */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "code_rules_def.h"
+#include "dri_spiflash.h"
+#include "dri_spiflash_local.h"
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_SplitWrite                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: ページ分割書き込み                                                              */
+/*              ページ境界を跨がない最大長(インターリーブ単位の倍数、ulChunkMax以下)毎に        */
+/*              pfnWriteを呼び出す。インターリーブ単位に満たない先頭・末尾の端数は              */
+/*              0xFF(書き込みで変化しない値)で補って書き込む                                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptConfig                        ページ分割書き込み設定                          */
+/*            : uiAddress                       書き込みを開始するアドレス(デバイス内)          */
+/*            : uiLength                        書き込みデータ長                                */
+/*            : strWriteData                    書き込みデータ                                  */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              その他                             pfnWriteの戻り値                             */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_SplitWrite(const FROM_SplitConfig *ptConfig, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData)
+{
+uint32_t ulSize                           = 0;
+uint32_t ulHead                           = 0;
+unsigned char ucPad[FROM_SPLIT_WIDTH_MAX] = { 0 };
+int iRet                                  = FROM_SUCCESS;
+
+    /* パラメータチェック */
+    if ((ptConfig == NULL) || (ptConfig->pfnWrite == NULL) || (strWriteData == NULL) ||
+        (ptConfig->ulWidth == 0U) || (FROM_SPLIT_WIDTH_MAX < ptConfig->ulWidth) ||
+        (ptConfig->ulPageSize < ptConfig->ulWidth) || ((ptConfig->ulPageSize % ptConfig->ulWidth) != 0U) ||
+        (ptConfig->ulChunkMax < ptConfig->ulWidth)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    while (0U < uiLength) {
+        ulHead = uiAddress % ptConfig->ulWidth;
+        if ((ulHead != 0U) || (uiLength < ptConfig->ulWidth)) {
+            /* インターリーブ単位に満たない端数は0xFF(書き込みで変化しない値)で補って書き込む */
+            ulSize = ptConfig->ulWidth - ulHead;
+            ulSize = (uiLength < ulSize) ? uiLength : ulSize;
+            memset(ucPad, 0xFF, sizeof(ucPad));
+            memcpy(&ucPad[ulHead], strWriteData, ulSize);
+            iRet = ptConfig->pfnWrite(ptConfig->ulDev, uiAddress - ulHead, ptConfig->ulWidth, ucPad);
+        }
+        else {
+            /* １回の書き込みサイズ設定(ページ境界を跨がない最大長、インターリーブ単位の倍数) */
+            ulSize = ptConfig->ulPageSize - (uiAddress % ptConfig->ulPageSize);
+            ulSize = (uiLength < ulSize) ? uiLength : ulSize;
+            ulSize = (ptConfig->ulChunkMax < ulSize) ? ptConfig->ulChunkMax : ulSize;
+            ulSize -= ulSize % ptConfig->ulWidth;
+
+            /* 書き込み処理 */
+            iRet = ptConfig->pfnWrite(ptConfig->ulDev, uiAddress, ulSize, strWriteData);
+        }
+        if (iRet != FROM_SUCCESS) {
+            return iRet;
+        }
+        else {
+            /* 残書き込み長・アドレス更新 */
+            strWriteData += ulSize;
+            uiAddress    += ulSize;
+            uiLength     -= ulSize;
+        }
+    }
+
+    return FROM_SUCCESS;
+}
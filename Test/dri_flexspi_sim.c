@@ -0,0 +1,860 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_flexspi_sim.c                                                       0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      FlexSPIドライバ ホストモデルソースファイル                                              */
+/*      (RX FIFO・DMAのレジスタモデルでドライバのDMA/CPU分割・待ち条件判定・RFDR複写を          */
+/*       動作させ、データ・待ちの成立を照合する。RFDR複写のサイクル数も計測する。               */
+/*       AHB RXバッファ分割の複数マスター混在アクセスの比較も行う。                             */
+/*       ホスト環境専用(dri_flexspi_simrun.cから実行し、ターゲットにはリンクしない))            */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "imx8mplus_uC3.h"
+#include "code_rules_def.h"
+#include "dri_flexspi.h"
+#include "dri_flexspi_local.h"
+#include "dri_flexspi_sim.h"
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+#define FLEXSPI_SIM_RFDR_SIZE   (FLEXSPI_SIM_WATERMARK_MAX) /* RFDRの窓サイズ */
+#define FLEXSPI_SIM_ALIGN       (FLEXSPI_DCACHE_LINE_SIZE)  /* 格納先の基準境界 */
+#define FLEXSPI_SIM_AHB_NONE    (0xFFFFFFFFU)               /* バッファ内データなし・バッファなし */
+#define FLEXSPI_SIM_AHB_LINE    (FLEXSPI_DCACHE_LINE_SIZE)  /* コアの命令フェッチ単位 */
+#define FLEXSPI_SIM_DMA_BASE    (0x00100000U)               /* DMAの読み出し開始アドレス */
+
+/****************************************************************************/
+/*  構造体定義                                                              */
+/****************************************************************************/
+
+/* RX FIFOモデル(デバイスからの到着はFIFO満杯で止まる) */
+typedef struct FlexSPI_SimRxFifo_tag {
+    uint32_t        ulLength;           /* コマンドのデータ長 */
+    uint32_t        ulProduced;         /* デバイスからRX FIFOへ入ったバイト数 */
+    uint32_t        ulConsumed;         /* RX FIFOから取り出したバイト数 */
+    uint32_t        ulWatermark;        /* RX FIFOウォーターマーク(バイト) */
+    uint32_t        ulRate;             /* 1ステップで到着するバイト数 */
+} FlexSPI_SimRxFifo;
+
+/* AHB RXバッファモデル(バッファ毎に連続した1領域を保持する) */
+typedef struct FlexSPI_SimAhbBuf_tag {
+    uint32_t        ulStart;            /* 保持している領域の先頭(FLEXSPI_SIM_AHB_NONEはなし) */
+    uint32_t        ulEnd;              /* 保持している領域の終端 */
+} FlexSPI_SimAhbBuf;
+
+/****************************************************************************/
+/*  ローカルデータ                                                          */
+/****************************************************************************/
+
+/* レジスタモデル(RFDR・INTR・IPRXFSTSのみ使用する) */
+DLOCAL FlexSPI_Type l_tSimReg;
+
+/* RX FIFOモデル */
+DLOCAL FlexSPI_SimRxFifo l_tSimFifo;
+
+/* 格納先バッファ(8バイト境界、キャッシュライン境界に合わせてずらして使用する) */
+DLOCAL uint64_t l_ullSimBuf[(FLEXSPI_SIM_DATA_MAX + (FLEXSPI_SIM_ALIGN * 2U)) / 8U];
+DLOCAL unsigned char l_ucSimRef[FLEXSPI_SIM_DATA_MAX];
+
+/* 到着速度(バイト/ステップ、1バイトずつ・ワード境界をまたぐ・一括の各場合) */
+DLOCAL const uint32_t l_ulSimRate[] = { 1U, 13U, FLEXSPI_SIM_RX_FIFO_SIZE };
+
+/* AHB RXバッファモデル */
+DLOCAL FlexSPI_SimAhbBuf l_tSimAhb[FLEXSPI_AHB_BUFFER_NUM];
+
+/* 乱数(xorshift32) */
+DLOCAL uint32_t l_ulSimRand;
+
+/****************************************************************************/
+/*  ローカル関数宣言                                                        */
+/****************************************************************************/
+
+/* RX FIFOモデル操作 */
+LOCAL uint8_t _FlexSPI_SimData(uint32_t ulPos);
+LOCAL uint32_t _FlexSPI_SimRxStep(void);
+LOCAL void _FlexSPI_SimRxUpdate(void);
+LOCAL void _FlexSPI_SimRxPop(uint32_t ulSize);
+LOCAL int _FlexSPI_SimRxDma(unsigned char *buf, uint32_t size);
+LOCAL int _FlexSPI_SimRxDrain(unsigned char *buf, uint32_t size, FlexSPI_SimRxResult *ptResult);
+
+/* 格納先バッファ取得 */
+LOCAL unsigned char *_FlexSPI_SimGetBuf(uint32_t ulOffset);
+
+/* 従来のRX FIFO読み出し(バイト単位) */
+LOCAL void _FlexSPI_SimLegacyCopy(FlexSPI_Type *base, unsigned char *buf, uint32_t size);
+
+/* AHB RXバッファモデル操作 */
+LOCAL uint32_t _FlexSPI_SimAhbFind(const FlexSPI_AhbBufConfig *ptBuf, uint32_t ulMasterId);
+LOCAL uint32_t _FlexSPI_SimAhbAccess(const FlexSPI_AhbBufConfig *ptBuf, uint32_t ulMasterId,
+                                     uint32_t ulAddr, uint32_t ulSize, FlexSPI_SimAhbResult *ptResult);
+LOCAL uint32_t _FlexSPI_SimRand(void);
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SimRxRun                                                                */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFOモデル実行                                                               */
+/*              デバイスからの到着をモデル化したRX FIFOを、ドライバと同じ手順で取り出す         */
+/*              (FlexSPI_GetRxDmaSizeの分をDMA要求(ウォーターマーク到達毎)で転送し、残りをCPUで */
+/*               ウォーターマーク単位、端数はFlexSPI_IsRxBlockReadyで判定して取り出す)          */
+/*              データと待ち条件の成立を照合し、結果を積算する                                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptConfig                        RX FIFOモデル設定                               */
+/*                                                                                              */
+/* OUTPUT     : ptResult                        RX FIFOモデル結果(積算)                         */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了(照合結果はptResultを参照)              */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SimRxRun(const FlexSPI_SimRxConfig *ptConfig, FlexSPI_SimRxResult *ptResult)
+{
+unsigned char *pucBuf = NULL;
+uint32_t ulDmaSize     = 0;
+uint32_t i             = 0;
+int iRet              = FLEXSPI_E_SUCCESS;
+
+    /* パラメータチェック */
+    if ((ptConfig == NULL) || (ptResult == NULL) ||
+        (ptConfig->ulSize == 0U) || (FLEXSPI_SIM_DATA_MAX < ptConfig->ulSize) ||
+        (FLEXSPI_SIM_ALIGN <= ptConfig->ulOffset) ||
+        (ptConfig->ulWatermark < FLEXSPI_SIM_WATERMARK_MIN) || (FLEXSPI_SIM_WATERMARK_MAX < ptConfig->ulWatermark) ||
+        ((ptConfig->ulWatermark & (ptConfig->ulWatermark - 1U)) != 0U) ||
+        ((ptConfig->ulMode != FLEXSPI_XFER_MODE_PIO) && (ptConfig->ulMode != FLEXSPI_XFER_MODE_DMA)) ||
+        (ptConfig->ulRate == 0U)) {
+        return FLEXSPI_E_PARAM;
+    }
+    else {
+        pucBuf = _FlexSPI_SimGetBuf(ptConfig->ulOffset);
+        memset(pucBuf, 0xA5, ptConfig->ulSize);
+    }
+
+    /* RX FIFOモデル初期化(コマンド開始) */
+    l_tSimFifo.ulLength    = ptConfig->ulSize;
+    l_tSimFifo.ulProduced  = 0U;
+    l_tSimFifo.ulConsumed  = 0U;
+    l_tSimFifo.ulWatermark = ptConfig->ulWatermark;
+    l_tSimFifo.ulRate      = ptConfig->ulRate;
+    _FlexSPI_SimRxUpdate();
+
+    /* 1)DMA転送(ドライバと同じ分割) */
+    ulDmaSize = FlexSPI_GetRxDmaSize(pucBuf, ptConfig->ulSize, ptConfig->ulMode, ptConfig->ulWatermark);
+    if (ulDmaSize != 0U) {
+        iRet = _FlexSPI_SimRxDma(pucBuf, ulDmaSize);
+        ptResult->ulDmaBytes += ulDmaSize;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 2)残りをCPUで取り出し */
+    if ((iRet == FLEXSPI_E_SUCCESS) && (ulDmaSize < ptConfig->ulSize)) {
+        iRet = _FlexSPI_SimRxDrain(&pucBuf[ulDmaSize], ptConfig->ulSize - ulDmaSize, ptResult);
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 照合 */
+    ptResult->ulRuns++;
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        ptResult->ulStalls++;
+    }
+    else {
+        for (i = 0; i < ptConfig->ulSize; i++) {
+            if (pucBuf[i] != _FlexSPI_SimData(i)) {
+                ptResult->ulErrors++;
+                break;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+    }
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SimRxSweep                                                              */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFOモデル一括実行                                                           */
+/*              読み出し長1 - ulMaxSize、格納先のずれ0 - 7、全ウォーターマーク、到着速度3種の   */
+/*              全組み合わせを、CPU転送・DMA転送の各モードでFlexSPI_SimRxRunを実行する          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulMaxSize                       最大読み出し長(FLEXSPI_SIM_DATA_MAXまで)        */
+/*                                                                                              */
+/* OUTPUT     : ptResult                        RX FIFOモデル結果                               */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了(照合結果はptResultを参照)              */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SimRxSweep(uint32_t ulMaxSize, FlexSPI_SimRxResult *ptResult)
+{
+FlexSPI_SimRxConfig tConfig = { 0 };
+uint32_t i                  = 0;
+int iRet                    = FLEXSPI_E_SUCCESS;
+
+    /* パラメータチェック */
+    if ((ptResult == NULL) || (ulMaxSize == 0U) || (FLEXSPI_SIM_DATA_MAX < ulMaxSize)) {
+        return FLEXSPI_E_PARAM;
+    }
+    else {
+        memset(ptResult, 0, sizeof(*ptResult));
+    }
+
+    for (tConfig.ulMode = FLEXSPI_XFER_MODE_PIO; tConfig.ulMode <= FLEXSPI_XFER_MODE_DMA; tConfig.ulMode++) {
+    for (tConfig.ulWatermark = FLEXSPI_SIM_WATERMARK_MIN; tConfig.ulWatermark <= FLEXSPI_SIM_WATERMARK_MAX; tConfig.ulWatermark *= 2U) {
+        for (tConfig.ulSize = 1U; tConfig.ulSize <= ulMaxSize; tConfig.ulSize++) {
+            for (tConfig.ulOffset = 0U; tConfig.ulOffset < 8U; tConfig.ulOffset++) {
+                for (i = 0; i < (sizeof(l_ulSimRate) / sizeof(l_ulSimRate[0])); i++) {
+                    tConfig.ulRate = l_ulSimRate[i];
+                    iRet = FlexSPI_SimRxRun(&tConfig, ptResult);
+                    if (iRet != FLEXSPI_E_SUCCESS) {
+                        return iRet;
+                    }
+                    else {
+                        ;   /* do nothing */
+                    }
+                }
+            }
+        }
+    }
+    }
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SimCopyBench                                                            */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFO複写ベンチマーク                                                         */
+/*              RFDRの窓(ウォーターマーク最大)単位で、従来のバイト単位ループと                  */
+/*              FlexSPI_CopyRxBlockのサイクル数を計測する(両方式の複写結果も照合する)           */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptConfig                        ベンチマーク設定                                */
+/*                                                                                              */
+/* OUTPUT     : ptResult                        ベンチマーク結果                                */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*              FLEXSPI_E_ERROR                 複写結果が一致しない                            */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SimCopyBench(const FlexSPI_SimBenchConfig *ptConfig, FlexSPI_SimBenchResult *ptResult)
+{
+unsigned char *pucBuf = NULL;
+uint32_t ulStart      = 0;
+uint32_t ulOffset     = 0;
+uint32_t ulBlock      = 0;
+uint32_t ulLoop       = 0;
+uint32_t i            = 0;
+
+    /* パラメータチェック */
+    if ((ptConfig == NULL) || (ptResult == NULL) || (ptConfig->pfnGetCycle == NULL) ||
+        (ptConfig->ulSize == 0U) || (FLEXSPI_SIM_DATA_MAX < ptConfig->ulSize) ||
+        (8U <= ptConfig->ulOffset) || (ptConfig->ulLoops == 0U)) {
+        return FLEXSPI_E_PARAM;
+    }
+    else {
+        memset(ptResult, 0, sizeof(*ptResult));
+        pucBuf = _FlexSPI_SimGetBuf(ptConfig->ulOffset);
+    }
+
+    /* RFDR(窓全体にデータを置く) */
+    for (i = 0; i < (FLEXSPI_SIM_RFDR_SIZE / 4U); i++) {
+        l_tSimReg.RFDR[i] = (uint32_t)_FlexSPI_SimData(i * 4U)               |
+                            ((uint32_t)_FlexSPI_SimData((i * 4U) + 1U) << 8)  |
+                            ((uint32_t)_FlexSPI_SimData((i * 4U) + 2U) << 16) |
+                            ((uint32_t)_FlexSPI_SimData((i * 4U) + 3U) << 24);
+    }
+
+    for (ulLoop = 0; ulLoop < ptConfig->ulLoops; ulLoop++) {
+        /* 従来のバイト単位ループ */
+        ulStart = ptConfig->pfnGetCycle();
+        for (ulOffset = 0; ulOffset < ptConfig->ulSize; ulOffset += ulBlock) {
+            ulBlock = ptConfig->ulSize - ulOffset;
+            ulBlock = (FLEXSPI_SIM_RFDR_SIZE < ulBlock) ? FLEXSPI_SIM_RFDR_SIZE : ulBlock;
+            _FlexSPI_SimLegacyCopy(&l_tSimReg, &pucBuf[ulOffset], ulBlock);
+        }
+        ptResult->ullLegacyCycles += (uint32_t)(ptConfig->pfnGetCycle() - ulStart);
+        memcpy(l_ucSimRef, pucBuf, ptConfig->ulSize);
+
+        /* FlexSPI_CopyRxBlock */
+        ulStart = ptConfig->pfnGetCycle();
+        for (ulOffset = 0; ulOffset < ptConfig->ulSize; ulOffset += ulBlock) {
+            ulBlock = ptConfig->ulSize - ulOffset;
+            ulBlock = (FLEXSPI_SIM_RFDR_SIZE < ulBlock) ? FLEXSPI_SIM_RFDR_SIZE : ulBlock;
+            FlexSPI_CopyRxBlock(&l_tSimReg, &pucBuf[ulOffset], ulBlock);
+        }
+        ptResult->ullWordCycles += (uint32_t)(ptConfig->pfnGetCycle() - ulStart);
+
+        if (memcmp(l_ucSimRef, pucBuf, ptConfig->ulSize) != 0) {
+            return FLEXSPI_E_ERROR;
+        }
+        else {
+            ptResult->ullBytes += ptConfig->ulSize;
+        }
+    }
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SimAhbRun                                                               */
+/*                                                                                              */
+/* DESCRIPTION: AHB RXバッファモデル実行                                                        */
+/*              コア(分岐を含む命令フェッチ)とDMA(連続読み出し)が混在してAHB窓を読み出す場合の  */
+/*              AHB RXバッファのヒット数・デバイス読み出し量を求める                            */
+/*              バッファはマスターID毎に割り当て                                                */
+/*              (割り当てのないマスターはFLEXSPI_AHB_BUFFER_DEFAULT)、連続した1領域を保持し、   */
+/*              プリフェッチ有効時は消費に合わせて先読みを続けるものとする                      */
+/*              (アクセスは順に処理するため、優先度は結果に影響しない)                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptConfig                        AHB RXバッファモデル設定                        */
+/*            : ptBuf                           AHB RXバッファ構成[FLEXSPI_AHB_BUFFER_NUM]      */
+/*                                                                                              */
+/* OUTPUT     : ptResult                        AHB RXバッファモデル結果                        */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SimAhbRun(const FlexSPI_SimAhbConfig *ptConfig, const FlexSPI_AhbBufConfig *ptBuf,
+                      FlexSPI_SimAhbResult *ptResult)
+{
+uint32_t ulLineNum = 0;
+uint32_t ulAddr    = 0;
+uint32_t ulDmaAddr = FLEXSPI_SIM_DMA_BASE;
+uint32_t ulRun     = 0;
+uint32_t ulCount   = 0;
+uint32_t i         = 0;
+
+    /* パラメータチェック */
+    if ((ptConfig == NULL) || (ptResult == NULL) ||
+        (FlexSPI_CheckAHBBufferConfig(ptBuf) != FLEXSPI_E_SUCCESS) ||
+        (ptConfig->ulCoreSize < FLEXSPI_SIM_AHB_LINE) || ((ptConfig->ulCoreSize % FLEXSPI_SIM_AHB_LINE) != 0U) ||
+        (FLEXSPI_SIM_DMA_BASE < ptConfig->ulCoreSize) ||
+        (ptConfig->ulCoreRun == 0U) ||
+        (ptConfig->ulDmaBurst == 0U) || ((ptConfig->ulDmaBurst % 8U) != 0U) ||
+        (ptConfig->ulDmaRatio == 0U) || (ptConfig->ulAccesses == 0U) || (ptConfig->ulSeed == 0U)) {
+        return FLEXSPI_E_PARAM;
+    }
+    else {
+        memset(ptResult, 0, sizeof(*ptResult));
+        ulLineNum = ptConfig->ulCoreSize / FLEXSPI_SIM_AHB_LINE;
+        l_ulSimRand = ptConfig->ulSeed;
+    }
+
+    /* AHB RXバッファモデル初期化(ソフトウェアリセット後) */
+    for (i = 0; i < FLEXSPI_AHB_BUFFER_NUM; i++) {
+        l_tSimAhb[i].ulStart = FLEXSPI_SIM_AHB_NONE;
+        l_tSimAhb[i].ulEnd   = FLEXSPI_SIM_AHB_NONE;
+    }
+
+    while (ulCount < ptConfig->ulAccesses) {
+        /* 分岐先(コア領域内のキャッシュライン)と連続して取得するライン数 */
+        ulAddr = (_FlexSPI_SimRand() % ulLineNum) * FLEXSPI_SIM_AHB_LINE;
+        ulRun  = (_FlexSPI_SimRand() % ptConfig->ulCoreRun) + 1U;
+
+        for (i = 0; (i < ulRun) && (ulCount < ptConfig->ulAccesses); i++) {
+            /* コア(キャッシュライン単位の命令フェッチ) */
+            if (_FlexSPI_SimAhbAccess(ptBuf, ptConfig->ulCoreMaster, ulAddr, FLEXSPI_SIM_AHB_LINE, ptResult) != 0U) {
+                ptResult->ulCoreHits++;
+            }
+            else {
+                ptResult->ulCoreMisses++;
+            }
+            ulAddr = ((ulAddr + FLEXSPI_SIM_AHB_LINE) < ptConfig->ulCoreSize) ? (ulAddr + FLEXSPI_SIM_AHB_LINE) : 0U;
+            ulCount++;
+
+            /* DMA(ulDmaRatio回のコアアクセス毎に連続領域を1回読み出す) */
+            if ((ulCount % ptConfig->ulDmaRatio) == 0U) {
+                if (_FlexSPI_SimAhbAccess(ptBuf, ptConfig->ulDmaMaster, ulDmaAddr, ptConfig->ulDmaBurst, ptResult) != 0U) {
+                    ptResult->ulDmaHits++;
+                }
+                else {
+                    ptResult->ulDmaMisses++;
+                }
+                ulDmaAddr += ptConfig->ulDmaBurst;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+    }
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FlexSPI_SimAhbBench                                                             */
+/*                                                                                              */
+/* DESCRIPTION: AHB RXバッファ分割ベンチマーク                                                  */
+/*              同じアクセスパターンを、既定の構成                                              */
+/*              (全マスターでFLEXSPI_AHB_BUFFER_DEFAULTを共用)と                                */
+/*              コア専用バッファを分けた構成(容量を半分ずつ、両方プリフェッチ有効)で実行する    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptConfig                        AHB RXバッファモデル設定                        */
+/*                                                                                              */
+/* OUTPUT     : ptShared                        既定の構成の結果                                */
+/*            : ptSplit                         コア専用バッファを分けた構成の結果              */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_PARAM                 パラメータに誤りがある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int FlexSPI_SimAhbBench(const FlexSPI_SimAhbConfig *ptConfig,
+                        FlexSPI_SimAhbResult *ptShared, FlexSPI_SimAhbResult *ptSplit)
+{
+FlexSPI_AhbBufConfig tBuf[FLEXSPI_AHB_BUFFER_NUM];
+int iRet = FLEXSPI_E_SUCCESS;
+
+    /* パラメータチェック */
+    if ((ptConfig == NULL) || (ptShared == NULL) || (ptSplit == NULL) ||
+        (FLEXSPI_AHB_MASTER_ID_MAX < ptConfig->ulCoreMaster) ||
+        (ptConfig->ulCoreMaster == ptConfig->ulDmaMaster)) {
+        return FLEXSPI_E_PARAM;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 1)既定の構成(ドライバの初期値と同じ) */
+    memset(tBuf, 0, sizeof(tBuf));
+    tBuf[FLEXSPI_AHB_BUFFER_DEFAULT].ulSize     = FLEXSPI_AHB_BUFFER_SIZE;
+    tBuf[FLEXSPI_AHB_BUFFER_DEFAULT].ulPrefetch = 1U;
+    iRet = FlexSPI_SimAhbRun(ptConfig, tBuf, ptShared);
+    if (iRet != FLEXSPI_E_SUCCESS) {
+        return iRet;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 2)コア専用バッファを分けた構成(DMAを含む他のマスターは残りを使用) */
+    tBuf[0].ulMasterId                          = ptConfig->ulCoreMaster;
+    tBuf[0].ulSize                              = FLEXSPI_AHB_BUFFER_SIZE / 2U;
+    tBuf[0].ulPriority                          = FLEXSPI_AHB_PRIORITY_MAX;
+    tBuf[0].ulPrefetch                          = 1U;
+    tBuf[FLEXSPI_AHB_BUFFER_DEFAULT].ulSize     = FLEXSPI_AHB_BUFFER_SIZE - tBuf[0].ulSize;
+
+    return FlexSPI_SimAhbRun(ptConfig, tBuf, ptSplit);
+}
+
+/****************************************************************************/
+/*  ローカル関数                                                            */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimData                                                                */
+/*                                                                                              */
+/* DESCRIPTION: モデルのデバイスデータ(位置毎に異なる値とする)                                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulPos                           データ先頭からの位置                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : データ                                                                          */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint8_t _FlexSPI_SimData(uint32_t ulPos)
+{
+    return (uint8_t)((ulPos * 7U) + (ulPos >> 8) + 1U);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimRxStep                                                              */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFOモデル1ステップ                                                          */
+/*              デバイスから到着速度分をRX FIFOへ入れる(FIFO満杯・コマンド完了で止まる)         */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 到着したバイト数                        0は到着なし                             */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FlexSPI_SimRxStep(void)
+{
+uint32_t ulSize = l_tSimFifo.ulLength - l_tSimFifo.ulProduced;
+uint32_t ulFree = FLEXSPI_SIM_RX_FIFO_SIZE - (l_tSimFifo.ulProduced - l_tSimFifo.ulConsumed);
+
+    ulSize = (l_tSimFifo.ulRate < ulSize) ? l_tSimFifo.ulRate : ulSize;
+    ulSize = (ulFree < ulSize) ? ulFree : ulSize;
+    l_tSimFifo.ulProduced += ulSize;
+    _FlexSPI_SimRxUpdate();
+
+    return ulSize;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimRxUpdate                                                            */
+/*                                                                                              */
+/* DESCRIPTION: レジスタモデル更新                                                              */
+/*              RFDRにFIFO先頭からの窓を置き、                                                  */
+/*              INTR.IPRXWA(ウォーターマーク到達)・IPRXFSTS.FILLを設定する                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_SimRxUpdate(void)
+{
+uint32_t ulFill = l_tSimFifo.ulProduced - l_tSimFifo.ulConsumed;
+uint32_t ulPos  = 0;
+uint32_t ulWord = 0;
+uint32_t i      = 0;
+
+    /* RFDR(未到着の部分は0) */
+    for (i = 0; i < FLEXSPI_SIM_RFDR_SIZE; i++) {
+        ulPos = l_tSimFifo.ulConsumed + i;
+        if (ulPos < l_tSimFifo.ulProduced) {
+            ulWord |= (uint32_t)_FlexSPI_SimData(ulPos) << ((i % 4U) * 8U);
+        }
+        else {
+            ;   /* do nothing */
+        }
+        if ((i % 4U) == 3U) {
+            l_tSimReg.RFDR[i / 4U] = ulWord;
+            ulWord = 0U;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    /* INTR.IPRXWA(ウォーターマーク以上で立つ) */
+    l_tSimReg.INTR = (l_tSimFifo.ulWatermark <= ulFill) ? FlexSPI_INTR_IPRXWA_MASK : 0U;
+
+    /* IPRXFSTS.FILL(8バイト単位、途中のエントリはデータ終端到着後に数える) */
+    if (l_tSimFifo.ulProduced == l_tSimFifo.ulLength) {
+        l_tSimReg.IPRXFSTS = ((ulFill + 7U) / 8U) << FlexSPI_IPRXFSTS_FILL_SHIFT;
+    }
+    else {
+        l_tSimReg.IPRXFSTS = (ulFill / 8U) << FlexSPI_IPRXFSTS_FILL_SHIFT;
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimRxPop                                                               */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFOモデル取り出し                                                           */
+/*              (INTR.IPRXWAへの書き込み、端数ではIPRXFCR.CLRIPRXFに相当する)                   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulSize                          取り出すバイト数                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_SimRxPop(uint32_t ulSize)
+{
+    l_tSimFifo.ulConsumed += ulSize;
+    _FlexSPI_SimRxUpdate();
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimRxDma                                                               */
+/*                                                                                              */
+/* DESCRIPTION: DMA転送モデル                                                                   */
+/*              IPRXFCR.RXDMAEN設定時と同じく、                                                 */
+/*              ウォーターマーク到達毎にウォーターマーク分をRFDRから転送する                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : size                            転送長(ウォーターマークの倍数)                  */
+/*                                                                                              */
+/* OUTPUT     : buf                             データ格納バッファ                              */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 DMA要求が発生しない(実機ではタイムアウト)       */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_SimRxDma(unsigned char *buf, uint32_t size)
+{
+uint32_t ulDone = 0;
+uint32_t i      = 0;
+
+    while (ulDone < size) {
+        /* DMA要求(ウォーターマーク到達)待ち */
+        if ((l_tSimReg.INTR & FlexSPI_INTR_IPRXWA_MASK) == 0U) {
+            if (_FlexSPI_SimRxStep() == 0U) {
+                return FLEXSPI_E_ERROR;
+            }
+            else {
+                continue;
+            }
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        /* 1回のDMA要求でウォーターマーク分を転送 */
+        for (i = 0; i < (l_tSimFifo.ulWatermark / 4U); i++) {
+            memcpy(&buf[ulDone + (i * 4U)], (const void *)&l_tSimReg.RFDR[i], 4U);
+        }
+        ulDone += l_tSimFifo.ulWatermark;
+        _FlexSPI_SimRxPop(l_tSimFifo.ulWatermark);
+    }
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimRxDrain                                                             */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFOモデルからCPUで取り出し                                                  */
+/*              _FlexSPI_DrainRxFifoと同じく、                                                  */
+/*              ウォーターマーク単位のブロック毎に待ち条件を判定して複写する                    */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : size                            読み出し長                                      */
+/*            : ptResult                        RX FIFOモデル結果(積算)                         */
+/*                                                                                              */
+/* OUTPUT     : buf                             データ格納バッファ                              */
+/*                                                                                              */
+/* RESULTS    : FLEXSPI_E_SUCCESS               正常終了                                        */
+/*              FLEXSPI_E_ERROR                 待ち条件が成立しない(実機ではタイムアウト)      */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_SimRxDrain(unsigned char *buf, uint32_t size, FlexSPI_SimRxResult *ptResult)
+{
+uint32_t ulBlock = 0;
+
+    while (0U < size) {
+        ulBlock = (l_tSimFifo.ulWatermark < size) ? l_tSimFifo.ulWatermark : size;
+
+        /* 待ち条件が成立するまでデバイスからの到着を進める */
+        while (FlexSPI_IsRxBlockReady(l_tSimReg.INTR, l_tSimReg.IPRXFSTS, ulBlock, l_tSimFifo.ulWatermark) == 0U) {
+            if (_FlexSPI_SimRxStep() == 0U) {
+                return FLEXSPI_E_ERROR;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+
+        /* RFDRより取得 */
+        FlexSPI_CopyRxBlock(&l_tSimReg, buf, ulBlock);
+        _FlexSPI_SimRxPop(ulBlock);
+        ptResult->ulCpuBytes += ulBlock;
+        ptResult->ulBlocks++;
+
+        buf  += ulBlock;
+        size -= ulBlock;
+    }
+
+    return FLEXSPI_E_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimGetBuf                                                              */
+/*                                                                                              */
+/* DESCRIPTION: 格納先バッファ取得(キャッシュライン境界からずらした位置)                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulOffset                        キャッシュライン境界からのずれ(バイト)          */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 格納先バッファ                                                                  */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL unsigned char *_FlexSPI_SimGetBuf(uint32_t ulOffset)
+{
+unsigned char *pucBuf = (unsigned char *)l_ullSimBuf;
+
+    pucBuf += (FLEXSPI_SIM_ALIGN - ((uintptr_t)pucBuf % FLEXSPI_SIM_ALIGN)) % FLEXSPI_SIM_ALIGN;
+
+    return &pucBuf[ulOffset];
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimLegacyCopy                                                          */
+/*                                                                                              */
+/* DESCRIPTION: 従来のRX FIFO読み出し(ベンチマークの比較対象)                                   */
+/*              1バイト毎に剰余・シフト・格納を行い、4バイト毎にRFDR[n / 4]を読み出す           */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : base                            FlexSPIコントローラーレジスタベースアドレス     */
+/*            : size                            読み出し長(RFDRの窓以下)                        */
+/*                                                                                              */
+/* OUTPUT     : buf                             データ格納バッファ                              */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FlexSPI_SimLegacyCopy(FlexSPI_Type *base, unsigned char *buf, uint32_t size)
+{
+uint32_t ulReadByte = 0;
+uint32_t ulReadData = 0;
+
+    while (size--) {
+        if ((ulReadByte % 4) == 0) {
+            ulReadData = base->RFDR[ulReadByte / 4];
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        /* データを格納 */
+        *buf = ulReadData & 0xFF;
+
+        ulReadData >>= 8;
+        buf++;
+        ulReadByte++;
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimAhbFind                                                             */
+/*                                                                                              */
+/* DESCRIPTION: AHB RXバッファ検索                                                              */
+/*              マスターIDが一致するバッファ(FLEXSPI_AHB_BUFFER_DEFAULT以外)、なければ          */
+/*              FLEXSPI_AHB_BUFFER_DEFAULTを使用する(サイズ0のバッファは使用しない)             */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptBuf                           AHB RXバッファ構成[FLEXSPI_AHB_BUFFER_NUM]      */
+/*            : ulMasterId                      AHBマスターID                                   */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : バッファ番号                          FLEXSPI_SIM_AHB_NONEはバッファなし        */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FlexSPI_SimAhbFind(const FlexSPI_AhbBufConfig *ptBuf, uint32_t ulMasterId)
+{
+uint32_t i = 0;
+
+    for (i = 0; i < FLEXSPI_AHB_BUFFER_DEFAULT; i++) {
+        if ((ptBuf[i].ulSize != 0U) && (ptBuf[i].ulMasterId == ulMasterId)) {
+            return i;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    return (ptBuf[FLEXSPI_AHB_BUFFER_DEFAULT].ulSize != 0U) ? FLEXSPI_AHB_BUFFER_DEFAULT : FLEXSPI_SIM_AHB_NONE;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimAhbAccess                                                           */
+/*                                                                                              */
+/* DESCRIPTION: AHB RXバッファモデルへのアクセス                                                */
+/*              保持している領域内ならヒット、それ以外はデバイスから読み出して領域を置き換える  */
+/*              (プリフェッチ有効時はバッファサイズ分を先読みし、ヒット時も先読みを続ける)      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptBuf                           AHB RXバッファ構成[FLEXSPI_AHB_BUFFER_NUM]      */
+/*            : ulMasterId                      AHBマスターID                                   */
+/*            : ulAddr                          読み出しアドレス                                */
+/*            : ulSize                          読み出し長                                      */
+/*            : ptResult                        AHB RXバッファモデル結果                        */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 1                               ヒット                                          */
+/*              0                               ミス                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FlexSPI_SimAhbAccess(const FlexSPI_AhbBufConfig *ptBuf, uint32_t ulMasterId,
+                                     uint32_t ulAddr, uint32_t ulSize, FlexSPI_SimAhbResult *ptResult)
+{
+FlexSPI_SimAhbBuf *ptModel = NULL;
+uint32_t ulIndex           = _FlexSPI_SimAhbFind(ptBuf, ulMasterId);
+uint32_t ulStart           = ulAddr & ~7U;
+uint32_t ulEnd             = 0;
+
+    /* バッファなし・バッファを超える読み出しはデバイスから直接読み出す */
+    if ((ulIndex == FLEXSPI_SIM_AHB_NONE) || (ptBuf[ulIndex].ulSize < ulSize)) {
+        ptResult->ullFlashBytes += ulSize;
+        return 0U;
+    }
+    else {
+        ptModel = &l_tSimAhb[ulIndex];
+    }
+
+    /* ヒット */
+    if ((ptModel->ulStart != FLEXSPI_SIM_AHB_NONE) &&
+        (ptModel->ulStart <= ulAddr) && ((ulAddr + ulSize) <= ptModel->ulEnd)) {
+        if (ptBuf[ulIndex].ulPrefetch != 0U) {
+            /* 消費した分だけ先読みを進める */
+            ulEnd = ulStart + ptBuf[ulIndex].ulSize;
+            if (ptModel->ulEnd < ulEnd) {
+                ptResult->ullFlashBytes += ulEnd - ptModel->ulEnd;
+                ptModel->ulEnd   = ulEnd;
+                ptModel->ulStart = ulEnd - ptBuf[ulIndex].ulSize;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        else {
+            ;   /* do nothing */
+        }
+        return 1U;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* ミス(8バイト単位で読み出し、プリフェッチ有効時はバッファサイズ分を先読み) */
+    if (ptBuf[ulIndex].ulPrefetch != 0U) {
+        ulEnd = ulStart + ptBuf[ulIndex].ulSize;
+    }
+    else {
+        ulEnd = (ulAddr + ulSize + 7U) & ~7U;
+    }
+    ptResult->ullFlashBytes += ulEnd - ulStart;
+    ptModel->ulStart = ulStart;
+    ptModel->ulEnd   = ulEnd;
+
+    return 0U;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimRand                                                                */
+/*                                                                                              */
+/* DESCRIPTION: 乱数(xorshift32)                                                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 乱数                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FlexSPI_SimRand(void)
+{
+    l_ulSimRand ^= l_ulSimRand << 13;
+    l_ulSimRand ^= l_ulSimRand >> 17;
+    l_ulSimRand ^= l_ulSimRand << 5;
+
+    return l_ulSimRand;
+}
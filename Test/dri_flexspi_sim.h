@@ -0,0 +1,125 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_flexspi_sim.h                                                       0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      FlexSPIドライバ ホストモデルヘッダファイル                                              */
+/*      (ホスト環境専用、ターゲットのビルドには含めない)                                        */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+#ifndef _DRI_FLEXSPI_SIM_H_
+#define _DRI_FLEXSPI_SIM_H_
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+#define FLEXSPI_SIM_RX_FIFO_SIZE    (1024U)     /* モデルのIP RX FIFO容量 */
+#define FLEXSPI_SIM_DATA_MAX        (4096U)     /* モデルで1回に読み出せる最大長 */
+#define FLEXSPI_SIM_WATERMARK_MIN   (8U)        /* RX FIFOウォーターマーク(バイト)の最小 */
+#define FLEXSPI_SIM_WATERMARK_MAX   (128U)      /* RX FIFOウォーターマーク(バイト)の最大(RFDRの窓) */
+
+/****************************************************************************/
+/*  構造体定義                                                              */
+/****************************************************************************/
+
+/* RX FIFOモデル設定 */
+typedef struct FlexSPI_SimRxConfig_tag {
+    uint32_t        ulSize;             /* 読み出し長(FLEXSPI_SIM_DATA_MAXまで) */
+    uint32_t        ulOffset;           /* 格納先のキャッシュライン境界からのずれ(バイト) */
+    uint32_t        ulWatermark;        /* RX FIFOウォーターマーク(バイト) */
+    uint32_t        ulRate;             /* 1ステップでデバイスからRX FIFOへ入るバイト数 */
+    uint32_t        ulMode;             /* RX FIFO転送モード(FLEXSPI_XFER_MODE_*) */
+} FlexSPI_SimRxConfig;
+
+/* RX FIFOモデル結果(FlexSPI_SimRxRunの呼び出し毎に積算する) */
+typedef struct FlexSPI_SimRxResult_tag {
+    uint32_t        ulRuns;             /* 読み出し回数 */
+    uint32_t        ulErrors;           /* データ不一致の読み出し回数 */
+    uint32_t        ulStalls;           /* 待ち条件が成立しない読み出し回数(実機ではタイムアウト) */
+    uint32_t        ulCpuBytes;         /* CPUで読み出したバイト数 */
+    uint32_t        ulBlocks;           /* CPUで読み出したブロック数(起床回数) */
+    uint32_t        ulDmaBytes;         /* DMAで読み出したバイト数 */
+} FlexSPI_SimRxResult;
+
+/* サイクルカウンタ取得(実機ではDWT_CYCCNT、ホストではTSC等) */
+typedef uint32_t (*FlexSPI_SimCycleFunc)(void);
+
+/* RX FIFO複写ベンチマーク設定・結果 */
+typedef struct FlexSPI_SimBenchConfig_tag {
+    FlexSPI_SimCycleFunc pfnGetCycle;   /* サイクルカウンタ取得 */
+    uint32_t        ulSize;             /* 1回の読み出し長(FLEXSPI_SIM_DATA_MAXまで) */
+    uint32_t        ulOffset;           /* 格納先の8バイト境界からのずれ(バイト) */
+    uint32_t        ulLoops;            /* 繰り返し回数 */
+} FlexSPI_SimBenchConfig;
+
+typedef struct FlexSPI_SimBenchResult_tag {
+    uint64_t        ullBytes;           /* 複写したバイト数(各方式) */
+    uint64_t        ullLegacyCycles;    /* 従来のバイト単位ループのサイクル数 */
+    uint64_t        ullWordCycles;      /* FlexSPI_CopyRxBlockのサイクル数 */
+} FlexSPI_SimBenchResult;
+
+/* AHB RXバッファモデル設定(コアの命令フェッチとDMAの連続読み出しを混在させる) */
+typedef struct FlexSPI_SimAhbConfig_tag {
+    uint32_t        ulCoreMaster;       /* コアのAHBマスターID */
+    uint32_t        ulDmaMaster;        /* DMAのAHBマスターID */
+    uint32_t        ulCoreSize;         /* コアが繰り返し実行する領域のサイズ(キャッシュラインの倍数) */
+    uint32_t        ulCoreRun;          /* 分岐までに連続して取得するキャッシュライン数の最大 */
+    uint32_t        ulDmaBurst;         /* DMAの1回の読み出し長(8の倍数) */
+    uint32_t        ulDmaRatio;         /* DMA1回あたりのコアアクセス回数 */
+    uint32_t        ulAccesses;         /* コアアクセス回数 */
+    uint32_t        ulSeed;             /* 乱数の初期値(0以外) */
+} FlexSPI_SimAhbConfig;
+
+/* AHB RXバッファモデル結果 */
+typedef struct FlexSPI_SimAhbResult_tag {
+    uint32_t        ulCoreHits;         /* コアアクセスのヒット数 */
+    uint32_t        ulCoreMisses;       /* コアアクセスのミス数 */
+    uint32_t        ulDmaHits;          /* DMAアクセスのヒット数 */
+    uint32_t        ulDmaMisses;        /* DMAアクセスのミス数 */
+    uint64_t        ullFlashBytes;      /* デバイスから読み出したバイト数(プリフェッチを含む) */
+} FlexSPI_SimAhbResult;
+
+/****************************************************************************/
+/*  関数宣言                                                                */
+/****************************************************************************/
+
+/* RX FIFOモデル */
+int FlexSPI_SimRxRun(const FlexSPI_SimRxConfig *ptConfig, FlexSPI_SimRxResult *ptResult);
+int FlexSPI_SimRxSweep(uint32_t ulMaxSize, FlexSPI_SimRxResult *ptResult);
+
+/* RX FIFO複写ベンチマーク */
+int FlexSPI_SimCopyBench(const FlexSPI_SimBenchConfig *ptConfig, FlexSPI_SimBenchResult *ptResult);
+
+/* AHB RXバッファモデル */
+int FlexSPI_SimAhbRun(const FlexSPI_SimAhbConfig *ptConfig, const FlexSPI_AhbBufConfig *ptBuf,
+                      FlexSPI_SimAhbResult *ptResult);
+int FlexSPI_SimAhbBench(const FlexSPI_SimAhbConfig *ptConfig,
+                        FlexSPI_SimAhbResult *ptShared, FlexSPI_SimAhbResult *ptSplit);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif /* _DRI_FLEXSPI_SIM_H_ */
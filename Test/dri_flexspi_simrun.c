@@ -0,0 +1,241 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_flexspi_simrun.c                                                    0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      FlexSPIドライバ ホストモデル実行ソースファイル                                          */
+/*      (ホストモデル(dri_flexspi_sim.c)を実行し、期待する結果と照合する。                      */
+/*       ホスト環境専用。ビルド例(ホスト用のimx8mplus_uC3.h等をインクルードパスに置く):         */
+/*        cc -I../Src dri_flexspi_simrun.c dri_flexspi_sim.c ../Src/dri_flexspi_xfer.c          */
+/*       照合結果がすべて期待通りなら0、それ以外は1で終了する)                                  */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "imx8mplus_uC3.h"
+#include "code_rules_def.h"
+#include "dri_flexspi.h"
+#include "dri_flexspi_local.h"
+#include "dri_flexspi_sim.h"
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+#define FLEXSPI_SIMRUN_RX_SIZE      (600U)      /* RX FIFOモデル一括実行の最大読み出し長 */
+#define FLEXSPI_SIMRUN_BENCH_SIZE   (4096U)     /* 複写ベンチマークの1回の読み出し長 */
+#define FLEXSPI_SIMRUN_BENCH_LOOPS  (2000U)     /* 複写ベンチマークの繰り返し回数 */
+#define FLEXSPI_SIMRUN_AHB_CORE    (0U)        /* コアのAHBマスターID */
+#define FLEXSPI_SIMRUN_AHB_DMA      (2U)        /* DMAのAHBマスターID */
+
+/****************************************************************************/
+/*  ローカル関数宣言                                                        */
+/****************************************************************************/
+
+LOCAL int _FlexSPI_SimRunRx(void);
+LOCAL int _FlexSPI_SimRunBench(void);
+LOCAL uint32_t _FlexSPI_SimRunGetCycle(void);
+LOCAL int _FlexSPI_SimRunAhb(void);
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : main                                                                            */
+/*                                                                                              */
+/* DESCRIPTION: ホストモデル実行                                                                */
+/*              各モデルを実行し、期待する結果と照合する                                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 0                               すべて期待通り                                  */
+/*              1                               期待と異なる結果がある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int main(void)
+{
+int iFail = 0;
+
+    iFail |= _FlexSPI_SimRunRx();
+    iFail |= _FlexSPI_SimRunBench();
+    iFail |= _FlexSPI_SimRunAhb();
+
+    printf("%s\n", (iFail == 0) ? "PASS" : "FAIL");
+
+    return (iFail == 0) ? 0 : 1;
+}
+
+/****************************************************************************/
+/*  ローカル関数                                                            */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimRunRx                                                               */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFOモデル照合                                                               */
+/*              全条件でデータ不一致・待ち条件の不成立がなく、DMA転送・CPU転送の両方が          */
+/*              行われたこと、CPUのブロック数が読み出し長から求めた値以下であることを照合する   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 0                               期待通り                                        */
+/*              1                               期待と異なる                                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_SimRunRx(void)
+{
+FlexSPI_SimRxResult tResult = { 0 };
+int iRet                    = FlexSPI_SimRxSweep(FLEXSPI_SIMRUN_RX_SIZE, &tResult);
+
+    printf("rx sweep: runs %u errors %u stalls %u dma %u cpu %u blocks %u\n",
+           (unsigned)tResult.ulRuns, (unsigned)tResult.ulErrors, (unsigned)tResult.ulStalls,
+           (unsigned)tResult.ulDmaBytes, (unsigned)tResult.ulCpuBytes, (unsigned)tResult.ulBlocks);
+
+    if ((iRet != FLEXSPI_E_SUCCESS) || (tResult.ulRuns == 0U) ||
+        (tResult.ulErrors != 0U) || (tResult.ulStalls != 0U) ||
+        (tResult.ulDmaBytes == 0U) || (tResult.ulCpuBytes == 0U)) {
+        return 1;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return 0;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimRunBench                                                            */
+/*                                                                                              */
+/* DESCRIPTION: RX FIFO複写ベンチマーク照合                                                     */
+/*              格納先のずれ0 - 7で両方式の複写結果が一致し、FlexSPI_CopyRxBlockが              */
+/*              従来のバイト単位ループより少ないサイクル数であることを照合する                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 0                               期待通り                                        */
+/*              1                               期待と異なる                                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_SimRunBench(void)
+{
+FlexSPI_SimBenchConfig tConfig = { 0 };
+FlexSPI_SimBenchResult tResult = { 0 };
+uint64_t ullLegacy             = 0;
+uint64_t ullWord               = 0;
+
+    tConfig.pfnGetCycle = _FlexSPI_SimRunGetCycle;
+    tConfig.ulSize      = FLEXSPI_SIMRUN_BENCH_SIZE;
+    tConfig.ulLoops     = FLEXSPI_SIMRUN_BENCH_LOOPS;
+    for (tConfig.ulOffset = 0U; tConfig.ulOffset < 8U; tConfig.ulOffset++) {
+        if (FlexSPI_SimCopyBench(&tConfig, &tResult) != FLEXSPI_E_SUCCESS) {
+            printf("copy bench: offset %u mismatch\n", (unsigned)tConfig.ulOffset);
+            return 1;
+        }
+        else {
+            ullLegacy += tResult.ullLegacyCycles;
+            ullWord   += tResult.ullWordCycles;
+        }
+    }
+
+    printf("copy bench: legacy %llu word %llu (x%.1f)\n",
+           (unsigned long long)ullLegacy, (unsigned long long)ullWord,
+           (ullWord != 0U) ? ((double)ullLegacy / (double)ullWord) : 0.0);
+
+    return (ullWord < ullLegacy) ? 0 : 1;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimRunGetCycle                                                         */
+/*                                                                                              */
+/* DESCRIPTION: サイクルカウンタ取得(ホストではナノ秒単位の単調増加時刻)                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : カウンタ値                                                                      */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FlexSPI_SimRunGetCycle(void)
+{
+struct timespec tNow = { 0 };
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &tNow);
+
+    return (uint32_t)(((uint64_t)tNow.tv_sec * 1000000000U) + (uint64_t)tNow.tv_nsec);
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FlexSPI_SimRunAhb                                                              */
+/*                                                                                              */
+/* DESCRIPTION: AHB RXバッファ分割照合                                                          */
+/*              コア専用バッファを分けた構成が、既定の構成よりコアのヒット数が多く、            */
+/*              デバイスからの読み出し量が少ないことを照合する                                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 0                               期待通り                                        */
+/*              1                               期待と異なる                                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FlexSPI_SimRunAhb(void)
+{
+FlexSPI_SimAhbConfig tConfig = { 0 };
+FlexSPI_SimAhbResult tShared = { 0 };
+FlexSPI_SimAhbResult tSplit  = { 0 };
+
+    /* 1KBのループを実行するコアと、4回のコアアクセス毎に64バイト読み出すDMA */
+    tConfig.ulCoreMaster = FLEXSPI_SIMRUN_AHB_CORE;
+    tConfig.ulDmaMaster  = FLEXSPI_SIMRUN_AHB_DMA;
+    tConfig.ulCoreSize   = 1024U;
+    tConfig.ulCoreRun    = 8U;
+    tConfig.ulDmaBurst   = 64U;
+    tConfig.ulDmaRatio   = 4U;
+    tConfig.ulAccesses   = 100000U;
+    tConfig.ulSeed       = 1U;
+    if (FlexSPI_SimAhbBench(&tConfig, &tShared, &tSplit) != FLEXSPI_E_SUCCESS) {
+        return 1;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    printf("ahb bench: core hits %u -> %u, flash bytes %llu -> %llu\n",
+           (unsigned)tShared.ulCoreHits, (unsigned)tSplit.ulCoreHits,
+           (unsigned long long)tShared.ullFlashBytes, (unsigned long long)tSplit.ullFlashBytes);
+
+    if ((tSplit.ulCoreHits <= tShared.ulCoreHits) || (tShared.ullFlashBytes <= tSplit.ullFlashBytes)) {
+        return 1;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return 0;
+}
@@ -0,0 +1,557 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_spiflash_ftl_sim.c                                                  0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      NORドライバ FTLホストシミュレーションソースファイル                                     */
+/*      (RAM上のNORモデルでFTLを動作させ、書き込み増幅率・消去回数を求める。                    */
+/*       NORモデルはキー・バリューストアのホストモデルと共用する。ホスト環境専用、              */
+/*       ターゲットのビルドには含めない)                                                        */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "code_rules_def.h"
+#include "dri_spiflash.h"
+#include "dri_spiflash_local.h"
+#include "dri_spiflash_sim.h"
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+#define FROM_FTL_SIM_CUT_ERASE      (64U)       /* 電源断の模擬で消去1回を書き込みバイト数に換算した値 */
+
+/****************************************************************************/
+/*  ローカルデータ                                                          */
+/****************************************************************************/
+
+/* NORモデル(消去で0xFF、書き込みは1→0のみ変化する) */
+DLOCAL unsigned char l_ucSimFlash[FROM_FTL_SIM_SIZE];
+
+/* 論理ページ毎の書き込み回数(照合データの生成に使用) */
+DLOCAL uint32_t l_ulSimVer[FROM_FTL_LPN_MAX];
+
+/* 照合用バッファ */
+DLOCAL unsigned char l_ucSimBuf[FROM_FTL_PAGE_SIZE_MAX];
+DLOCAL unsigned char l_ucSimExp[FROM_FTL_PAGE_SIZE_MAX];
+
+/* 乱数(xorshift32) */
+DLOCAL uint32_t l_ulSimRand;
+
+/* NORモデル故障設定・消去回数・失敗させた消去の回数 */
+DLOCAL FROM_FtlSimFault l_tSimFault;
+DLOCAL uint32_t l_ulSimEraseCalls;
+DLOCAL uint32_t l_ulSimEraseFails;
+
+/* 電源断までに書き込める残りバイト数・読み出し回数 */
+DLOCAL uint32_t l_ulSimCutLeft;
+DLOCAL uint32_t l_ulSimReadCalls;
+
+/****************************************************************************/
+/*  ローカル関数宣言                                                        */
+/****************************************************************************/
+
+/* NORモデル操作 */
+LOCAL int _FROM_FtlSimRead(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strReadData);
+LOCAL int _FROM_FtlSimWrite(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData);
+LOCAL int _FROM_FtlSimErase(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength);
+
+/* 照合データ生成・全論理ページ照合 */
+LOCAL void _FROM_FtlSimMakeData(uint32_t ulLpn, uint32_t ulPageSize, unsigned char *pucData);
+LOCAL uint32_t _FROM_FtlSimVerify(uint32_t ulLpnNum, uint32_t ulPageSize);
+
+/* 乱数 */
+LOCAL uint32_t _FROM_FtlSimRand(void);
+
+/* 統計の積算(再マウントで統計がクリアされるため) */
+LOCAL void _FROM_FtlSimAccumulate(FROM_FtlSimResult *ptResult);
+
+/****************************************************************************/
+/*  ローカルデータ(NORモデル操作)                                           */
+/****************************************************************************/
+
+DLOCAL const FROM_FtlFlashOps l_tSimOps = {
+    _FROM_FtlSimRead,
+    _FROM_FtlSimWrite,
+    _FROM_FtlSimErase,
+};
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_FtlSimRun                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: FTLホストシミュレーション実行                                                   */
+/*              RAMモデル(FROM_FTL_SIM_SIZE)全体をFTL管理領域とし、一部の論理ページに偏った     */
+/*              書き込みを行う(事前書き込みで更新されないデータを置ける)。再マウントと          */
+/*              全論理ページの照合を定期的に行い、統計を返す                                    */
+/*              比較用に、同じ書き込みをセクタ単位の読み出し・消去・書き込みで行った場合の      */
+/*              消去回数も返す                                                                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptConfig                        シミュレーション設定                            */
+/*                                                                                              */
+/* OUTPUT     : ptResult                        シミュレーション結果                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              その他                             FTLのエラー(FROM_Ftl*の戻り値)               */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_FtlSimRun(const FROM_FtlSimConfig *ptConfig, FROM_FtlSimResult *ptResult)
+{
+FROM_FtlConfig tFtl  = { 0 };
+FROM_FtlStats tStats = { 0 };
+uint32_t ulLpn       = 0;
+uint32_t ulHot       = 0;
+uint32_t i           = 0;
+int iRet             = FROM_SUCCESS;
+
+    /* パラメータチェック */
+    if ((ptConfig == NULL) || (ptResult == NULL) ||
+        (100U < ptConfig->ulHotPercent) || (100U < ptConfig->ulPrefill)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        memset(ptResult, 0, sizeof(*ptResult));
+    }
+
+    /* 1.未使用のデバイスとしてマウント(全ブロックをフォーマット) */
+    FROM_FtlSimFormat();
+    memset(l_ulSimVer, 0, sizeof(l_ulSimVer));
+    l_ulSimRand = (ptConfig->ulSeed != 0U) ? ptConfig->ulSeed : 1U;
+
+    tFtl.ptOps       = &l_tSimOps;
+    tFtl.ulDev       = FROM_DEV_0;
+    tFtl.ulAddress   = 0U;
+    tFtl.ulSize      = FROM_FTL_SIM_SIZE;
+    tFtl.ulBlkSize   = ptConfig->ulBlkSize;
+    tFtl.ulPageSize  = ptConfig->ulPageSize;
+    tFtl.ulReserve   = ptConfig->ulReserve;
+    tFtl.ulWearDelta = ptConfig->ulWearDelta;
+    iRet = FROM_FtlMount(&tFtl);
+    if (iRet == FROM_SUCCESS) {
+        iRet = FROM_FtlGetStats(&tStats);
+    }
+    else {
+        ptResult->ulEraseFails = l_ulSimEraseFails;
+        return iRet;
+    }
+    ulHot = ((ptConfig->ulHotPages != 0U) && (ptConfig->ulHotPages < tStats.ulLpnNum)) ?
+            ptConfig->ulHotPages : tStats.ulLpnNum;
+
+    /* 2.事前書き込み(末尾の論理ページから、以降更新されない) */
+    for (i = 0; (i < ((tStats.ulLpnNum * ptConfig->ulPrefill) / 100U)) && (iRet == FROM_SUCCESS); i++) {
+        ulLpn = tStats.ulLpnNum - 1U - i;
+        l_ulSimVer[ulLpn]++;
+        _FROM_FtlSimMakeData(ulLpn, ptConfig->ulPageSize, l_ucSimBuf);
+        iRet = FROM_FtlWrite(ulLpn, l_ucSimBuf);
+        ptResult->ulInPlaceErases++;
+    }
+
+    /* 3.書き込み(ulHotPercent%を先頭ulHot論理ページへ、残りを全論理ページへ) */
+    for (i = 0; (i < ptConfig->ulWrites) && (iRet == FROM_SUCCESS); i++) {
+        if ((_FROM_FtlSimRand() % 100U) < ptConfig->ulHotPercent) {
+            ulLpn = _FROM_FtlSimRand() % ulHot;
+        }
+        else {
+            ulLpn = _FROM_FtlSimRand() % tStats.ulLpnNum;
+        }
+        l_ulSimVer[ulLpn]++;
+        _FROM_FtlSimMakeData(ulLpn, ptConfig->ulPageSize, l_ucSimBuf);
+        iRet = FROM_FtlWrite(ulLpn, l_ucSimBuf);
+
+        /* セクタ単位の書き換えでは書き込み毎に消去する */
+        ptResult->ulInPlaceErases++;
+
+        /* 再マウント(RAM上の対応表をフラッシュから作り直す)・照合 */
+        if ((iRet == FROM_SUCCESS) && (ptConfig->ulRemount != 0U) && (((i + 1U) % ptConfig->ulRemount) == 0U)) {
+            _FROM_FtlSimAccumulate(ptResult);
+            (void)FROM_FtlUnmount();
+            iRet = FROM_FtlMount(&tFtl);
+            if (iRet == FROM_SUCCESS) {
+                ptResult->ulVerifyErrors += _FROM_FtlSimVerify(tStats.ulLpnNum, ptConfig->ulPageSize);
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    /* 4.最終照合・統計 */
+    ptResult->ulEraseFails = l_ulSimEraseFails;
+    if (iRet == FROM_SUCCESS) {
+        ptResult->ulVerifyErrors += _FROM_FtlSimVerify(tStats.ulLpnNum, ptConfig->ulPageSize);
+        _FROM_FtlSimAccumulate(ptResult);
+        (void)FROM_FtlGetStats(&ptResult->tStats);
+        if (ptResult->ulHostWrites != 0U) {
+            ptResult->ulWriteAmp = (uint32_t)(((uint64_t)ptResult->ulFlashWrites * 100U) / ptResult->ulHostWrites);
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+    (void)FROM_FtlUnmount();
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_FtlSimGetOps                                                               */
+/*                                                                                              */
+/* DESCRIPTION: NORモデル操作取得                                                               */
+/*              FTL・キー・バリューストアのホストモデルで共用する(容量はFROM_FTL_SIM_SIZE)      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : フラッシュ操作                                                                  */
+/*                                                                                              */
+/************************************************************************************************/
+const FROM_FtlFlashOps *FROM_FtlSimGetOps(void)
+{
+    return &l_tSimOps;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_FtlSimFormat                                                               */
+/*                                                                                              */
+/* DESCRIPTION: NORモデル初期化(全体を消去状態とし、消去回数を初期化する)                       */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+void FROM_FtlSimFormat(void)
+{
+    memset(l_ucSimFlash, 0xFF, sizeof(l_ucSimFlash));
+    l_ulSimEraseCalls = 0U;
+    l_ulSimEraseFails = 0U;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_FtlSimSetFault                                                             */
+/*                                                                                              */
+/* DESCRIPTION: NORモデル故障設定                                                               */
+/*              以降の消去を設定に従って失敗させる(消去内容は変化しない)                        */
+/*              電源断は残りバイト数を超える書き込みの先頭のみを書き込み(消去は前半のみ)、      */
+/*              以降の書き込み・消去を全て失敗させる(再設定で解除する)                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptFault                         故障設定(NULLは故障なし)                        */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+void FROM_FtlSimSetFault(const FROM_FtlSimFault *ptFault)
+{
+    if (ptFault == NULL) {
+        memset(&l_tSimFault, 0, sizeof(l_tSimFault));
+    }
+    else {
+        l_tSimFault = *ptFault;
+    }
+    l_ulSimEraseCalls = 0U;
+    l_ulSimCutLeft    = l_tSimFault.ulPowerCut;
+    l_ulSimReadCalls  = 0U;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_GetSectSize                                                                */
+/*                                                                                              */
+/* DESCRIPTION: セクタサイズ取得(ホスト環境でドライバの代わりに使用する)                        */
+/*              NORモデルの消去単位(FROM_SECT_SIZE)を返す                                       */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(未使用)                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : セクタサイズ                                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+uint32_t FROM_GetSectSize(uint32_t ulDev)
+{
+    (void)ulDev;
+
+    return (uint32_t)FROM_SECT_SIZE;
+}
+
+/****************************************************************************/
+/*  ローカル関数                                                            */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlSimRead                                                                */
+/*                                                                                              */
+/* DESCRIPTION: NORモデル読み出し                                                               */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(未使用)                            */
+/*            : uiAddress                       読み出しアドレス                                */
+/*            : uiLength                        読み出しデータ長                                */
+/*                                                                                              */
+/* OUTPUT     : strReadData                     読み出しデータ格納バッファ                      */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_READ_ERROR                 範囲外、または故障設定による失敗                */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_FtlSimRead(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strReadData)
+{
+    (void)ulDev;
+
+    if ((FROM_FTL_SIM_SIZE < uiLength) || ((FROM_FTL_SIM_SIZE - uiLength) < uiAddress)) {
+        return FROM_READ_ERROR;
+    }
+    else {
+        l_ulSimReadCalls++;
+    }
+
+    /* 故障設定(N回目の読み出しエラー) */
+    if (l_ulSimReadCalls == l_tSimFault.ulReadFailAt) {
+        return FROM_READ_ERROR;
+    }
+    else {
+        memcpy(strReadData, &l_ucSimFlash[uiAddress], uiLength);
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlSimWrite                                                               */
+/*                                                                                              */
+/* DESCRIPTION: NORモデル書き込み(1→0のみ変化する)                                              */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(未使用)                            */
+/*            : uiAddress                       書き込みアドレス                                */
+/*            : uiLength                        書き込みデータ長                                */
+/*            : strWriteData                    書き込みデータ                                  */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_WRITE_ERROR                範囲外、または電源断                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_FtlSimWrite(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData)
+{
+uint32_t ulLen = uiLength;
+uint32_t i     = 0;
+
+    (void)ulDev;
+
+    if ((FROM_FTL_SIM_SIZE < uiLength) || ((FROM_FTL_SIM_SIZE - uiLength) < uiAddress)) {
+        return FROM_WRITE_ERROR;
+    }
+    else if (l_tSimFault.ulPowerCut != 0U) {
+        /* 電源断(残りバイト数までの先頭のみ書き込む) */
+        ulLen = (l_ulSimCutLeft < uiLength) ? l_ulSimCutLeft : uiLength;
+        l_ulSimCutLeft -= ulLen;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    for (i = 0; i < ulLen; i++) {
+        l_ucSimFlash[uiAddress + i] &= strWriteData[i];
+    }
+
+    return (ulLen == uiLength) ? FROM_SUCCESS : FROM_WRITE_ERROR;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlSimErase                                                               */
+/*                                                                                              */
+/* DESCRIPTION: NORモデル消去                                                                   */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(未使用)                            */
+/*            : uiAddress                       消去アドレス(セクタ境界)                        */
+/*            : uiLength                        消去するバイト数(セクタ単位)                    */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_ERASE_ERROR                範囲外、境界不正、故障設定による失敗、電源断    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_FtlSimErase(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength)
+{
+    (void)ulDev;
+
+    if ((FROM_FTL_SIM_SIZE < uiLength) || ((FROM_FTL_SIM_SIZE - uiLength) < uiAddress) ||
+        ((uiAddress % (uint32_t)FROM_SECT_SIZE) != 0U) || ((uiLength % (uint32_t)FROM_SECT_SIZE) != 0U)) {
+        return FROM_ERASE_ERROR;
+    }
+    else {
+        l_ulSimEraseCalls++;
+    }
+
+    /* 電源断(残りが消去1回分に満たなければ前半のみ消去する) */
+    if (l_tSimFault.ulPowerCut != 0U) {
+        if (l_ulSimCutLeft < FROM_FTL_SIM_CUT_ERASE) {
+            if (l_ulSimCutLeft != 0U) {
+                memset(&l_ucSimFlash[uiAddress], 0xFF, uiLength / 2U);
+                l_ulSimCutLeft = 0U;
+            }
+            else {
+                ;   /* do nothing */
+            }
+            return FROM_ERASE_ERROR;
+        }
+        else {
+            l_ulSimCutLeft -= FROM_FTL_SIM_CUT_ERASE;
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* 故障設定(N回毎の一時的なエラー・常に消去エラーとなる領域) */
+    if (((l_tSimFault.ulEraseFailEvery != 0U) && ((l_ulSimEraseCalls % l_tSimFault.ulEraseFailEvery) == 0U)) ||
+        ((l_tSimFault.ulBadSize != 0U) && (uiAddress < (l_tSimFault.ulBadAddr + l_tSimFault.ulBadSize)) &&
+         (l_tSimFault.ulBadAddr < (uiAddress + uiLength)))) {
+        l_ulSimEraseFails++;
+        return FROM_ERASE_ERROR;
+    }
+    else {
+        memset(&l_ucSimFlash[uiAddress], 0xFF, uiLength);
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlSimMakeData                                                            */
+/*                                                                                              */
+/* DESCRIPTION: 照合データ生成(論理ページ番号と書き込み回数から決める)                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulLpn                           論理ページ番号                                  */
+/*            : ulPageSize                      論理ページサイズ                                */
+/*                                                                                              */
+/* OUTPUT     : pucData                         照合データ                                      */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_FtlSimMakeData(uint32_t ulLpn, uint32_t ulPageSize, unsigned char *pucData)
+{
+uint32_t i = 0;
+
+    if (l_ulSimVer[ulLpn] == 0U) {
+        memset(pucData, 0xFF, ulPageSize);  /* 未書き込み */
+    }
+    else {
+        for (i = 0; i < ulPageSize; i++) {
+            pucData[i] = (unsigned char)((ulLpn * 31U) + (l_ulSimVer[ulLpn] * 7U) + i);
+        }
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlSimVerify                                                              */
+/*                                                                                              */
+/* DESCRIPTION: 全論理ページ照合                                                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulLpnNum                        論理ページ数                                    */
+/*            : ulPageSize                      論理ページサイズ                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 不一致数                            読み出しエラーを含む                        */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_FtlSimVerify(uint32_t ulLpnNum, uint32_t ulPageSize)
+{
+uint32_t ulErrors = 0;
+uint32_t i        = 0;
+
+    for (i = 0; i < ulLpnNum; i++) {
+        _FROM_FtlSimMakeData(i, ulPageSize, l_ucSimExp);
+        if ((FROM_FtlRead(i, l_ucSimBuf) != FROM_SUCCESS) ||
+            (memcmp(l_ucSimBuf, l_ucSimExp, ulPageSize) != 0)) {
+            ulErrors++;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    return ulErrors;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlSimRand                                                                */
+/*                                                                                              */
+/* DESCRIPTION: 乱数(xorshift32)                                                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 乱数                              32bit                                         */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_FtlSimRand(void)
+{
+    l_ulSimRand ^= l_ulSimRand << 13;
+    l_ulSimRand ^= l_ulSimRand >> 17;
+    l_ulSimRand ^= l_ulSimRand << 5;
+
+    return l_ulSimRand;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_FtlSimAccumulate                                                          */
+/*                                                                                              */
+/* DESCRIPTION: 統計の積算(アンマウント前に呼び出す)                                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : ptResult                        シミュレーション結果                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_FtlSimAccumulate(FROM_FtlSimResult *ptResult)
+{
+FROM_FtlStats tStats = { 0 };
+
+    if (FROM_FtlGetStats(&tStats) == FROM_SUCCESS) {
+        ptResult->ulHostWrites  += tStats.ulHostWrites;
+        ptResult->ulFlashWrites += tStats.ulFlashWrites;
+        ptResult->ulErases      += tStats.ulErases;
+    }
+    else {
+        ;   /* do nothing */
+    }
+}
@@ -0,0 +1,456 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_spiflash_kv_sim.c                                                   0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      NORドライバ キー・バリューストアホストシミュレーションソースファイル                    */
+/*      (FTLと共用のNORモデル上で書き込み・削除を行い、電源断・読み出しエラーの後に             */
+/*       再マウントして全キーを照合する。ホスト環境専用、ターゲットのビルドには含めない)        */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "code_rules_def.h"
+#include "dri_spiflash.h"
+#include "dri_spiflash_local.h"
+#include "dri_spiflash_sim.h"
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+#define FROM_KV_SIM_NONE        (0xFFFFFFFFU)   /* 未登録(値の長さ) */
+#define FROM_KV_SIM_KEY_SIZE    (8U)            /* キー("kv"+3桁)の格納サイズ */
+
+/* 設定中の故障 */
+#define FROM_KV_SIM_FAULT_NONE  (0U)            /* なし */
+#define FROM_KV_SIM_FAULT_CUT   (1U)            /* 電源断 */
+#define FROM_KV_SIM_FAULT_READ  (2U)            /* 読み出しエラー */
+
+/****************************************************************************/
+/*  ローカルデータ                                                          */
+/****************************************************************************/
+
+/* キー毎の値の長さ(FROM_KV_SIM_NONEは未登録)・書き込み回数(照合データの生成に使用) */
+DLOCAL uint32_t l_ulSimLen[FROM_KV_ENTRY_MAX];
+DLOCAL uint32_t l_ulSimVer[FROM_KV_ENTRY_MAX];
+
+/* 照合用バッファ */
+DLOCAL unsigned char l_ucSimBuf[FROM_KV_VALUE_MAX];
+DLOCAL unsigned char l_ucSimExp[FROM_KV_VALUE_MAX];
+
+/* キー・バリューストア設定(再マウントで使用) */
+DLOCAL FROM_KvConfig l_tSimKv;
+
+/* 乱数(xorshift32) */
+DLOCAL uint32_t l_ulSimRand;
+
+/****************************************************************************/
+/*  ローカル関数宣言                                                        */
+/****************************************************************************/
+
+/* 再マウント */
+LOCAL int _FROM_KvSimRemount(const FROM_KvSimConfig *ptConfig, uint32_t ulAbort, FROM_KvSimResult *ptResult);
+
+/* キー・照合データ生成、照合 */
+LOCAL void _FROM_KvSimKey(uint32_t ulKey, char *pcKey);
+LOCAL void _FROM_KvSimMakeData(uint32_t ulKey, uint32_t ulVer, uint32_t ulLen, unsigned char *pucData);
+LOCAL uint32_t _FROM_KvSimMatch(uint32_t ulKey, uint32_t ulLen, uint32_t ulVer);
+LOCAL uint32_t _FROM_KvSimVerify(uint32_t ulKeys);
+
+/* 乱数 */
+LOCAL uint32_t _FROM_KvSimRand(void);
+
+/* 状態の積算(再マウントで状態がクリアされるため) */
+LOCAL void _FROM_KvSimAccumulate(FROM_KvSimResult *ptResult);
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_KvSimRun                                                                   */
+/*                                                                                              */
+/* DESCRIPTION: キー・バリューストアホストシミュレーション実行                                  */
+/*              NORモデルの先頭ulSectNumページを管理領域とし、ランダムなキーへ書き込み・削除する*/
+/*              故障(電源断・読み出しエラー)を設定した操作が失敗したら再マウントし              */
+/*              (先に読み出しエラーでマウントを中止させる)、失敗したキーは操作前・後のどちらか、*/
+/*              他のキーは最後に成功した操作と一致することを照合する                            */
+/*              (定期的な再マウントでも照合する)                                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptConfig                        シミュレーション設定                            */
+/*                                                                                              */
+/* OUTPUT     : ptResult                        シミュレーション結果                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              その他                             FROM_Kv*の戻り値                             */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_KvSimRun(const FROM_KvSimConfig *ptConfig, FROM_KvSimResult *ptResult)
+{
+FROM_FtlSimFault tFault             = { 0 };
+char cKey[FROM_KV_SIM_KEY_SIZE]     = { 0 };
+uint32_t ulKey                      = 0;
+uint32_t ulOldLen                   = 0;
+uint32_t ulOldVer                   = 0;
+uint32_t ulFault                    = FROM_KV_SIM_FAULT_NONE;
+uint32_t i                          = 0;
+int iRet                            = FROM_SUCCESS;
+
+    /* パラメータチェック */
+    if ((ptConfig == NULL) || (ptResult == NULL) ||
+        (ptConfig->ulKeys == 0U) || (FROM_KV_ENTRY_MAX < ptConfig->ulKeys) ||
+        (FROM_KV_VALUE_MAX < ptConfig->ulValueMax) || (100U < ptConfig->ulDelPercent) ||
+        (ptConfig->ulSectNum == 0U) || ((FROM_FTL_SIM_SIZE / ptConfig->ulSectNum) < ptConfig->ulSectSize) ||
+        ((ptConfig->ulFaultEvery != 0U) && ((ptConfig->ulCutMax == 0U) || (ptConfig->ulReadFailMax == 0U)))) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        memset(ptResult, 0, sizeof(*ptResult));
+    }
+
+    /* 1.未使用のデバイスとしてマウント */
+    FROM_FtlSimFormat();
+    FROM_FtlSimSetFault(NULL);
+    for (i = 0; i < FROM_KV_ENTRY_MAX; i++) {
+        l_ulSimLen[i] = FROM_KV_SIM_NONE;
+        l_ulSimVer[i] = 0U;
+    }
+    l_ulSimRand = (ptConfig->ulSeed != 0U) ? ptConfig->ulSeed : 1U;
+
+    l_tSimKv.ptOps      = FROM_FtlSimGetOps();
+    l_tSimKv.ulDev      = FROM_DEV_0;
+    l_tSimKv.ulAddress  = 0U;
+    l_tSimKv.ulSize     = ptConfig->ulSectSize * ptConfig->ulSectNum;
+    l_tSimKv.ulSectSize = ptConfig->ulSectSize;
+    iRet = FROM_KvMount(&l_tSimKv);
+
+    /* 2.書き込み・削除 */
+    for (i = 0; (i < ptConfig->ulOps) && (iRet == FROM_SUCCESS); i++) {
+        /* 故障設定(電源断・読み出しエラーを交互に、操作が失敗するまで解除しない) */
+        if ((ulFault == FROM_KV_SIM_FAULT_NONE) &&
+            (ptConfig->ulFaultEvery != 0U) && (((i + 1U) % ptConfig->ulFaultEvery) == 0U)) {
+            memset(&tFault, 0, sizeof(tFault));
+            if ((((i + 1U) / ptConfig->ulFaultEvery) % 2U) != 0U) {
+                tFault.ulPowerCut = (_FROM_KvSimRand() % ptConfig->ulCutMax) + 1U;
+                ulFault = FROM_KV_SIM_FAULT_CUT;
+            }
+            else {
+                tFault.ulReadFailAt = (_FROM_KvSimRand() % ptConfig->ulReadFailMax) + 1U;
+                ulFault = FROM_KV_SIM_FAULT_READ;
+            }
+            FROM_FtlSimSetFault(&tFault);
+        }
+        else {
+            ;   /* do nothing */
+        }
+
+        /* 書き込み(登録済みキーはulDelPercent%を削除)、照合用の値は操作後とする */
+        ulKey    = _FROM_KvSimRand() % ptConfig->ulKeys;
+        ulOldLen = l_ulSimLen[ulKey];
+        ulOldVer = l_ulSimVer[ulKey];
+        _FROM_KvSimKey(ulKey, cKey);
+        if ((ulOldLen != FROM_KV_SIM_NONE) && ((_FROM_KvSimRand() % 100U) < ptConfig->ulDelPercent)) {
+            l_ulSimLen[ulKey] = FROM_KV_SIM_NONE;
+            iRet = FROM_KvDelete(cKey);
+        }
+        else {
+            l_ulSimVer[ulKey]++;
+            l_ulSimLen[ulKey] = _FROM_KvSimRand() % (ptConfig->ulValueMax + 1U);
+            _FROM_KvSimMakeData(ulKey, l_ulSimVer[ulKey], l_ulSimLen[ulKey], l_ucSimBuf);
+            iRet = FROM_KvSet(cKey, l_ucSimBuf, l_ulSimLen[ulKey]);
+        }
+        ptResult->ulOps++;
+
+        if ((iRet != FROM_SUCCESS) && (ulFault != FROM_KV_SIM_FAULT_NONE)) {
+            /* 故障による失敗(故障を解除して再マウント) */
+            if (ulFault == FROM_KV_SIM_FAULT_CUT) {
+                ptResult->ulPowerCuts++;
+            }
+            else {
+                ptResult->ulReadFails++;
+            }
+            ulFault = FROM_KV_SIM_FAULT_NONE;
+            FROM_FtlSimSetFault(NULL);
+            iRet = _FROM_KvSimRemount(ptConfig, 1U, ptResult);
+
+            /* 失敗したキーは操作前・後のどちらか(操作前なら照合用の値を戻す)、他のキーは一致すること */
+            if (iRet == FROM_SUCCESS) {
+                if (_FROM_KvSimMatch(ulKey, l_ulSimLen[ulKey], l_ulSimVer[ulKey]) != 0U) {
+                    ptResult->ulApplied++;
+                }
+                else {
+                    l_ulSimLen[ulKey] = ulOldLen;
+                    l_ulSimVer[ulKey] = ulOldVer;
+                }
+                ptResult->ulVerifyErrors += _FROM_KvSimVerify(ptConfig->ulKeys);
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        else if ((iRet == FROM_SUCCESS) && (ulFault == FROM_KV_SIM_FAULT_NONE) &&
+                 (ptConfig->ulRemount != 0U) && (((i + 1U) % ptConfig->ulRemount) == 0U)) {
+            /* 再マウント(故障設定中は行わない)・照合 */
+            iRet = _FROM_KvSimRemount(ptConfig, 0U, ptResult);
+            if (iRet == FROM_SUCCESS) {
+                ptResult->ulVerifyErrors += _FROM_KvSimVerify(ptConfig->ulKeys);
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    /* 3.最終照合・状態 */
+    FROM_FtlSimSetFault(NULL);
+    if (iRet == FROM_SUCCESS) {
+        ptResult->ulVerifyErrors += _FROM_KvSimVerify(ptConfig->ulKeys);
+        _FROM_KvSimAccumulate(ptResult);
+        (void)FROM_KvGetStatus(&ptResult->tStatus);
+    }
+    else {
+        ;   /* do nothing */
+    }
+    (void)FROM_KvUnmount();
+
+    return iRet;
+}
+
+/****************************************************************************/
+/*  ローカル関数                                                            */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvSimRemount                                                              */
+/*                                                                                              */
+/* DESCRIPTION: 再マウント(電源再投入の模擬)                                                    */
+/*              ulAbortが0以外なら、先にN回目の読み出しを失敗させてマウントし、                 */
+/*              読み出しエラーで中止することを確認する(中止後の再マウントで照合する)            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptConfig                        シミュレーション設定                            */
+/*            : ulAbort                         読み出しエラーでマウントを中止させる(0以外)     */
+/*                                                                                              */
+/* OUTPUT     : ptResult                        シミュレーション結果                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              その他                             マウントのエラー(FROM_KvMountの戻り値)       */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_KvSimRemount(const FROM_KvSimConfig *ptConfig, uint32_t ulAbort, FROM_KvSimResult *ptResult)
+{
+FROM_FtlSimFault tFault = { 0 };
+int iRet                = FROM_SUCCESS;
+
+    _FROM_KvSimAccumulate(ptResult);
+    (void)FROM_KvUnmount();
+
+    /* 読み出しエラーでのマウント中止(途中まで読んだページは消去しない) */
+    if (ulAbort != 0U) {
+        tFault.ulReadFailAt = (_FROM_KvSimRand() % ptConfig->ulReadFailMax) + 1U;
+        FROM_FtlSimSetFault(&tFault);
+        iRet = FROM_KvMount(&l_tSimKv);
+        FROM_FtlSimSetFault(NULL);
+        if (iRet == FROM_READ_ERROR) {
+            ptResult->ulMountAborts++;
+        }
+        else if (iRet == FROM_SUCCESS) {
+            _FROM_KvSimAccumulate(ptResult);    /* 読み出し回数が足りず、エラーにならなかった */
+            (void)FROM_KvUnmount();
+        }
+        else {
+            return iRet;
+        }
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    iRet = FROM_KvMount(&l_tSimKv);
+    if (iRet == FROM_SUCCESS) {
+        ptResult->ulRemounts++;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    return iRet;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvSimKey                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: キー生成("kv"+キー番号3桁)                                                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulKey                           キー番号                                        */
+/*                                                                                              */
+/* OUTPUT     : pcKey                           キー(FROM_KV_SIM_KEY_SIZE)                      */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_KvSimKey(uint32_t ulKey, char *pcKey)
+{
+    pcKey[0] = 'k';
+    pcKey[1] = 'v';
+    pcKey[2] = (char)('0' + ((ulKey / 100U) % 10U));
+    pcKey[3] = (char)('0' + ((ulKey / 10U) % 10U));
+    pcKey[4] = (char)('0' + (ulKey % 10U));
+    pcKey[5] = '\0';
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvSimMakeData                                                             */
+/*                                                                                              */
+/* DESCRIPTION: 照合データ生成(キー番号と書き込み回数から決める)                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulKey                           キー番号                                        */
+/*            : ulVer                           書き込み回数                                    */
+/*            : ulLen                           値の長さ                                        */
+/*                                                                                              */
+/* OUTPUT     : pucData                         照合データ                                      */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_KvSimMakeData(uint32_t ulKey, uint32_t ulVer, uint32_t ulLen, unsigned char *pucData)
+{
+uint32_t i = 0;
+
+    for (i = 0; i < ulLen; i++) {
+        pucData[i] = (unsigned char)((ulKey * 37U) + (ulVer * 11U) + i);
+    }
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvSimMatch                                                                */
+/*                                                                                              */
+/* DESCRIPTION: キー照合                                                                        */
+/*              値の長さ・書き込み回数から作った照合データと一致するか判定する                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulKey                           キー番号                                        */
+/*            : ulLen                           値の長さ(FROM_KV_SIM_NONEは未登録)              */
+/*            : ulVer                           書き込み回数                                    */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 1                               一致                                            */
+/*              0                               不一致(読み出しエラーを含む)                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_KvSimMatch(uint32_t ulKey, uint32_t ulLen, uint32_t ulVer)
+{
+char cKey[FROM_KV_SIM_KEY_SIZE] = { 0 };
+uint32_t ulRead                 = 0;
+int iRet                        = FROM_SUCCESS;
+
+    _FROM_KvSimKey(ulKey, cKey);
+    iRet = FROM_KvGet(cKey, l_ucSimBuf, (uint32_t)sizeof(l_ucSimBuf), &ulRead);
+    if (ulLen == FROM_KV_SIM_NONE) {
+        return (iRet == FROM_NOENT_ERROR) ? 1U : 0U;
+    }
+    else if ((iRet != FROM_SUCCESS) || (ulRead != ulLen)) {
+        return 0U;
+    }
+    else {
+        _FROM_KvSimMakeData(ulKey, ulVer, ulLen, l_ucSimExp);
+    }
+
+    return (memcmp(l_ucSimBuf, l_ucSimExp, ulLen) == 0) ? 1U : 0U;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvSimVerify                                                               */
+/*                                                                                              */
+/* DESCRIPTION: 全キー照合                                                                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulKeys                          キー数                                          */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 不一致数                                                                        */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_KvSimVerify(uint32_t ulKeys)
+{
+uint32_t ulErrors = 0;
+uint32_t i        = 0;
+
+    for (i = 0; i < ulKeys; i++) {
+        if (_FROM_KvSimMatch(i, l_ulSimLen[i], l_ulSimVer[i]) == 0U) {
+            ulErrors++;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    return ulErrors;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvSimRand                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: 乱数(xorshift32)                                                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 乱数                              32bit                                         */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_KvSimRand(void)
+{
+    l_ulSimRand ^= l_ulSimRand << 13;
+    l_ulSimRand ^= l_ulSimRand >> 17;
+    l_ulSimRand ^= l_ulSimRand << 5;
+
+    return l_ulSimRand;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_KvSimAccumulate                                                           */
+/*                                                                                              */
+/* DESCRIPTION: 状態の積算(アンマウント前に呼び出す)                                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : ptResult                        シミュレーション結果                            */
+/*                                                                                              */
+/* RESULTS    : none                                                                            */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL void _FROM_KvSimAccumulate(FROM_KvSimResult *ptResult)
+{
+FROM_KvStatus tStatus = { 0 };
+
+    if (FROM_KvGetStatus(&tStatus) == FROM_SUCCESS) {
+        ptResult->ulCompactions += tStatus.ulCompactions;
+        ptResult->ulErases      += tStatus.ulErases;
+    }
+    else {
+        ;   /* do nothing */
+    }
+}
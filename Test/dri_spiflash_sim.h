@@ -0,0 +1,152 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_spiflash_sim.h                                                      0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      NORドライバ ホストモデルヘッダファイル                                                  */
+/*      (ホスト環境専用、ターゲットのビルドには含めない)                                        */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+#ifndef _DRI_SPIFLASH_SIM_H_
+#define _DRI_SPIFLASH_SIM_H_
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+/* ページ分割書き込み照合 */
+#define FROM_SPLIT_SIM_SIZE         (0x2000U)       /* RAMモデルの容量 */
+#define FROM_SPLIT_SIM_DATA_MAX     (0x1000U)       /* 照合で1回に書き込める最大長 */
+
+/* FTLホストシミュレーション */
+#define FROM_FTL_SIM_SIZE           (0x40000U)      /* RAMモデルの容量 */
+
+/****************************************************************************/
+/*  構造体定義                                                              */
+/****************************************************************************/
+
+/* ページ分割書き込み照合設定(FROM_SplitSimRunの引数) */
+typedef struct FROM_SplitSimConfig_tag {
+    uint32_t        ulPageSize;     /* ページプログラム単位 */
+    uint32_t        ulWidth;        /* インターリーブ単位 */
+    uint32_t        ulChunkMax;     /* 1回の書き込みの最大長 */
+    uint32_t        ulMaxOffset;    /* 書き込み開始位置(ページ境界からのずれ)の最大 */
+    uint32_t        ulMaxLength;    /* 書き込み長の最大(FROM_SPLIT_SIM_DATA_MAXまで) */
+} FROM_SplitSimConfig;
+
+/* ページ分割書き込み照合結果 */
+typedef struct FROM_SplitSimResult_tag {
+    uint32_t        ulRuns;         /* FROM_SplitWriteの呼び出し回数 */
+    uint32_t        ulWrites;       /* 1回の書き込み(pfnWrite)の回数 */
+    uint32_t        ulViolations;   /* ページ境界を跨ぐ・インターリーブ単位でない・最大長を超える書き込み数 */
+    uint32_t        ulErrors;       /* 書き込み範囲のデータ不一致・範囲外の変化があった呼び出し回数 */
+} FROM_SplitSimResult;
+
+/* NORモデル故障設定(FROM_FtlSimSetFaultの引数) */
+typedef struct FROM_FtlSimFault_tag {
+    uint32_t        ulEraseFailEvery;   /* 消去をN回毎に1回失敗させる(一時的なエラーの模擬、0は行わない) */
+    uint32_t        ulBadAddr;      /* 常に消去エラーとなる領域の先頭(寿命に達したブロックの模擬) */
+    uint32_t        ulBadSize;      /* 常に消去エラーとなる領域のサイズ(0はなし) */
+    uint32_t        ulPowerCut;     /* 電源断までに書き込めるバイト数(0は行わない、以降の書き込み・消去は失敗する) */
+    uint32_t        ulReadFailAt;   /* N回目の読み出しを1回失敗させる(0は行わない) */
+} FROM_FtlSimFault;
+
+/* FTLシミュレーション設定(FROM_FtlSimRunの引数) */
+typedef struct FROM_FtlSimConfig_tag {
+    uint32_t        ulBlkSize;      /* ブロックサイズ */
+    uint32_t        ulPageSize;     /* 論理ページサイズ */
+    uint32_t        ulReserve;      /* 予備ブロック数 */
+    uint32_t        ulWearDelta;    /* 静的ウェアレベリングを行う消去回数の差 */
+    uint32_t        ulPrefill;      /* 事前に書き込む論理ページの割合(%、更新されないデータの模擬) */
+    uint32_t        ulWrites;       /* 書き込み回数(事前書き込みを除く) */
+    uint32_t        ulHotPages;     /* 書き込みが集中する論理ページ数(先頭から) */
+    uint32_t        ulHotPercent;   /* 集中する書き込みの割合(%) */
+    uint32_t        ulRemount;      /* 再マウント(電源再投入の模擬)間隔(書き込み回数、0は行わない) */
+    uint32_t        ulSeed;         /* 乱数の種 */
+} FROM_FtlSimConfig;
+
+/* FTLシミュレーション結果 */
+typedef struct FROM_FtlSimResult_tag {
+    FROM_FtlStats   tStats;         /* FTL統計(最後のマウント以降、消去回数はブロック毎の累計) */
+    uint32_t        ulHostWrites;   /* 論理ページ書き込み回数(全期間、事前書き込みを含む) */
+    uint32_t        ulFlashWrites;  /* 物理ページ書き込み回数(全期間) */
+    uint32_t        ulErases;       /* 消去回数(全期間) */
+    uint32_t        ulWriteAmp;     /* 書き込み増幅率(全期間、100倍) */
+    uint32_t        ulInPlaceErases;    /* 同じ書き込みをセクタ単位の読み出し・消去・書き込みで行った場合の消去回数 */
+    uint32_t        ulVerifyErrors; /* 読み出し照合の不一致数 */
+    uint32_t        ulEraseFails;   /* NORモデルが失敗させた消去の回数(FROM_FtlSimSetFaultの設定による) */
+} FROM_FtlSimResult;
+
+/* キー・バリューストアシミュレーション設定(FROM_KvSimRunの引数) */
+typedef struct FROM_KvSimConfig_tag {
+    uint32_t        ulSectSize;     /* ページサイズ(セクタの倍数) */
+    uint32_t        ulSectNum;      /* ページ数 */
+    uint32_t        ulKeys;         /* 使用するキー数(FROM_KV_ENTRY_MAXまで) */
+    uint32_t        ulValueMax;     /* 値の長さの最大(FROM_KV_VALUE_MAXまで) */
+    uint32_t        ulDelPercent;   /* 削除の割合(%) */
+    uint32_t        ulOps;          /* 書き込み・削除の回数 */
+    uint32_t        ulRemount;      /* 再マウント間隔(書き込み・削除の回数、0は行わない) */
+    uint32_t        ulFaultEvery;   /* 故障(電源断・読み出しエラーを交互)を設定する間隔(0は行わない) */
+    uint32_t        ulCutMax;       /* 電源断までに書き込めるバイト数の最大 */
+    uint32_t        ulReadFailMax;  /* 読み出しエラーとする読み出し回数の最大 */
+    uint32_t        ulSeed;         /* 乱数の種 */
+} FROM_KvSimConfig;
+
+/* キー・バリューストアシミュレーション結果 */
+typedef struct FROM_KvSimResult_tag {
+    FROM_KvStatus   tStatus;        /* キー・バリューストア状態(最後のマウント以降) */
+    uint32_t        ulOps;          /* 書き込み・削除の回数(失敗を含む) */
+    uint32_t        ulRemounts;     /* 再マウント回数(故障後を含む) */
+    uint32_t        ulPowerCuts;    /* 電源断で失敗した書き込み・削除の回数 */
+    uint32_t        ulReadFails;    /* 読み出しエラーで失敗した書き込み・削除の回数 */
+    uint32_t        ulMountAborts;  /* 読み出しエラーで中止したマウントの回数 */
+    uint32_t        ulApplied;      /* 失敗した書き込み・削除が再マウント後に反映されていた回数 */
+    uint32_t        ulCompactions;  /* コンパクション回数(全期間) */
+    uint32_t        ulErases;       /* 消去回数(全期間) */
+    uint32_t        ulVerifyErrors; /* 照合の不一致数 */
+} FROM_KvSimResult;
+
+/****************************************************************************/
+/*  関数宣言                                                                */
+/****************************************************************************/
+
+/* ページ分割書き込み照合(dri_spiflash_split_sim.c) */
+int FROM_SplitSimRun(const FROM_SplitSimConfig *ptConfig, FROM_SplitSimResult *ptResult);
+
+/* FTLホストシミュレーション(dri_spiflash_ftl_sim.c、RAMモデル上で書き込み増幅率・消去回数を求める) */
+int FROM_FtlSimRun(const FROM_FtlSimConfig *ptConfig, FROM_FtlSimResult *ptResult);
+
+/* NORモデル(dri_spiflash_ftl_sim.c、FTL・キー・バリューストアのホストモデルで共用する) */
+const FROM_FtlFlashOps *FROM_FtlSimGetOps(void);
+void FROM_FtlSimFormat(void);
+void FROM_FtlSimSetFault(const FROM_FtlSimFault *ptFault);
+
+/* キー・バリューストアホストシミュレーション(dri_spiflash_kv_sim.c、電源断・読み出しエラー後の再マウントで照合する) */
+int FROM_KvSimRun(const FROM_KvSimConfig *ptConfig, FROM_KvSimResult *ptResult);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif /* _DRI_SPIFLASH_SIM_H_ */
@@ -0,0 +1,284 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_spiflash_simrun.c                                                   0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      NORドライバ ホストモデル実行ソースファイル                                              */
+/*      (ホストモデル(dri_spiflash_*_sim.c)を実行し、期待する結果と照合する。                   */
+/*       ホスト環境専用。ビルド例(ホスト用のdri_spiflash.h等をインクルードパスに置く):          */
+/*        cc -I../Src dri_spiflash_simrun.c dri_spiflash_split_sim.c dri_spiflash_ftl_sim.c     */
+/*           dri_spiflash_kv_sim.c ../Src/dri_spiflash_xfer.c ../Src/dri_spiflash_ftl.c         */
+/*           ../Src/dri_spiflash_kv.c ../Src/dri_spiflash_cal.c                                 */
+/*       照合結果がすべて期待通りなら0、それ以外は1で終了する)                                  */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "code_rules_def.h"
+#include "dri_spiflash.h"
+#include "dri_spiflash_local.h"
+#include "dri_spiflash_sim.h"
+
+/****************************************************************************/
+/*  定数・マクロ定義                                                        */
+/****************************************************************************/
+
+#define FROM_SIMRUN_SPLIT_CHUNK     (128U)      /* ページ分割照合の1回の書き込みの最大長(TX FIFO容量) */
+
+/* FTLホストシミュレーション */
+#define FROM_SIMRUN_FTL_CASES       (3U)        /* 故障なし・一時的な消去エラー・消去エラーブロック */
+#define FROM_SIMRUN_FTL_FAIL_EVERY  (7U)        /* 一時的な消去エラーの間隔(消去回数) */
+#define FROM_SIMRUN_FTL_BAD_BLK     (5U)        /* 常に消去エラーとなるブロック */
+#define FROM_SIMRUN_FTL_RETRY_MAX   (3U)        /* 消去エラーブロックの消去試行回数の上限(再マウントでは消去しない) */
+
+/* キー・バリューストアホストシミュレーション */
+#define FROM_SIMRUN_KV_CASES        (2U)        /* 故障なし・電源断と読み出しエラー */
+#define FROM_SIMRUN_KV_FAULT_EVERY  (25U)       /* 故障を設定する間隔(書き込み・削除の回数) */
+
+/****************************************************************************/
+/*  ローカル関数宣言                                                        */
+/****************************************************************************/
+
+LOCAL int _FROM_SimRunSplit(void);
+LOCAL int _FROM_SimRunFtl(void);
+LOCAL int _FROM_SimRunKv(void);
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : main                                                                            */
+/*                                                                                              */
+/* DESCRIPTION: ホストモデル実行                                                                */
+/*              各モデルを実行し、期待する結果と照合する                                        */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 0                               すべて期待通り                                  */
+/*              1                               期待と異なる結果がある                          */
+/*                                                                                              */
+/************************************************************************************************/
+int main(void)
+{
+int iFail = 0;
+
+    iFail |= _FROM_SimRunSplit();
+    iFail |= _FROM_SimRunFtl();
+    iFail |= _FROM_SimRunKv();
+
+    printf("%s\n", (iFail == 0) ? "PASS" : "FAIL");
+
+    return (iFail == 0) ? 0 : 1;
+}
+
+/****************************************************************************/
+/*  ローカル関数                                                            */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SimRunSplit                                                               */
+/*                                                                                              */
+/* DESCRIPTION: ページ分割書き込み照合                                                          */
+/*              インターリーブ単位1(単体)・2(パラレルモード)で、ページ境界を跨ぐ・              */
+/*              インターリーブ単位でない・最大長を超える書き込みがなく、                        */
+/*              書き込み結果が一致することを照合する                                            */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 0                               期待通り                                        */
+/*              1                               期待と異なる                                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_SimRunSplit(void)
+{
+FROM_SplitSimConfig tConfig = { 0 };
+FROM_SplitSimResult tResult = { 0 };
+uint32_t ulWidth            = 0;
+int iRet                    = FROM_SUCCESS;
+
+    for (ulWidth = 1U; ulWidth <= FROM_SPLIT_WIDTH_MAX; ulWidth++) {
+        tConfig.ulPageSize  = FROM_PAGE_SIZE * ulWidth;
+        tConfig.ulWidth     = ulWidth;
+        tConfig.ulChunkMax  = FROM_SIMRUN_SPLIT_CHUNK;
+        tConfig.ulMaxOffset = tConfig.ulPageSize + ulWidth;
+        tConfig.ulMaxLength = (tConfig.ulPageSize * 2U) + 3U;
+        iRet = FROM_SplitSimRun(&tConfig, &tResult);
+
+        printf("split width %u: runs %u writes %u violations %u errors %u\n",
+               (unsigned)ulWidth, (unsigned)tResult.ulRuns, (unsigned)tResult.ulWrites,
+               (unsigned)tResult.ulViolations, (unsigned)tResult.ulErrors);
+
+        if ((iRet != FROM_SUCCESS) || (tResult.ulRuns == 0U) || (tResult.ulWrites == 0U) ||
+            (tResult.ulViolations != 0U) || (tResult.ulErrors != 0U)) {
+            return 1;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    return 0;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SimRunFtl                                                                 */
+/*                                                                                              */
+/* DESCRIPTION: FTLホストシミュレーション照合                                                   */
+/*              故障なし・一時的な消去エラー・常に消去エラーとなるブロックの各場合で、          */
+/*              再マウントを繰り返しても全論理ページが一致することを照合する                    */
+/*              一時的な消去エラーは再試行で消去エラーブロックとせず、消去エラーブロックは      */
+/*              ヘッダに記録して再マウント後も消去しないことを確認する                          */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 0                               期待通り                                        */
+/*              1                               期待と異なる                                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_SimRunFtl(void)
+{
+FROM_FtlSimConfig tConfig = { 0 };
+FROM_FtlSimFault tFault   = { 0 };
+FROM_FtlSimResult tResult = { 0 };
+uint32_t ulCase           = 0;
+int iRet                  = FROM_SUCCESS;
+int iFail                 = 0;
+
+    tConfig.ulBlkSize    = FROM_SECT_SIZE;
+    tConfig.ulPageSize   = FROM_PAGE_SIZE;
+    tConfig.ulReserve    = 4U;
+    tConfig.ulWearDelta  = 8U;
+    tConfig.ulPrefill    = 50U;
+    tConfig.ulWrites     = 20000U;
+    tConfig.ulHotPages   = 16U;
+    tConfig.ulHotPercent = 80U;
+    tConfig.ulRemount    = 1000U;
+    tConfig.ulSeed       = 1U;
+
+    for (ulCase = 0; ulCase < FROM_SIMRUN_FTL_CASES; ulCase++) {
+        memset(&tFault, 0, sizeof(tFault));
+        if (ulCase == 1U) {
+            tFault.ulEraseFailEvery = FROM_SIMRUN_FTL_FAIL_EVERY;
+        }
+        else if (ulCase == 2U) {
+            tFault.ulBadAddr = FROM_SIMRUN_FTL_BAD_BLK * tConfig.ulBlkSize;
+            tFault.ulBadSize = tConfig.ulBlkSize;
+        }
+        else {
+            ;   /* do nothing */
+        }
+        FROM_FtlSimSetFault(&tFault);
+        iRet = FROM_FtlSimRun(&tConfig, &tResult);
+        FROM_FtlSimSetFault(NULL);
+
+        printf("ftl case %u: erases %u (in-place %u) wa %u.%02u wear %u-%u bad %u erase fails %u verify errors %u\n",
+               (unsigned)ulCase, (unsigned)tResult.ulErases, (unsigned)tResult.ulInPlaceErases,
+               (unsigned)(tResult.ulWriteAmp / 100U), (unsigned)(tResult.ulWriteAmp % 100U),
+               (unsigned)tResult.tStats.ulEraseMin, (unsigned)tResult.tStats.ulEraseMax,
+               (unsigned)tResult.tStats.ulBadBlks, (unsigned)tResult.ulEraseFails, (unsigned)tResult.ulVerifyErrors);
+
+        if ((iRet != FROM_SUCCESS) || (tResult.ulVerifyErrors != 0U) ||
+            (tResult.ulInPlaceErases <= tResult.ulErases)) {
+            iFail = 1;
+        }
+        else if (ulCase == 0U) {
+            iFail |= ((tResult.ulEraseFails != 0U) || (tResult.tStats.ulBadBlks != 0U)) ? 1 : 0;
+        }
+        else if (ulCase == 1U) {
+            iFail |= ((tResult.ulEraseFails == 0U) || (tResult.tStats.ulBadBlks != 0U)) ? 1 : 0;
+        }
+        else {
+            iFail |= ((tResult.tStats.ulBadBlks != 1U) || (tResult.ulEraseFails == 0U) ||
+                      (FROM_SIMRUN_FTL_RETRY_MAX < tResult.ulEraseFails)) ? 1 : 0;
+        }
+    }
+
+    return iFail;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SimRunKv                                                                  */
+/*                                                                                              */
+/* DESCRIPTION: キー・バリューストアホストシミュレーション照合                                  */
+/*              故障なし・電源断と読み出しエラーの各場合で、コンパクションと                    */
+/*              再マウントを繰り返しても全キーが一致することを照合する                          */
+/*              (故障ありでは電源断・読み出しエラーによる失敗と、                               */
+/*               読み出しエラーでのマウント中止が起きていることを確認する)                      */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : none                                                                            */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 0                               期待通り                                        */
+/*              1                               期待と異なる                                    */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_SimRunKv(void)
+{
+FROM_KvSimConfig tConfig = { 0 };
+FROM_KvSimResult tResult = { 0 };
+uint32_t ulCase          = 0;
+int iRet                 = FROM_SUCCESS;
+int iFail                = 0;
+
+    tConfig.ulSectSize    = FROM_SECT_SIZE;
+    tConfig.ulSectNum     = 4U;
+    tConfig.ulKeys        = 24U;
+    tConfig.ulValueMax    = 48U;
+    tConfig.ulDelPercent  = 20U;
+    tConfig.ulOps         = 20000U;
+    tConfig.ulRemount     = 500U;
+    tConfig.ulCutMax      = 2048U;
+    tConfig.ulReadFailMax = 200U;
+    tConfig.ulSeed        = 1U;
+
+    for (ulCase = 0; ulCase < FROM_SIMRUN_KV_CASES; ulCase++) {
+        tConfig.ulFaultEvery = (ulCase == 0U) ? 0U : FROM_SIMRUN_KV_FAULT_EVERY;
+        iRet = FROM_KvSimRun(&tConfig, &tResult);
+
+        printf("kv case %u: ops %u compactions %u erases %u remounts %u power cuts %u read fails %u "
+               "mount aborts %u applied %u verify errors %u\n",
+               (unsigned)ulCase, (unsigned)tResult.ulOps, (unsigned)tResult.ulCompactions,
+               (unsigned)tResult.ulErases, (unsigned)tResult.ulRemounts, (unsigned)tResult.ulPowerCuts,
+               (unsigned)tResult.ulReadFails, (unsigned)tResult.ulMountAborts, (unsigned)tResult.ulApplied,
+               (unsigned)tResult.ulVerifyErrors);
+
+        if ((iRet != FROM_SUCCESS) || (tResult.ulVerifyErrors != 0U) ||
+            (tResult.ulOps != tConfig.ulOps) || (tResult.ulCompactions == 0U) || (tResult.ulRemounts == 0U)) {
+            iFail = 1;
+        }
+        else if (ulCase == 0U) {
+            iFail |= ((tResult.ulPowerCuts != 0U) || (tResult.ulReadFails != 0U)) ? 1 : 0;
+        }
+        else {
+            iFail |= ((tResult.ulPowerCuts == 0U) || (tResult.ulReadFails == 0U) ||
+                      (tResult.ulMountAborts == 0U)) ? 1 : 0;
+        }
+    }
+
+    return iFail;
+}
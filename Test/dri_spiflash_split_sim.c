@@ -0,0 +1,230 @@
+/************************************************************************************************/
+/*                                                                                              */
+/* FILE NAME                                                                    VERSION         */
+/*                                                                                              */
+/*      dri_spiflash_split_sim.c                                                0.00            */
+/*                                                                                              */
+/* DESCRIPTION:                                                                                 */
+/*                                                                                              */
+/*      NORドライバ ページ分割書き込み照合ソースファイル                                        */
+/*      (RAM上のNORモデルに対してFROM_WriteDevのページ分割(FROM_SplitWrite)を照合する。         */
+/*       ホスト環境専用、ターゲットのビルドには含めない)                                        */
+/*                                                                                              */
+/* HISTORY                                                                                      */
+/*                                                                                              */
+/*      NAME            DATE        REMARKS                                                     */
+/*                                                                                              */
+/*                      2026/10/18  Version 0.00                                                */
+/*                                  新規作成                                                    */
+/*                                                                                              */
+/************************************************************************************************/
+
+/****************************************************************************/
+/*  インクルードファイル                                                    */
+/****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "code_rules_def.h"
+#include "dri_spiflash.h"
+#include "dri_spiflash_local.h"
+#include "dri_spiflash_sim.h"
+
+/****************************************************************************/
+/*  ローカルデータ                                                          */
+/****************************************************************************/
+
+/* NORモデル(書き込みは1→0のみ変化する) */
+DLOCAL unsigned char l_ucSplitFlash[FROM_SPLIT_SIM_SIZE];
+
+/* 書き込みデータ */
+DLOCAL unsigned char l_ucSplitData[FROM_SPLIT_SIM_DATA_MAX];
+
+/* 実行中の設定・結果 */
+DLOCAL const FROM_SplitSimConfig *l_ptSplitConfig;
+DLOCAL FROM_SplitSimResult *l_ptSplitResult;
+
+/****************************************************************************/
+/*  ローカル関数宣言                                                        */
+/****************************************************************************/
+
+/* 1回の書き込みの制約チェック・NORモデルへの書き込み */
+LOCAL int _FROM_SplitSimWrite(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData);
+
+/* 書き込み結果の照合 */
+LOCAL uint32_t _FROM_SplitSimCheck(uint32_t ulBase, uint32_t ulAddress, uint32_t ulLength);
+
+/****************************************************************************/
+/*  提供関数                                                                */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : FROM_SplitSimRun                                                                */
+/*                                                                                              */
+/* DESCRIPTION: ページ分割書き込み照合                                                          */
+/*              ページ境界からのずれ0 - ulMaxOffset、長さ1 - ulMaxLengthの全組み合わせで        */
+/*              FROM_SplitWriteをRAMモデルへ書き込み、1回の書き込みがページ境界を跨がない・     */
+/*              インターリーブ単位の倍数・ulChunkMax以下であること、書き込み範囲のデータと      */
+/*              前後のデータ(書き込みで変化しないこと)を照合する                                */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ptConfig                        照合設定                                        */
+/*                                                                                              */
+/* OUTPUT     : ptResult                        照合結果                                        */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_PARAM_ERROR                パラメータに誤りがある                          */
+/*              その他                             FROM_SplitWriteの戻り値                      */
+/*                                                                                              */
+/************************************************************************************************/
+int FROM_SplitSimRun(const FROM_SplitSimConfig *ptConfig, FROM_SplitSimResult *ptResult)
+{
+FROM_SplitConfig tSplit = { 0 };
+uint32_t ulBase         = 0;
+uint32_t ulOffset       = 0;
+uint32_t ulLength       = 0;
+uint32_t i              = 0;
+int iRet                = FROM_SUCCESS;
+
+    /* パラメータチェック(先頭の前後1ページを照合できること) */
+    if ((ptConfig == NULL) || (ptResult == NULL) || (ptConfig->ulPageSize == 0U) ||
+        (FROM_SPLIT_SIM_DATA_MAX < ptConfig->ulMaxLength) ||
+        (((ptConfig->ulPageSize * 3U) + ptConfig->ulMaxOffset + ptConfig->ulMaxLength) > FROM_SPLIT_SIM_SIZE)) {
+        return FROM_PARAM_ERROR;
+    }
+    else {
+        memset(ptResult, 0, sizeof(FROM_SplitSimResult));
+    }
+
+    /* 書き込みデータ(0xFF以外を含むパターン) */
+    for (i = 0; i < FROM_SPLIT_SIM_DATA_MAX; i++) {
+        l_ucSplitData[i] = (unsigned char)((i * 13U) + 7U);
+    }
+
+    tSplit.ulDev      = 0U;
+    tSplit.ulPageSize = ptConfig->ulPageSize;
+    tSplit.ulWidth    = ptConfig->ulWidth;
+    tSplit.ulChunkMax = ptConfig->ulChunkMax;
+    tSplit.pfnWrite   = _FROM_SplitSimWrite;
+    l_ptSplitConfig   = ptConfig;
+    l_ptSplitResult   = ptResult;
+    ulBase            = ptConfig->ulPageSize;
+
+    for (ulOffset = 0; ulOffset <= ptConfig->ulMaxOffset; ulOffset++) {
+        for (ulLength = 1; ulLength <= ptConfig->ulMaxLength; ulLength++) {
+            /* 前後を0xA5、書き込み範囲を消去状態とする */
+            memset(&l_ucSplitFlash[0], 0xA5, (ptConfig->ulPageSize * 3U) + ptConfig->ulMaxOffset + ptConfig->ulMaxLength);
+            memset(&l_ucSplitFlash[ulBase + ulOffset], 0xFF, ulLength);
+
+            iRet = FROM_SplitWrite(&tSplit, ulBase + ulOffset, ulLength, l_ucSplitData);
+            if (iRet != FROM_SUCCESS) {
+                goto err_end;
+            }
+            else {
+                ptResult->ulRuns++;
+                ptResult->ulErrors += _FROM_SplitSimCheck(ulBase, ulBase + ulOffset, ulLength);
+            }
+        }
+    }
+
+err_end:
+    l_ptSplitConfig = NULL;
+    l_ptSplitResult = NULL;
+
+    return iRet;
+}
+
+/****************************************************************************/
+/*  ローカル関数                                                            */
+/****************************************************************************/
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SplitSimWrite                                                             */
+/*                                                                                              */
+/* DESCRIPTION: ページ分割書き込み照合の1回の書き込み                                           */
+/*              制約(ページ境界を跨がない・インターリーブ単位の倍数・ulChunkMax以下)を          */
+/*              チェックしてNORモデルへ書き込む                                                 */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulDev                           デバイス番号(未使用)                            */
+/*            : uiAddress                       書き込みアドレス                                */
+/*            : uiLength                        書き込みデータ長                                */
+/*            : strWriteData                    書き込みデータ                                  */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : FROM_SUCCESS                    正常終了                                        */
+/*              FROM_WRITE_ERROR                範囲外                                          */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL int _FROM_SplitSimWrite(uint32_t ulDev, unsigned int uiAddress, unsigned int uiLength, unsigned char *strWriteData)
+{
+const FROM_SplitSimConfig *ptConfig = l_ptSplitConfig;
+uint32_t i                          = 0;
+
+    l_ptSplitResult->ulWrites++;
+
+    if (((uiAddress % ptConfig->ulWidth) != 0U) ||                                   /* 開始がインターリーブ単位でない */
+        ((uiLength % ptConfig->ulWidth) != 0U) ||                                    /* 長さがインターリーブ単位でない */
+        (uiLength == 0U) || (ptConfig->ulChunkMax < uiLength) ||                     /* 長さ0、最大長超過 */
+        ((ptConfig->ulPageSize - (uiAddress % ptConfig->ulPageSize)) < uiLength)) {  /* ページ境界を跨ぐ */
+        l_ptSplitResult->ulViolations++;
+    }
+    else {
+        ;   /* do nothing */
+    }
+
+    /* NORモデルへの書き込み */
+    if ((FROM_SPLIT_SIM_SIZE < uiLength) || ((FROM_SPLIT_SIM_SIZE - uiLength) < uiAddress)) {
+        return FROM_WRITE_ERROR;
+    }
+    else {
+        for (i = 0; i < uiLength; i++) {
+            l_ucSplitFlash[uiAddress + i] &= strWriteData[i];
+        }
+    }
+
+    return FROM_SUCCESS;
+}
+
+/************************************************************************************************/
+/* FUNCTION   : _FROM_SplitSimCheck                                                             */
+/*                                                                                              */
+/* DESCRIPTION: ページ分割書き込み照合の書き込み結果照合                                        */
+/*              書き込み範囲は書き込みデータ、前後(ulBaseの前1ページから書き込み範囲の          */
+/*              後1ページまで)は0xA5のままであることを照合する                                  */
+/*----------------------------------------------------------------------------------------------*/
+/* INPUT      : ulBase                          照合範囲の基準アドレス(ページ境界)              */
+/*            : ulAddress                       書き込みアドレス                                */
+/*            : ulLength                        書き込みデータ長                                */
+/*                                                                                              */
+/* OUTPUT     : none                                                                            */
+/*                                                                                              */
+/* RESULTS    : 0                               一致                                            */
+/*              1                               不一致                                          */
+/*                                                                                              */
+/************************************************************************************************/
+LOCAL uint32_t _FROM_SplitSimCheck(uint32_t ulBase, uint32_t ulAddress, uint32_t ulLength)
+{
+uint32_t ulEnd = ulAddress + ulLength + l_ptSplitConfig->ulPageSize;
+uint32_t i     = 0;
+
+    for (i = ulBase - l_ptSplitConfig->ulPageSize; i < ulEnd; i++) {
+        if ((ulAddress <= i) && (i < (ulAddress + ulLength))) {
+            if (l_ucSplitFlash[i] != l_ucSplitData[i - ulAddress]) {
+                return 1U;
+            }
+            else {
+                ;   /* do nothing */
+            }
+        }
+        else if (l_ucSplitFlash[i] != 0xA5U) {
+            return 1U;
+        }
+        else {
+            ;   /* do nothing */
+        }
+    }
+
+    return 0U;
+}